@@ -1,10 +1,17 @@
+#include <cstdlib>
 #include <memory>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <filesystem>
 
 #include "application.hpp"
+#include "client/sauron_register.hpp"
+#include "logging/file_log_sink.hpp"
 #include "utils/logger.hpp"
+#include "utils/resource_utils.hpp"
+#include "utils/startup_profiler.hpp"
+#include "utils/task_graph.hpp"
 #include "window/overlay_window.hpp"
 #include "plugin_loader/plugin_manager.hpp"
 
@@ -16,9 +23,34 @@
 #endif
 
 using palantir::Application;
+using palantir::client::SauronRegister;
+using palantir::logging::FileLogSink;
+using palantir::logging::Logger;
 using palantir::PlatformApplication;
 using palantir::window::OverlayWindow;
 using palantir::plugin::PluginManager;
+using palantir::utils::ResourceUtils;
+using palantir::utils::ScopedSpan;
+using palantir::utils::StartupProfiler;
+using palantir::utils::TaskGraph;
+using palantir::utils::TaskMode;
+
+// Log the startup timeline, export it for chrome://tracing when PALANTIR_STARTUP_TRACE names a file
+auto reportStartup() -> void {
+    auto profiler = StartupProfiler::getInstance();
+    std::ostringstream timeline;
+    profiler->print(timeline);
+    PALANTIR_LOG_INFO("Startup timeline:\n{}", timeline.str());
+
+    if (const char* tracePath = std::getenv("PALANTIR_STARTUP_TRACE"); tracePath != nullptr) {  // NOLINT
+        if (!profiler->writeChromeTrace(std::filesystem::path(tracePath))) {
+            PALANTIR_LOG_WARN("Failed to write the startup trace to {}", tracePath);
+        }
+    }
+    // Nothing records past startup
+    profiler->setEnabled(false);
+    profiler->clear();
+}
 
 // Platform-agnostic application code
 auto run_app() -> int {
@@ -28,25 +60,74 @@ auto run_app() -> int {
 
         // Initialize plugin manager and load plugins
         auto pluginManager = std::make_unique<PluginManager>();
+        // Commands of plugins loaded on first use act on the window, like the others
+        pluginManager->setUiDispatcher(app->getUiDispatcher());
         
         // Get the executable path and construct plugins directory path
         std::filesystem::path exePath = std::filesystem::current_path();
         std::filesystem::path pluginsDir = exePath / "plugins";
 
-        // Load all plugins from the plugins directory
-        pluginManager->setupFromDirectory(pluginsDir);
+        // Keep diagnostics in production, the platform debug output needs a debugger attached
+        try {
+            Logger::getInstance()->addSink(std::make_shared<FileLogSink>(exePath / "logs" / "palantir.log"));
+        } catch (const std::exception& e) {
+            DebugLog("Failed to open the log file: ", e.what());
+        }
 
-        // Create window
-        auto windowManager = app->getWindowManager();
-        auto window = std::make_unique<OverlayWindow>();
-        window->create();
-        windowManager->addWindow(std::move(window));
+        // Reload plugins rebuilt while the overlay runs, for plugin development
+        if (std::getenv("PALANTIR_HOT_RELOAD") != nullptr) {  // NOLINT
+            pluginManager->enableHotReload([app]() { app->getSignalManager()->rebindSignals(); });
+        }
 
-        // Attach signals from configuration
-        app->attachSignals();
+        // Startup phases, each one starts as soon as the phases it needs are done. Background phases
+        // keep running in the message loop, the ones still queued when it ends are dropped.
+        // A failed background phase is done again on first use: the first request retries the login and
+        // the first injection reads the scripts.
+        TaskGraph startup;
+        startup
+            // Parse the shortcut configuration while plugins register their commands
+            .addTask("config", [app]() { app->prepareSignals(); })
+            // Load all plugins from the plugins directory
+            .addTask("plugins", [&pluginManager, &pluginsDir]() { pluginManager->setupFromDirectory(pluginsDir); })
+            // Create window, on the UI thread
+            .addTask(
+                "window",
+                [app]() {
+                    auto window = std::make_unique<OverlayWindow>();
+                    window->create();
+                    // Batched content updates are sent even when no frame tick follows them
+                    if (auto contentManager = window->getContentManager()) {
+                        contentManager->setUiDispatcher(app->getUiDispatcher());
+                    }
+                    app->getWindowManager()->addWindow(std::move(window));
+                },
+                {}, TaskMode::CALLER)
+            // Attach signals from configuration, their commands act on the window
+            .addTask("signals", [app]() { app->attachSignals(); }, {"config", "plugins", "window"}, TaskMode::CALLER)
+            // Log in to Sauron before the first request needs it
+            .addTask("sauron", []() { SauronRegister::getInstance()->login(); }, {}, TaskMode::BACKGROUND)
+            // Scripts injected once the webview content is loaded
+            .addTask(
+                "resources", []() { ResourceUtils::getInstance()->preloadJavaScriptsFromDirectory("post-nav"); }, {},
+                TaskMode::BACKGROUND);
+        {
+            ScopedSpan span("startup");
+            startup.run();
+        }
+        reportStartup();
 
         int result = app->run();
 
+        // Only waits for a background phase already running
+        startup.cancel();
+        try {
+            startup.waitForBackground();
+        } catch (const palantir::exception::TraceableBaseException& e) {
+            PALANTIR_LOG_WARN("Startup background phase failed: {}", e.what());
+        } catch (const std::exception& e) {
+            PALANTIR_LOG_WARN("Startup background phase failed: {}", e.what());
+        }
+
         return result;
     } catch (const palantir::exception::TraceableBaseException& e) {
         DebugLog("Fatal error: ", e.what());
@@ -61,7 +142,7 @@ auto run_app() -> int {
 #endif
         return 1;
     } catch (const std::exception& e) {
-        DebugLog("Fatal error: {}", e.what());
+        PALANTIR_LOG_ERROR("Fatal error: {}", e.what());
 #ifdef _WIN32
         MessageBoxA(nullptr, e.what(), "Fatal Error", MB_OK | MB_ICONERROR);
 #endif
@@ -27,13 +27,15 @@ class PlatformApplication::Impl {
      * @brief Construct the implementation object.
      * @param signalManager Reference to the signal manager for input processing.
      * @param windowManager Reference to the window manager for window handling.
+     * @param uiDispatcher Reference to the dispatcher drained on the main queue.
      *
      * Initializes the implementation with references to the managers and sets up
      * the Cocoa application infrastructure. Also requests accessibility permissions
      * which are required for global event monitoring.
      */
-    explicit Impl(signal::SignalManager& signalManager, std::shared_ptr<window::WindowManager> windowManager)
-        : signalManager_(signalManager), windowManager_(windowManager) {
+    explicit Impl(signal::SignalManager& signalManager, std::shared_ptr<window::WindowManager> windowManager,
+                  std::shared_ptr<UiDispatcher> uiDispatcher)
+        : signalManager_(signalManager), windowManager_(windowManager), uiDispatcher_(std::move(uiDispatcher)) {
         DebugLog("Initializing PlatformApplication");
         [NSApplication sharedApplication];
         [NSApp setActivationPolicy:NSApplicationActivationPolicyAccessory];
@@ -42,12 +44,12 @@ class PlatformApplication::Impl {
         NSDictionary* const options = @{(__bridge id)kAXTrustedCheckOptionPrompt : @YES};
         const bool accessibilityEnabled = AXIsProcessTrustedWithOptions((__bridge CFDictionaryRef)options) != 0;
 
-        DebugLog("Accessibility status: %s", accessibilityEnabled ? "Enabled" : "Disabled");
+        PALANTIR_LOG_INFO("Accessibility status: {}", accessibilityEnabled ? "Enabled" : "Disabled");
 
         if (!accessibilityEnabled) {
             NSString* const message = @"Please grant accessibility permissions in System Preferences > "
                                       @"Security & Privacy > Privacy > Accessibility";
-            DebugLog("%s", [message UTF8String]);
+            PALANTIR_LOG_WARN("{}", [message UTF8String]);
         }
 
         DebugLog("Application initialization complete");
@@ -59,10 +61,21 @@ class PlatformApplication::Impl {
      *
      * Starts the Cocoa run loop, which will continue until the application
      * is terminated. This is the main event processing loop for macOS.
+     * Tasks posted to the UI dispatcher are drained from the main queue.
      */
     [[nodiscard]] auto run() -> int {
         DebugLog("Starting application run loop");
+        uiDispatcher_->attachToCurrentThread();
+        std::weak_ptr<UiDispatcher> weakDispatcher = uiDispatcher_;
+        uiDispatcher_->setWakeup([weakDispatcher]() {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                if (auto dispatcher = weakDispatcher.lock()) {
+                    dispatcher->drain();
+                }
+            });
+        });
         [NSApp run];
+        uiDispatcher_->setWakeup(nullptr);
         return 0;
     }
 
@@ -81,10 +94,11 @@ class PlatformApplication::Impl {
    private:
     signal::SignalManager& signalManager_;                  ///< Reference to the signal manager
     std::shared_ptr<window::WindowManager> windowManager_;  ///< Reference to the window manager
+    std::shared_ptr<UiDispatcher> uiDispatcher_;            ///< Dispatcher drained on the main queue
 };
 
 PlatformApplication::PlatformApplication(const std::string& configPath)
-    : Application(configPath), pImpl_(std::make_unique<Impl>(getSignalManager(), getWindowManager())) {
+    : Application(configPath), pImpl_(std::make_unique<Impl>(getSignalManager(), getWindowManager(), getUiDispatcher())) {
     DebugLog("Creating MacOS platform application");
 }
 
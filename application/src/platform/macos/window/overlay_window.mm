@@ -28,11 +28,11 @@ constexpr double K_FONT_SIZE = 14.0;
 }
 
 - (void)windowDidResize:(NSNotification*)notification {
-    DebugLog("Window resized to: %s", [NSStringFromRect([((NSWindow*)notification.object) frame]) UTF8String]);
+    PALANTIR_LOG_DEBUG("Window resized to: {}", [NSStringFromRect([((NSWindow*)notification.object) frame]) UTF8String]);
 }
 
 - (void)windowDidMove:(NSNotification*)notification {
-    DebugLog("Window moved to: %s", [NSStringFromRect([((NSWindow*)notification.object) frame]) UTF8String]);
+    PALANTIR_LOG_DEBUG("Window moved to: {}", [NSStringFromRect([((NSWindow*)notification.object) frame]) UTF8String]);
 }
 
 - (void)windowDidBecomeKey:(NSNotification*)notification {
@@ -80,7 +80,7 @@ class OverlayWindow::Impl {
                                                backing:NSBackingStoreBuffered
                                                  defer:NO];
 
-        DebugLog("Window created with frame: %@", NSStringFromRect(frame));
+        PALANTIR_LOG_DEBUG("Window created with frame: {}", [NSStringFromRect(frame) UTF8String]);
 
         [window_ setTitle:@"Interview Notes"];
         [window_ setReleasedWhenClosed:NO];
@@ -181,7 +181,7 @@ class OverlayWindow::Impl {
         windowFrame.origin.y =
             screenFrame.origin.y + screenFrame.size.height - windowFrame.size.height - K_WINDOW_MARGIN;
         [window_ setFrame:windowFrame display:NO];
-        DebugLog("Window positioned at: %@", NSStringFromRect(windowFrame));
+        PALANTIR_LOG_DEBUG("Window positioned at: {}", [NSStringFromRect(windowFrame) UTF8String]);
     }
 
     auto show() -> void {
@@ -280,7 +280,7 @@ auto OverlayWindow::toggleWindowAnonymity() -> void { pImpl_->toggleWindowAnonym
 [[nodiscard]] auto OverlayWindow::isRunning() const -> bool { return running_; }
 
 auto OverlayWindow::setRunning(bool runningState) -> void {
-    DebugLog("Setting running state to: %d", runningState);
+    PALANTIR_LOG_DEBUG("Setting running state to: {}", runningState);
     running_ = runningState;
 }
 
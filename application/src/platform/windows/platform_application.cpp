@@ -32,13 +32,15 @@ public:
      * @brief Construct the implementation object.
      * @param signalManager Reference to the signal manager for input processing.
      * @param windowManager Reference to the window manager for window handling.
+     * @param uiDispatcher Reference to the dispatcher drained by the message loop.
      *
      * Initializes the implementation with references to the managers and sets up
      * the Windows keyboard hook for global input monitoring.
      */
     explicit Impl(const std::shared_ptr<signal::ISignalManager>& signalManager,
-                  const std::shared_ptr<window::WindowManager>& windowManager)
-        : signalManager_(signalManager), windowManager_(windowManager) {
+                  const std::shared_ptr<window::WindowManager>& windowManager,
+                  const std::shared_ptr<UiDispatcher>& uiDispatcher)
+        : signalManager_(signalManager), windowManager_(windowManager), uiDispatcher_(uiDispatcher) {
         DebugLog("Initializing Windows platform application");
     }
 
@@ -48,7 +50,8 @@ public:
      *
      * Runs the Windows message loop, processing window messages and
      * dispatching them to appropriate window procedures. The loop
-     * continues until a WM_QUIT message is received.
+     * continues until a WM_QUIT message is received. Tasks posted to the
+     * UI dispatcher wake the loop through a registered thread message.
      */
     [[nodiscard]] auto run() const -> int {
         DebugLog("Starting message loop");
@@ -62,6 +65,13 @@ public:
             return 1;
         }
 
+        // Tasks posted from other threads wake this loop with a registered message
+        const UINT uiDispatchMessage = RegisterWindowMessageW(L"Palantir.UiDispatcher");
+        const DWORD uiThreadId = GetCurrentThreadId();
+        uiDispatcher_->attachToCurrentThread();
+        uiDispatcher_->setWakeup(
+            [uiThreadId, uiDispatchMessage]() { PostThreadMessageW(uiThreadId, uiDispatchMessage, 0, 0); });
+
         // Show the main window
         mainWindow->show();
 
@@ -77,6 +87,12 @@ public:
                     break;
                 }
 
+                // Thread messages have no window, run the UI tasks here
+                if (msg.message == uiDispatchMessage) {
+                    uiDispatcher_->drain();
+                    continue;
+                }
+
                 // Process the message
                 TranslateMessage(&msg);
                 DispatchMessage(&msg);
@@ -86,6 +102,9 @@ public:
                     mainWindow->update();
                 }
 
+                // Thread messages are lost while a modal loop runs, e.g. during a window drag
+                uiDispatcher_->drain();
+
                 // Don't consume 100% CPU, yield to other threads briefly
                 Sleep(1);
             }
@@ -100,8 +119,9 @@ public:
         if (timerId != 0) {
             KillTimer(nullptr, timerId);
         }
+        uiDispatcher_->setWakeup(nullptr);
 
-        DebugLog("Message loop ended with exit code %d", static_cast<int>(msg.wParam));
+        PALANTIR_LOG_INFO("Message loop ended with exit code {}", static_cast<int>(msg.wParam));
         return static_cast<int>(msg.wParam);
     }
 
@@ -128,6 +148,7 @@ public:
 private:
     std::shared_ptr<signal::ISignalManager> signalManager_;  ///< Reference to the signal manager
     std::shared_ptr<window::WindowManager> windowManager_;   ///< Reference to the window manager
+    std::shared_ptr<UiDispatcher> uiDispatcher_;             ///< Dispatcher drained by the message loop
 };
 
 /**
@@ -138,7 +159,7 @@ private:
  * Application class and creating the platform-specific implementation.
  */
 PlatformApplication::PlatformApplication()
-    : Application(), pImpl_(std::make_unique<Impl>(getSignalManager(), getWindowManager())) {
+    : Application(), pImpl_(std::make_unique<Impl>(getSignalManager(), getWindowManager(), getUiDispatcher())) {
     DebugLog("Creating Windows platform application");
 }
 
@@ -18,6 +18,7 @@
 
 #include "exception/application_exceptions.hpp"
 #include "utils/logger.hpp"
+#include "utils/string_utils.hpp"
 
 using Microsoft::WRL::ComPtr;
 
@@ -97,7 +98,7 @@ auto WebView::initializeController(uintptr_t controller) -> intptr_t {
 
     HRESULT hResult = pimpl_->controller_->get_CoreWebView2(&pimpl_->webView_);
     if (FAILED(hResult) || !pimpl_->webView_) {
-        DebugLog("Failed to get CoreWebView2 from controller: 0x%08x", hResult);
+        PALANTIR_LOG_ERROR("Failed to get CoreWebView2 from controller: {:#010x}", static_cast<uint32_t>(hResult));
         return hResult;
     }
 
@@ -120,7 +121,7 @@ auto WebView::initializeController(uintptr_t controller) -> intptr_t {
         pimpl_->webView_->add_SourceChanged(pimpl_->callbacks_->getSourceChangedHandler().Get(), &pimpl_->sourceToken_);
 
     if (FAILED(hResult)) {
-        DebugLog("Failed to add source changed handler: 0x%08x", hResult);
+        PALANTIR_LOG_ERROR("Failed to add source changed handler: {:#010x}", static_cast<uint32_t>(hResult));
         return hResult;
     }
 
@@ -128,7 +129,7 @@ auto WebView::initializeController(uintptr_t controller) -> intptr_t {
                                                         &pimpl_->navigationToken_);
 
     if (FAILED(hResult)) {
-        DebugLog("Failed to add navigation completed handler: 0x%08x", hResult);
+        PALANTIR_LOG_ERROR("Failed to add navigation completed handler: {:#010x}", static_cast<uint32_t>(hResult));
         return hResult;
     }
 
@@ -136,14 +137,14 @@ auto WebView::initializeController(uintptr_t controller) -> intptr_t {
                                                        &pimpl_->messageToken_);
 
     if (FAILED(hResult)) {
-        DebugLog("Failed to add message received handler: 0x%08x", hResult);
+        PALANTIR_LOG_ERROR("Failed to add message received handler: {:#010x}", static_cast<uint32_t>(hResult));
         return hResult;
     }
 
     RECT bounds;
     GetClientRect(pimpl_->hwnd_, &bounds);
-    DebugLog("Setting WebView2 bounds to: left=%ld, top=%ld, right=%ld, bottom=%ld", bounds.left, bounds.top,
-             bounds.right, bounds.bottom);
+    PALANTIR_LOG_DEBUG("Setting WebView2 bounds to: left={}, top={}, right={}, bottom={}", bounds.left, bounds.top,
+                       bounds.right, bounds.bottom);
     pimpl_->controller_->put_Bounds(bounds);
     pimpl_->controller_->put_IsVisible(TRUE);
 
@@ -157,7 +158,7 @@ auto WebView::loadURL(const std::string& url) -> void {
         return;
     }
 
-    std::wstring wurl(url.begin(), url.end());
+    const auto wurl = utils::StringUtils::strToW(url);
     HRESULT hResult = pimpl_->webView_->Navigate(wurl.c_str());
     if (FAILED(hResult)) {
         throw palantir::exception::TraceableNavigationException("Failed to navigate to URL");
@@ -169,7 +170,7 @@ auto WebView::executeJavaScript(const std::string& script) -> void {
         return;
     }
 
-    std::wstring wscript(script.begin(), script.end());
+    const auto wscript = utils::StringUtils::strToW(script);
     HRESULT hResult = pimpl_->webView_->ExecuteScript(wscript.c_str(), nullptr);
     if (FAILED(hResult)) {
         throw palantir::exception::TraceableJavaScriptExecutionException("Failed to execute JavaScript");
@@ -181,13 +182,25 @@ auto WebView::sendMessageToJS(const std::string& message) -> void {
         return;
     }
 
-    std::wstring wmessage(message.begin(), message.end());
+    const auto wmessage = utils::StringUtils::strToW(message);
     HRESULT hResult = pimpl_->webView_->PostWebMessageAsString(wmessage.c_str());
     if (FAILED(hResult)) {
         throw palantir::exception::TraceableMessageSendException("Failed to send message to JavaScript");
     }
 }
 
+auto WebView::postMessage(const std::string& jsonMessage) -> void {
+    if (!pimpl_->webView_) {
+        return;
+    }
+
+    const auto wmessage = utils::StringUtils::strToW(jsonMessage);
+    HRESULT hResult = pimpl_->webView_->PostWebMessageAsJson(wmessage.c_str());
+    if (FAILED(hResult)) {
+        throw palantir::exception::TraceableMessageSendException("Failed to post message to JavaScript");
+    }
+}
+
 auto WebView::reload() -> void {
     if (!pimpl_->webView_) {
         return;
@@ -319,6 +332,12 @@ auto WebView::registerMessageStrategy(std::unique_ptr<message::MessageStrategyBa
     }
 }
 
+auto WebView::registerMessageDispatcher(std::unique_ptr<message::MessageDispatcherBase> dispatcher) -> void {
+    if (pimpl_->messageHandler_) {
+        pimpl_->messageHandler_->registerDispatcher(std::move(dispatcher));
+    }
+}
+
 auto WebView::handleMessage(const std::string& message) -> void {
     if (pimpl_->messageHandler_) {
         pimpl_->messageHandler_->handleMessage(message);
@@ -60,8 +60,7 @@ auto WebViewCallbacks::handleWebMessageReceived([[maybe_unused]] const ICoreWebV
     }
 
     if (message != nullptr) {
-        std::wstring wmessage(message);
-        std::string messageStr(wmessage.begin(), wmessage.end());
+        std::string messageStr = palantir::utils::StringUtils::wToStr(message);
         DebugLog("Received WebView2 message: ", messageStr);
 
         webview->handleMessage(messageStr);
@@ -93,7 +92,7 @@ auto WebViewCallbacks::handleNavigationCompleted(ICoreWebView2* sender,
         for (const auto& [filename, script] : scripts) {
             DebugLog("Executing post-navigation script: ", filename);
 
-            std::wstring wScript(script.begin(), script.end());
+            const auto wScript = palantir::utils::StringUtils::strToW(script);
             sender->ExecuteScript(wScript.c_str(), nullptr);
         }
     }
@@ -142,7 +142,7 @@ auto OverlayWindow::Impl::create() -> void {
 
     if (RegisterClassExW(&windowClass) == 0) {
         DWORD error = GetLastError();
-        DebugLog("Failed to register window class: %lu", error);
+        PALANTIR_LOG_ERROR("Failed to register window class: {}", error);
         throw palantir::exception::TraceableWindowOperationException("Failed to register window class");
     }
 
@@ -153,11 +153,11 @@ auto OverlayWindow::Impl::create() -> void {
 
     if (hwnd_ == nullptr) {
         DWORD error = GetLastError();
-        DebugLog("Failed to create window: %lu", error);
+        PALANTIR_LOG_ERROR("Failed to create window: {}", error);
         throw palantir::exception::TraceableWindowOperationException("Failed to create window");
     }
 
-    DebugLog("Window created successfully with handle: %p", hwnd_);
+    PALANTIR_LOG_DEBUG("Window created successfully with handle: {}", static_cast<const void*>(hwnd_));
 
     // Make the window frameless with a semi-transparent background, but keep right frame
     makeWindowFrameless();
@@ -248,7 +248,7 @@ auto OverlayWindow::Impl::updateWindowSize(int contentWidth, int contentHeight)
 
     // Only resize if the size has actually changed
     if (newWidth != currentWidth_ || newHeight != currentHeight_) {
-        DebugLog("Resizing window to %dx%d", newWidth, newHeight);
+        PALANTIR_LOG_DEBUG("Resizing window to {}x{}", newWidth, newHeight);
 
         // Get current window position to maintain the same center point
         RECT windowRect;
@@ -306,8 +306,9 @@ auto OverlayWindow::Impl::show() -> void {
 }
 
 auto OverlayWindow::Impl::update() -> void {
-    if (hwnd_ != nullptr) {
-        return;
+    // Called by the message loop on every frame tick, sends the content updates batched since the last one
+    if (contentManager_) {
+        contentManager_->onFrame();
     }
 }
 
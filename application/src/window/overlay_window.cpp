@@ -36,7 +36,7 @@ auto OverlayWindow::onContentSizeChanged(int width, int height) -> void {
     width = std::min(width, screenWidth);
     height = std::min(height, screenHeight);
 
-    DebugLog("Content size changed notification received: %dx%d", width, height);
+    PALANTIR_LOG_DEBUG("Content size changed notification received: {}x{}", width, height);
     if (width > 0 && height > 0) {
         updateWindowSize(width, height);
     }
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+namespace palantir::benchmark {
+
+/**
+ * @brief Process-wide heap allocation counters.
+ *
+ * Linking the benchmark common library replaces the global operator new/delete, aligned
+ * overloads included. The replacement covers the executable, and on Linux and macOS the shared
+ * libraries it loads. On Windows palantir-core is a DLL that keeps the operator new of its own
+ * CRT: only what the executable allocates is counted, such as the header-only ContentManager.
+ * The per-thread counters let a load generator attribute allocations to the requests it
+ * drives even when an in-process server allocates concurrently.
+ *
+ * Only operator new is replaced: C libraries calling malloc directly, such as libcurl, are not counted.
+ */
+struct AllocationCounters {
+    uint64_t allocations{0};
+    uint64_t bytes{0};
+};
+
+[[nodiscard]] auto allocationCounters() -> AllocationCounters;
+
+[[nodiscard]] auto threadAllocationCounters() -> AllocationCounters;
+
+}  // namespace palantir::benchmark
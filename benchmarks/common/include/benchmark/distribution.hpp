@@ -0,0 +1,43 @@
+#pragma once
+
+#include <random>
+#include <string>
+
+namespace palantir::benchmark {
+
+/**
+ * @class Distribution
+ * @brief Random value source parsed from a short textual specification.
+ *
+ * Supported specifications:
+ * - "constant:<value>"
+ * - "uniform:<min>,<max>"
+ * - "lognormal:<median>,<sigma>" where sigma is the standard deviation of the underlying normal
+ *
+ * A bare number is read as a constant.
+ */
+class Distribution {
+public:
+    enum class Kind { CONSTANT, UNIFORM, LOGNORMAL };
+
+    Distribution() = default;
+    Distribution(Kind kind, double first, double second);
+
+    /**
+     * @brief Parse a distribution specification.
+     * @throws std::invalid_argument if the specification is malformed
+     */
+    [[nodiscard]] static auto parse(const std::string& spec) -> Distribution;
+
+    /** @brief Draw a non-negative value. */
+    [[nodiscard]] auto sample(std::mt19937_64& engine) const -> double;
+
+    [[nodiscard]] auto toString() const -> std::string;
+
+private:
+    Kind kind_{Kind::CONSTANT};
+    double first_{0.0};
+    double second_{0.0};
+};
+
+}  // namespace palantir::benchmark
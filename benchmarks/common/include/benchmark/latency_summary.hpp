@@ -0,0 +1,56 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace palantir::benchmark {
+
+/**
+ * @brief Percentiles of a set of latency samples, all values in microseconds.
+ */
+struct LatencySummary {
+    std::size_t count{0};
+    double min{0.0};
+    double mean{0.0};
+    double p50{0.0};
+    double p90{0.0};
+    double p95{0.0};
+    double p99{0.0};
+    double max{0.0};
+
+    [[nodiscard]] static auto fromSamples(std::vector<double> samples) -> LatencySummary {
+        LatencySummary summary;
+        if (samples.empty()) {
+            return summary;
+        }
+        std::sort(samples.begin(), samples.end());
+        auto at = [&samples](double percentile) {
+            auto rank = static_cast<std::size_t>(std::ceil(percentile / 100.0 * static_cast<double>(samples.size())));
+            return samples[std::clamp<std::size_t>(rank, 1, samples.size()) - 1];
+        };
+        double total = 0.0;
+        for (double sample : samples) {
+            total += sample;
+        }
+        summary.count = samples.size();
+        summary.min = samples.front();
+        summary.mean = total / static_cast<double>(samples.size());
+        summary.p50 = at(50.0);
+        summary.p90 = at(90.0);
+        summary.p95 = at(95.0);
+        summary.p99 = at(99.0);
+        summary.max = samples.back();
+        return summary;
+    }
+
+    auto print(std::ostream& out, const std::string& label) const -> void {
+        out << label << " (us): n=" << count << " min=" << min << " mean=" << mean << " p50=" << p50
+            << " p90=" << p90 << " p95=" << p95 << " p99=" << p99 << " max=" << max << "\n";
+    }
+};
+
+}  // namespace palantir::benchmark
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <map>
+#include <string>
+
+namespace palantir::benchmark {
+
+/**
+ * @class Options
+ * @brief Command line options given as "--name=value" or "--flag".
+ */
+class Options {
+public:
+    Options(int argc, char* argv[]) {
+        for (int index = 1; index < argc; ++index) {
+            std::string argument(argv[index]);
+            if (argument.rfind("--", 0) != 0) {
+                continue;
+            }
+            const auto equals = argument.find('=');
+            if (equals == std::string::npos) {
+                values_[argument.substr(2)] = "true";
+            } else {
+                values_[argument.substr(2, equals - 2)] = argument.substr(equals + 1);
+            }
+        }
+    }
+
+    [[nodiscard]] auto has(const std::string& name) const -> bool { return values_.contains(name); }
+
+    [[nodiscard]] auto get(const std::string& name, const std::string& fallback) const -> std::string {
+        auto it = values_.find(name);
+        return it == values_.end() ? fallback : it->second;
+    }
+
+    [[nodiscard]] auto getInt(const std::string& name, long long fallback) const -> long long {
+        auto it = values_.find(name);
+        return it == values_.end() ? fallback : std::stoll(it->second);
+    }
+
+private:
+    std::map<std::string, std::string> values_;
+};
+
+}  // namespace palantir::benchmark
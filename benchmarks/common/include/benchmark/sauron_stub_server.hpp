@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "benchmark/distribution.hpp"
+
+namespace palantir::benchmark {
+
+/**
+ * @brief Configuration of the local Sauron stand-in server.
+ */
+struct SauronStubConfig {
+    // Port to listen on, 0 picks a free one
+    uint16_t port{0};
+    // Time spent before answering a query, in milliseconds
+    Distribution latencyMs{Distribution::Kind::LOGNORMAL, 200.0, 0.5};
+    // Size of the generated "response" field of a query answer, in bytes
+    Distribution responseBytes{Distribution::Kind::UNIFORM, 2048.0, 16384.0};
+    uint64_t seed{42};
+};
+
+/**
+ * @brief Counters exposed by the stub server.
+ */
+struct SauronStubStats {
+    uint64_t logins{0};
+    uint64_t queries{0};
+    uint64_t bytesReceived{0};
+    uint64_t bytesSent{0};
+};
+
+/**
+ * @class SauronStubServer
+ * @brief Minimal HTTP/1.1 server answering the Sauron login and query endpoints.
+ *
+ * Any POST whose path contains "login" gets a token, every other request is answered as
+ * an algorithm query after a sampled delay with a generated response of sampled size.
+ * Connections are kept alive and each one is served by its own thread, which is enough
+ * for load-testing a client without any network access.
+ */
+class SauronStubServer {
+public:
+    explicit SauronStubServer(SauronStubConfig config);
+    ~SauronStubServer();
+
+    SauronStubServer(const SauronStubServer&) = delete;
+    auto operator=(const SauronStubServer&) -> SauronStubServer& = delete;
+    SauronStubServer(SauronStubServer&&) = delete;
+    auto operator=(SauronStubServer&&) -> SauronStubServer& = delete;
+
+    /**
+     * @brief Start listening on the loopback interface.
+     * @return The port actually bound
+     * @throws std::runtime_error if the socket cannot be opened
+     */
+    auto start() -> uint16_t;
+
+    /** @brief Stop accepting connections and close the open ones. */
+    auto stop() -> void;
+
+    [[nodiscard]] auto getStats() const -> SauronStubStats;
+
+private:
+    class SauronStubServerImpl;
+    std::unique_ptr<SauronStubServerImpl> pimpl_;
+};
+
+}  // namespace palantir::benchmark
@@ -0,0 +1,90 @@
+#include "benchmark/allocation_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace {
+std::atomic<uint64_t> allocationCount{0};
+std::atomic<uint64_t> allocationBytes{0};
+thread_local uint64_t threadAllocationCount = 0;
+thread_local uint64_t threadAllocationBytes = 0;
+
+auto count(std::size_t size) -> void {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationBytes.fetch_add(size, std::memory_order_relaxed);
+    ++threadAllocationCount;
+    threadAllocationBytes += size;
+}
+
+auto countedAllocate(std::size_t size) -> void* {
+    count(size);
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+// Over-aligned types, e.g. alignas(64) counters, go through the align_val_t overloads
+auto countedAlignedAllocate(std::size_t size, std::align_val_t alignment) -> void* {
+    count(size);
+    const auto align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+    void* pointer = _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+    // aligned_alloc wants a size that is a multiple of the alignment
+    void* pointer = std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+    if (pointer != nullptr) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+auto alignedFree(void* pointer) -> void {
+#ifdef _WIN32
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+}  // namespace
+
+auto operator new(std::size_t size) -> void* { return countedAllocate(size); }
+auto operator new[](std::size_t size) -> void* { return countedAllocate(size); }
+auto operator delete(void* pointer) noexcept -> void { std::free(pointer); }
+auto operator delete[](void* pointer) noexcept -> void { std::free(pointer); }
+auto operator delete(void* pointer, std::size_t /*size*/) noexcept -> void { std::free(pointer); }
+auto operator delete[](void* pointer, std::size_t /*size*/) noexcept -> void { std::free(pointer); }
+
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* {
+    return countedAlignedAllocate(size, alignment);
+}
+auto operator new[](std::size_t size, std::align_val_t alignment) -> void* {
+    return countedAlignedAllocate(size, alignment);
+}
+auto operator delete(void* pointer, std::align_val_t /*alignment*/) noexcept -> void { alignedFree(pointer); }
+auto operator delete[](void* pointer, std::align_val_t /*alignment*/) noexcept -> void { alignedFree(pointer); }
+auto operator delete(void* pointer, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept -> void {
+    alignedFree(pointer);
+}
+auto operator delete[](void* pointer, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept -> void {
+    alignedFree(pointer);
+}
+
+namespace palantir::benchmark {
+
+auto allocationCounters() -> AllocationCounters {
+    return AllocationCounters{allocationCount.load(std::memory_order_relaxed),
+                              allocationBytes.load(std::memory_order_relaxed)};
+}
+
+auto threadAllocationCounters() -> AllocationCounters {
+    return AllocationCounters{threadAllocationCount, threadAllocationBytes};
+}
+
+}  // namespace palantir::benchmark
@@ -0,0 +1,70 @@
+#include "benchmark/distribution.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+namespace palantir::benchmark {
+
+Distribution::Distribution(Kind kind, double first, double second) : kind_(kind), first_(first), second_(second) {}
+
+auto Distribution::parse(const std::string& spec) -> Distribution {
+    const auto colon = spec.find(':');
+    const auto name = colon == std::string::npos ? std::string("constant") : spec.substr(0, colon);
+    const auto arguments = colon == std::string::npos ? spec : spec.substr(colon + 1);
+    const auto comma = arguments.find(',');
+    try {
+        if (name == "constant") {
+            return {Kind::CONSTANT, std::stod(arguments), 0.0};
+        }
+        if (comma == std::string::npos) {
+            throw std::invalid_argument("missing second parameter");
+        }
+        const double first = std::stod(arguments.substr(0, comma));
+        const double second = std::stod(arguments.substr(comma + 1));
+        if (name == "uniform") {
+            return {Kind::UNIFORM, std::min(first, second), std::max(first, second)};
+        }
+        if (name == "lognormal") {
+            return {Kind::LOGNORMAL, first, second};
+        }
+    } catch (const std::exception& e) {
+        throw std::invalid_argument("Invalid distribution '" + spec + "': " + e.what());
+    }
+    throw std::invalid_argument("Unknown distribution '" + spec + "'");
+}
+
+auto Distribution::sample(std::mt19937_64& engine) const -> double {
+    switch (kind_) {
+        case Kind::UNIFORM:
+            return std::uniform_real_distribution<double>(first_, second_)(engine);
+        case Kind::LOGNORMAL:
+            if (first_ <= 0.0) {
+                return 0.0;
+            }
+            return std::lognormal_distribution<double>(std::log(first_), second_)(engine);
+        case Kind::CONSTANT:
+        default:
+            return std::max(first_, 0.0);
+    }
+}
+
+auto Distribution::toString() const -> std::string {
+    std::ostringstream stream;
+    switch (kind_) {
+        case Kind::UNIFORM:
+            stream << "uniform:" << first_ << "," << second_;
+            break;
+        case Kind::LOGNORMAL:
+            stream << "lognormal:" << first_ << "," << second_;
+            break;
+        case Kind::CONSTANT:
+        default:
+            stream << "constant:" << first_;
+            break;
+    }
+    return stream.str();
+}
+
+}  // namespace palantir::benchmark
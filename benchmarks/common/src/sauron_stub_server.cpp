@@ -0,0 +1,345 @@
+#include "benchmark/sauron_stub_server.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace palantir::benchmark {
+
+namespace {
+
+#ifdef _WIN32
+using SocketHandle = SOCKET;
+constexpr SocketHandle INVALID_SOCKET_HANDLE = INVALID_SOCKET;
+auto closeSocket(SocketHandle socket) -> void { closesocket(socket); }
+auto shutdownSocket(SocketHandle socket) -> void { shutdown(socket, SD_BOTH); }
+#else
+using SocketHandle = int;
+constexpr SocketHandle INVALID_SOCKET_HANDLE = -1;
+auto closeSocket(SocketHandle socket) -> void { close(socket); }
+auto shutdownSocket(SocketHandle socket) -> void { shutdown(socket, SHUT_RDWR); }
+#endif
+
+constexpr std::size_t RECEIVE_CHUNK_SIZE = 16384;
+constexpr int LISTEN_BACKLOG = 128;
+constexpr auto MAX_ACCEPT_BACKOFF = std::chrono::milliseconds(100);
+constexpr std::size_t MAX_BODY_SIZE = 256 * 1024 * 1024;
+
+struct HttpRequest {
+    std::string method;
+    std::string path;
+    std::string body;
+    bool keepAlive{true};
+};
+
+auto toLower(std::string value) -> std::string {
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](unsigned char character) { return static_cast<char>(std::tolower(character)); });
+    return value;
+}
+
+// Content-Length header value, std::nullopt when it is not a number or larger than MAX_BODY_SIZE
+auto parseContentLength(std::string_view value) -> std::optional<std::size_t> {
+    while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) {
+        value.remove_prefix(1);
+    }
+    std::size_t length = 0;
+    const auto result = std::from_chars(value.data(), value.data() + value.size(), length);
+    if (result.ec != std::errc{} || length > MAX_BODY_SIZE) {
+        return std::nullopt;
+    }
+    return length;
+}
+
+auto sendAll(SocketHandle socket, const std::string& data) -> bool {
+    std::size_t sent = 0;
+    while (sent < data.size()) {
+        const auto result = send(socket, data.data() + sent, static_cast<int>(data.size() - sent), 0);
+        if (result <= 0) {
+            return false;
+        }
+        sent += static_cast<std::size_t>(result);
+    }
+    return true;
+}
+
+}  // namespace
+
+class SauronStubServer::SauronStubServerImpl {
+public:
+    explicit SauronStubServerImpl(SauronStubConfig config) : config_(std::move(config)), engine_(config_.seed) {}
+
+    SauronStubServerImpl(const SauronStubServerImpl&) = delete;
+    auto operator=(const SauronStubServerImpl&) -> SauronStubServerImpl& = delete;
+    SauronStubServerImpl(SauronStubServerImpl&&) = delete;
+    auto operator=(SauronStubServerImpl&&) -> SauronStubServerImpl& = delete;
+
+    ~SauronStubServerImpl() { stop(); }
+
+    auto start() -> uint16_t {
+#ifdef _WIN32
+        WSADATA wsaData;
+        if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+            throw std::runtime_error("WSAStartup failed");
+        }
+#endif
+        listenSocket_ = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (listenSocket_ == INVALID_SOCKET_HANDLE) {
+            throw std::runtime_error("Failed to create listen socket");
+        }
+        int reuse = 1;
+        setsockopt(listenSocket_, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(config_.port);
+        if (bind(listenSocket_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+            listen(listenSocket_, LISTEN_BACKLOG) != 0) {
+            closeSocket(listenSocket_);
+            listenSocket_ = INVALID_SOCKET_HANDLE;
+            throw std::runtime_error("Failed to listen on port " + std::to_string(config_.port));
+        }
+
+        socklen_t length = sizeof(address);
+        getsockname(listenSocket_, reinterpret_cast<sockaddr*>(&address), &length);
+        running_ = true;
+        acceptThread_ = std::thread([this] { acceptLoop(); });
+        return ntohs(address.sin_port);
+    }
+
+    auto stop() -> void {
+        if (!running_.exchange(false)) {
+            return;
+        }
+        shutdownSocket(listenSocket_);
+        closeSocket(listenSocket_);
+        if (acceptThread_.joinable()) {
+            acceptThread_.join();
+        }
+        std::vector<std::thread> connections;
+        {
+            std::scoped_lock lock(connectionsMutex_);
+            for (auto socket : openSockets_) {
+                shutdownSocket(socket);
+            }
+            connections.swap(finishedThreads_);
+            for (auto& [id, connection] : connectionThreads_) {
+                connections.push_back(std::move(connection));
+            }
+            connectionThreads_.clear();
+        }
+        for (auto& connection : connections) {
+            connection.join();
+        }
+#ifdef _WIN32
+        WSACleanup();
+#endif
+    }
+
+    [[nodiscard]] auto getStats() const -> SauronStubStats {
+        return SauronStubStats{logins_.load(), queries_.load(), bytesReceived_.load(), bytesSent_.load()};
+    }
+
+private:
+    auto acceptLoop() -> void {
+        auto backoff = std::chrono::milliseconds(0);
+        while (running_) {
+            const auto client = accept(listenSocket_, nullptr, nullptr);
+            if (client == INVALID_SOCKET_HANDLE) {
+                // Such as running out of descriptors, retrying at once would only spin
+                backoff = std::min(std::max(backoff * 2, std::chrono::milliseconds(1)), MAX_ACCEPT_BACKOFF);
+                std::this_thread::sleep_for(backoff);
+                continue;
+            }
+            backoff = std::chrono::milliseconds(0);
+            reapFinishedConnections();
+            int noDelay = 1;
+            setsockopt(client, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&noDelay), sizeof(noDelay));
+            std::scoped_lock lock(connectionsMutex_);
+            if (!running_) {
+                closeSocket(client);
+                break;
+            }
+            openSockets_.push_back(client);
+            const auto id = nextConnectionId_++;
+            connectionThreads_.emplace(id, std::thread([this, client, id] { serveConnection(client, id); }));
+        }
+    }
+
+    // Joins the threads of closed connections, they are done or about to return
+    auto reapFinishedConnections() -> void {
+        std::vector<std::thread> finished;
+        {
+            std::scoped_lock lock(connectionsMutex_);
+            finished.swap(finishedThreads_);
+        }
+        for (auto& connection : finished) {
+            connection.join();
+        }
+    }
+
+    auto serveConnection(SocketHandle client, uint64_t id) -> void {
+        std::string buffer;
+        HttpRequest request;
+        while (running_ && readRequest(client, buffer, request)) {
+            const auto response = handle(request);
+            if (!sendAll(client, response)) {
+                break;
+            }
+            bytesSent_ += response.size();
+            if (!request.keepAlive) {
+                break;
+            }
+        }
+        {
+            std::scoped_lock lock(connectionsMutex_);
+            std::erase(openSockets_, client);
+            // Absent once stop() took over the threads
+            if (auto connection = connectionThreads_.extract(id)) {
+                finishedThreads_.push_back(std::move(connection.mapped()));
+            }
+        }
+        closeSocket(client);
+    }
+
+    // Read one request, leftover bytes of a pipelined request stay in the buffer
+    auto readRequest(SocketHandle client, std::string& buffer, HttpRequest& request) -> bool {
+        std::size_t headerEnd = std::string::npos;
+        while ((headerEnd = buffer.find("\r\n\r\n")) == std::string::npos) {
+            if (!receiveMore(client, buffer)) {
+                return false;
+            }
+        }
+
+        const auto headers = buffer.substr(0, headerEnd);
+        const auto requestLineEnd = headers.find("\r\n");
+        const auto requestLine = headers.substr(0, requestLineEnd);
+        const auto firstSpace = requestLine.find(' ');
+        const auto secondSpace = requestLine.find(' ', firstSpace + 1);
+        request.method = requestLine.substr(0, firstSpace);
+        request.path = requestLine.substr(firstSpace + 1, secondSpace - firstSpace - 1);
+        request.keepAlive = requestLine.find("HTTP/1.0") == std::string::npos;
+
+        std::size_t contentLength = 0;
+        const auto lowerHeaders = toLower(headers);
+        if (const auto position = lowerHeaders.find("\r\ncontent-length:"); position != std::string::npos) {
+            constexpr std::string_view header = "\r\ncontent-length:";
+            const auto valueStart = position + header.size();
+            const auto parsed = parseContentLength(
+                std::string_view(lowerHeaders).substr(valueStart, lowerHeaders.find("\r\n", valueStart) - valueStart));
+            if (!parsed) {
+                // Malformed request, drop the connection rather than let the exception end the process
+                return false;
+            }
+            contentLength = *parsed;
+        }
+        if (lowerHeaders.find("\r\nconnection: close") != std::string::npos) {
+            request.keepAlive = false;
+        }
+
+        const auto bodyStart = headerEnd + 4;
+        while (buffer.size() < bodyStart + contentLength) {
+            if (!receiveMore(client, buffer)) {
+                return false;
+            }
+        }
+        request.body = buffer.substr(bodyStart, contentLength);
+        buffer.erase(0, bodyStart + contentLength);
+        return true;
+    }
+
+    auto receiveMore(SocketHandle client, std::string& buffer) -> bool {
+        char chunk[RECEIVE_CHUNK_SIZE];
+        const auto received = recv(client, chunk, static_cast<int>(sizeof(chunk)), 0);
+        if (received <= 0) {
+            return false;
+        }
+        bytesReceived_ += static_cast<uint64_t>(received);
+        buffer.append(chunk, static_cast<std::size_t>(received));
+        return true;
+    }
+
+    auto handle(const HttpRequest& request) -> std::string {
+        if (request.path.find("login") != std::string::npos) {
+            ++logins_;
+            return makeResponse(nlohmann::json{{"token", "stub-token"}, {"access_token", "stub-token"}}.dump());
+        }
+
+        ++queries_;
+        double latencyMs = 0.0;
+        double responseBytes = 0.0;
+        {
+            std::scoped_lock lock(engineMutex_);
+            latencyMs = config_.latencyMs.sample(engine_);
+            responseBytes = config_.responseBytes.sample(engine_);
+        }
+        std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(latencyMs));
+
+        nlohmann::json body = {
+            {"explanation", "Generated by the Sauron stub server"},
+            {"response", std::string(static_cast<std::size_t>(responseBytes), 'x')},
+            {"complexity",
+             {{"time", {{"value", "O(n)"}, {"explanation", "stub"}}},
+              {"space", {{"value", "O(1)"}, {"explanation", "stub"}}}}}};
+        return makeResponse(body.dump());
+    }
+
+    static auto makeResponse(const std::string& body) -> std::string {
+        return "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: " + std::to_string(body.size()) +
+               "\r\nConnection: keep-alive\r\n\r\n" + body;
+    }
+
+    SauronStubConfig config_;
+    std::mutex engineMutex_;
+    std::mt19937_64 engine_;
+
+    std::atomic<bool> running_{false};
+    SocketHandle listenSocket_{INVALID_SOCKET_HANDLE};
+    std::thread acceptThread_;
+    std::mutex connectionsMutex_;
+    std::vector<SocketHandle> openSockets_;
+    std::map<uint64_t, std::thread> connectionThreads_;
+    std::vector<std::thread> finishedThreads_;
+    uint64_t nextConnectionId_{0};
+
+    std::atomic<uint64_t> logins_{0};
+    std::atomic<uint64_t> queries_{0};
+    std::atomic<uint64_t> bytesReceived_{0};
+    std::atomic<uint64_t> bytesSent_{0};
+};
+
+SauronStubServer::SauronStubServer(SauronStubConfig config)
+    : pimpl_(std::make_unique<SauronStubServerImpl>(std::move(config))) {}
+
+SauronStubServer::~SauronStubServer() = default;
+
+auto SauronStubServer::start() -> uint16_t { return pimpl_->start(); }
+
+auto SauronStubServer::stop() -> void { pimpl_->stop(); }
+
+auto SauronStubServer::getStats() const -> SauronStubStats { return pimpl_->getStats(); }
+
+}  // namespace palantir::benchmark
@@ -0,0 +1,146 @@
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/allocation_counter.hpp"
+#include "benchmark/latency_summary.hpp"
+#include "benchmark/options.hpp"
+#include "window/component/content_manager_impl.hpp"
+#include "window/component/webview/headless_view.hpp"
+
+namespace {
+
+using namespace palantir;
+using namespace palantir::benchmark;
+using window::component::ContentManager;
+using window::component::webview::HeadlessView;
+using window::component::webview::HeadlessViewCosts;
+
+using Clock = std::chrono::steady_clock;
+
+auto printUsage() -> void {
+    std::cout << "Usage: content_pipeline_benchmark [--iterations=2000] [--response-bytes=16384]\n"
+                 "                                  [--post-cost-us=0] [--kb-cost-us=0] [--resize-cost-us=0]\n"
+                 "Drives ContentManager over a headless view: root content, streamed updates, resize storms and\n"
+                 "view messages, with optional artificial view costs.\n";
+}
+
+using Pipeline = ContentManager<HeadlessView>;
+
+struct Scenario {
+    std::string name;
+    // Runs one iteration against the pipeline
+    std::function<void(Pipeline& contentManager, HeadlessView& view, long long iteration)> step;
+};
+
+auto makeResponse(std::size_t bytes, long long iteration) -> std::string {
+    std::string text = "Iteration " + std::to_string(iteration) + ": ";
+    while (text.size() < bytes) {
+        text.append("keep a running sum of the window, each step is O(1). ");
+    }
+    return text;
+}
+
+/**
+ * Run a scenario on a fresh pipeline and print its per-iteration latency, what reached the view
+ * and the allocations made on the way.
+ */
+auto run(const Scenario& scenario, long long iterations, const HeadlessViewCosts& costs) -> void {
+    auto view = std::make_shared<HeadlessView>();
+    auto contentManager = std::make_shared<Pipeline>(view);
+    contentManager->initialize(0);
+    contentManager->setRootContent(R"({"explanation": "", "response": ""})");
+    contentManager->flush();
+    view->setRecording(false);
+    view->setCosts(costs);
+    view->clear();
+
+    std::vector<double> samples;
+    samples.reserve(static_cast<std::size_t>(iterations));
+    const auto allocationsBefore = allocationCounters();
+    const auto start = Clock::now();
+    for (long long iteration = 0; iteration < iterations; ++iteration) {
+        const auto stepStart = Clock::now();
+        scenario.step(*contentManager, *view, iteration);
+        // One frame tick per iteration, as the message loop would
+        contentManager->onFrame();
+        samples.push_back(std::chrono::duration<double, std::micro>(Clock::now() - stepStart).count());
+    }
+    contentManager->flush();
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    const auto allocationsAfter = allocationCounters();
+
+    const auto viewStats = view->getStats();
+    const auto updateStats = contentManager->getUpdateStats();
+    const auto resizeStats = contentManager->getResizeStats();
+    std::cout << "== " << scenario.name << " ==\n"
+              << "throughput: " << static_cast<double>(iterations) / elapsed << " iterations/s\n";
+    LatencySummary::fromSamples(std::move(samples)).print(std::cout, "iteration");
+    std::cout << "view: posts=" << viewStats.posts << " bytes=" << viewStats.postedBytes
+              << " resizes=" << viewStats.resizes << " handled=" << viewStats.handledMessages << "\n"
+              << "content: updates=" << updateStats.updates << " messages=" << updateStats.messages
+              << " coalesced=" << updateStats.coalesced << "\n"
+              << "resize: requests=" << resizeStats.requests << " applied=" << resizeStats.applied
+              << " skipped=" << resizeStats.skipped << " coalesced=" << resizeStats.coalesced << "\n"
+              << "allocations per iteration: "
+              << static_cast<double>(allocationsAfter.allocations - allocationsBefore.allocations) /
+                     static_cast<double>(iterations)
+              << "\n\n";
+}
+
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+    const Options options(argc, argv);
+    if (options.has("help")) {
+        printUsage();
+        return 0;
+    }
+
+    try {
+        const auto iterations = options.getInt("iterations", 2000);
+        const auto responseBytes = static_cast<std::size_t>(options.getInt("response-bytes", 16384));
+        HeadlessViewCosts costs;
+        costs.post = std::chrono::microseconds(options.getInt("post-cost-us", 0));
+        costs.perKilobyte = std::chrono::microseconds(options.getInt("kb-cost-us", 0));
+        costs.resize = std::chrono::microseconds(options.getInt("resize-cost-us", 0));
+
+        const std::vector<Scenario> scenarios = {
+            {"setRootContent",
+             [responseBytes](Pipeline& contentManager, HeadlessView&, long long iteration) {
+                 contentManager.setRootContentJson(nlohmann::json{
+                     {"explanation", "Sliding window"}, {"response", makeResponse(responseBytes, iteration)}});
+             }},
+            {"setContent streaming",
+             [](Pipeline& contentManager, HeadlessView&, long long iteration) {
+                 // A streamed response grows by a token per update
+                 contentManager.setContent("response", makeResponse(static_cast<std::size_t>(iteration % 512) * 32, 0));
+             }},
+            {"resize storm",
+             [](Pipeline&, HeadlessView& view, long long iteration) {
+                 // Streaming text makes the height jitter by a few pixels around a slow growth
+                 const int height = 400 + static_cast<int>(iteration / 8) + static_cast<int>(iteration % 5);
+                 view.handleMessage(R"({"type":"contentSize","event":{"width":640,"height":)" +
+                                    std::to_string(height) + "}}");
+             }},
+            {"message handling",
+             [](Pipeline&, HeadlessView& view, long long iteration) {
+                 view.handleMessage(iteration % 2 == 0 ? R"({"type":"log","event":{"level":"info","message":"tick"}})"
+                                                       : R"({"type":"contentReady","event":{"reason":"load"}})");
+             }},
+        };
+
+        for (const auto& scenario : scenarios) {
+            run(scenario, iterations, costs);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
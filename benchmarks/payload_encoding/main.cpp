@@ -0,0 +1,158 @@
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#include "benchmark/options.hpp"
+#include "utils/json_utils.hpp"
+#include "utils/payload_codec.hpp"
+#include "utils/string_utils.hpp"
+
+namespace {
+
+using namespace palantir;
+using namespace palantir::benchmark;
+
+// Keeps the serializations from being optimized away
+volatile std::size_t serializationSink = 0;
+
+struct Payload {
+    std::string name;
+    // The message as sent in JSON mode
+    nlohmann::json text;
+    // The same message for the binary encodings, may hold raw binary values
+    nlohmann::json binary;
+};
+
+struct Measure {
+    std::size_t bytes;
+    double encodeMicros;
+    double decodeMicros;
+};
+
+auto printUsage() -> void {
+    std::cout << "Usage: payload_encoding_benchmark [--scale=1] [--iterations=200]\n"
+                 "Compares the size and cost of content messages sent as JSON or as MessagePack/CBOR envelopes.\n";
+}
+
+auto repeat(const std::string& sample, std::size_t times) -> std::string {
+    std::string result;
+    result.reserve(sample.size() * times);
+    for (std::size_t index = 0; index < times; ++index) {
+        result.append(sample);
+    }
+    return result;
+}
+
+auto makeResponse(std::size_t paragraphs) -> nlohmann::json {
+    const std::string paragraph =
+        "The sliding window keeps the sum of the last k values, so each step is O(1).\n"
+        "```cpp\nfor (int i = k; i < n; ++i) { sum += values[i] - values[i - k]; best = std::max(best, sum); }\n```\n";
+    return {{"type", "setContent"},
+            {"content",
+             {{"explanation", repeat("Keep a running sum instead of recomputing the window. ", paragraphs)},
+              {"response", repeat(paragraph, paragraphs)},
+              {"complexity",
+               {{"time", {{"value", "O(n)"}, {"explanation", "Each element enters and leaves the window once."}}},
+                {"space", {{"value", "O(1)"}, {"explanation", "Only the running sum is stored."}}}}}}}};
+}
+
+auto makeStructured(std::size_t entries) -> nlohmann::json {
+    nlohmann::json operations = nlohmann::json::array();
+    for (std::size_t index = 0; index < entries; ++index) {
+        operations.push_back({{"op", "add"},
+                              {"path", "/steps/" + std::to_string(index)},
+                              {"value", {{"line", index * 3}, {"cost", 0.125 * index}, {"done", index % 2 == 0}}}});
+    }
+    return {{"type", "patch"}, {"ops", std::move(operations)}};
+}
+
+auto makeImagePreview(std::size_t bytes) -> Payload {
+    std::vector<uint8_t> pixels(bytes);
+    uint32_t state = 0x12345678;
+    for (auto& pixel : pixels) {
+        state = state * 1664525 + 1013904223;
+        pixel = static_cast<uint8_t>(state >> 24);
+    }
+    nlohmann::json text = {{"type", "preview"}, {"width", 256}, {"png", utils::StringUtils::base64_encode(pixels)}};
+    nlohmann::json binary = {{"type", "preview"}, {"width", 256}, {"png", nlohmann::json::binary(pixels)}};
+    return {"image", std::move(text), std::move(binary)};
+}
+
+// Run the operation and return the mean time per call in microseconds
+auto timeMicros(long long iterations, const std::function<std::size_t()>& operation) -> double {
+    std::size_t sink = operation();
+    const auto start = std::chrono::steady_clock::now();
+    for (long long iteration = 0; iteration < iterations; ++iteration) {
+        sink += operation();
+    }
+    const auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    serializationSink = sink;
+    return elapsed / static_cast<double>(iterations);
+}
+
+// Encode into the text actually posted to the view, then decode it back as MessageHandler would
+auto measure(const nlohmann::json& message, utils::PayloadEncoding encoding, long long iterations) -> Measure {
+    std::string posted;
+    std::vector<uint8_t> scratch;
+    const auto encodeMicros = timeMicros(iterations, [&] {
+        posted.clear();
+        utils::PayloadCodec::appendMessage(posted, message, encoding, scratch);
+        return posted.size();
+    });
+    const auto decodeMicros = timeMicros(iterations, [&] {
+        auto parsed = nlohmann::json::parse(posted);
+        if (encoding != utils::PayloadEncoding::JSON) {
+            parsed = utils::PayloadCodec::unwrapMessage(parsed);
+        }
+        return parsed.size();
+    });
+    return {posted.size(), encodeMicros, decodeMicros};
+}
+
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+    const Options options(argc, argv);
+    if (options.has("help")) {
+        printUsage();
+        return 0;
+    }
+
+    try {
+        const auto scale = static_cast<std::size_t>(options.getInt("scale", 1));
+        const auto iterations = options.getInt("iterations", 200);
+        std::vector<Payload> payloads;
+        for (const auto& [name, message] : {std::pair{"short", makeResponse(2 * scale)},
+                                            std::pair{"long", makeResponse(200 * scale)},
+                                            std::pair{"patch", makeStructured(500 * scale)}}) {
+            payloads.push_back({name, message, message});
+        }
+        payloads.push_back(makeImagePreview(64 * 1024 * scale));
+
+        std::cout << "payload  encoding  posted bytes  raw bytes  encode us  decode us\n" << std::fixed
+                  << std::setprecision(1);
+        for (const auto& payload : payloads) {
+            for (const auto encoding :
+                 {utils::PayloadEncoding::JSON, utils::PayloadEncoding::MSGPACK, utils::PayloadEncoding::CBOR}) {
+                const auto& message = encoding == utils::PayloadEncoding::JSON ? payload.text : payload.binary;
+                std::vector<uint8_t> raw;
+                utils::PayloadCodec::encode(message, encoding, raw);
+                const auto result = measure(message, encoding, iterations);
+                const auto encodingName = utils::PayloadCodec::getName(encoding);
+                std::cout << payload.name << std::string(9 - payload.name.size(), ' ') << encodingName
+                          << std::string(10 - encodingName.size(), ' ') << result.bytes << "  " << raw.size() << "  "
+                          << result.encodeMicros << "  " << result.decodeMicros << "\n";
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
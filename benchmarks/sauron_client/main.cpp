@@ -0,0 +1,160 @@
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/allocation_counter.hpp"
+#include "benchmark/distribution.hpp"
+#include "benchmark/latency_summary.hpp"
+#include "benchmark/options.hpp"
+#include "benchmark/sauron_stub_server.hpp"
+#include "client/ai_request_strategy.hpp"
+#include "client/sauron_register.hpp"
+#include "utils/json_utils.hpp"
+
+namespace {
+
+using namespace palantir;
+using namespace palantir::benchmark;
+
+struct WorkerResult {
+    std::vector<double> latenciesUs;
+    uint64_t failures{0};
+    uint64_t payloadBytes{0};
+    uint64_t allocations{0};
+    uint64_t allocatedBytes{0};
+};
+
+auto printUsage() -> void {
+    std::cout
+        << "Usage: sauron_client_benchmark [--url=host:port] [--concurrency=8] [--requests=400] [--warmup=16]\n"
+           "                               [--prompt-bytes=2048] [--images=1] [--image-bytes=65536]\n"
+           "                               [--latency-ms=lognormal:50,0.5] [--response-bytes=uniform:2048,16384]\n"
+           "Without --url an in-process Sauron stub is started with the given distributions.\n";
+}
+
+// Same work as SendSauronRequestCommand::execute up to the point the response is handed to the UI
+auto sendRequest(const std::string& prompt, const std::vector<std::string>& images) -> std::size_t {
+    auto sauronClient = client::SauronRegister::getInstance()->getSauronClient();
+    auto response = client::AIRequestStrategy::getInstance()->execute(sauronClient, prompt, images);
+    // The content manager serializes the moved json once into the view message buffer
+    std::string message;
+    utils::JsonUtils::appendJson(message, response.toJson());
+    return message.size();
+}
+
+auto runWorker(std::atomic<long long>& remaining, const std::string& prompt, const std::vector<std::string>& images)
+    -> WorkerResult {
+    WorkerResult result;
+    while (remaining.fetch_sub(1) > 0) {
+        const auto allocationsBefore = threadAllocationCounters();
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            result.payloadBytes += sendRequest(prompt, images);
+            result.latenciesUs.push_back(
+                std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+        } catch (const std::exception&) {
+            ++result.failures;
+        }
+        const auto allocationsAfter = threadAllocationCounters();
+        result.allocations += allocationsAfter.allocations - allocationsBefore.allocations;
+        result.allocatedBytes += allocationsAfter.bytes - allocationsBefore.bytes;
+    }
+    return result;
+}
+
+auto runPhase(long long requests, int concurrency, const std::string& prompt, const std::vector<std::string>& images)
+    -> WorkerResult {
+    std::atomic<long long> remaining{requests};
+    std::vector<WorkerResult> results(static_cast<std::size_t>(concurrency));
+    {
+        std::vector<std::jthread> workers;
+        for (int index = 0; index < concurrency; ++index) {
+            workers.emplace_back([&, index] {
+                results[static_cast<std::size_t>(index)] = runWorker(remaining, prompt, images);
+            });
+        }
+    }
+    WorkerResult total;
+    for (auto& result : results) {
+        total.latenciesUs.insert(total.latenciesUs.end(), result.latenciesUs.begin(), result.latenciesUs.end());
+        total.failures += result.failures;
+        total.payloadBytes += result.payloadBytes;
+        total.allocations += result.allocations;
+        total.allocatedBytes += result.allocatedBytes;
+    }
+    return total;
+}
+
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+    const Options options(argc, argv);
+    if (options.has("help")) {
+        printUsage();
+        return 0;
+    }
+
+    try {
+        const auto concurrency = static_cast<int>(options.getInt("concurrency", 8));
+        const auto requests = options.getInt("requests", 400);
+        const auto warmup = options.getInt("warmup", 16);
+        const std::string prompt(static_cast<std::size_t>(options.getInt("prompt-bytes", 2048)), 'p');
+        const auto imageBytes = static_cast<std::size_t>(options.getInt("image-bytes", 65536));
+        const std::vector<std::string> images(static_cast<std::size_t>(options.getInt("images", 1)),
+                                              "data:image/png;base64," + std::string(imageBytes, 'A'));
+
+        std::optional<SauronStubServer> stub;
+        std::string url = options.get("url", "");
+        if (url.empty()) {
+            SauronStubConfig config;
+            config.latencyMs = Distribution::parse(options.get("latency-ms", "lognormal:50,0.5"));
+            config.responseBytes = Distribution::parse(options.get("response-bytes", config.responseBytes.toString()));
+            stub.emplace(config);
+            url = "127.0.0.1:" + std::to_string(stub->start());
+            std::cout << "In-process Sauron stub on " << url << " latency-ms=" << config.latencyMs.toString()
+                      << " response-bytes=" << config.responseBytes.toString() << "\n";
+        }
+
+        client::SauronRegister::setInstance(client::SauronRegister::createForServer(url));
+
+        runPhase(warmup, concurrency, prompt, images);
+        const auto wireBefore = stub ? stub->getStats() : SauronStubStats{};
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto result = runPhase(requests, concurrency, prompt, images);
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        const auto completed = static_cast<double>(result.latenciesUs.size());
+        const auto attempted = static_cast<double>(requests > 0 ? requests : 1);
+        std::cout << "requests=" << requests << " concurrency=" << concurrency << " failures=" << result.failures
+                  << " elapsed=" << elapsed << "s throughput=" << completed / elapsed << " req/s\n";
+        LatencySummary::fromSamples(result.latenciesUs).print(std::cout, "latency");
+        std::cout << "rendered payload bytes/request=" << static_cast<double>(result.payloadBytes) / attempted << "\n";
+        std::cout << "allocations/request=" << static_cast<double>(result.allocations) / attempted
+                  << " allocated bytes/request=" << static_cast<double>(result.allocatedBytes) / attempted
+                  << " (operator new only, libcurl malloc is not counted"
+#ifdef _WIN32
+                  << ", nor the palantir-core DLL"
+#endif
+                  << ")\n";
+        if (stub) {
+            const auto wireAfter = stub->getStats();
+            std::cout << "wire bytes/request: sent="
+                      << static_cast<double>(wireAfter.bytesReceived - wireBefore.bytesReceived) / attempted
+                      << " received=" << static_cast<double>(wireAfter.bytesSent - wireBefore.bytesSent) / attempted
+                      << "\n";
+        }
+
+        client::SauronRegister::setInstance(nullptr);
+        client::AIRequestStrategy::setInstance(nullptr);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
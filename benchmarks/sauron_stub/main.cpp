@@ -0,0 +1,57 @@
+#include <chrono>
+#include <csignal>
+#include <exception>
+#include <iostream>
+#include <thread>
+
+#include "benchmark/options.hpp"
+#include "benchmark/sauron_stub_server.hpp"
+
+namespace {
+volatile std::sig_atomic_t stopRequested = 0;
+
+auto onSignal(int /*signal*/) -> void { stopRequested = 1; }
+
+auto printUsage() -> void {
+    std::cout << "Usage: sauron-stub-server [--port=3000] [--latency-ms=lognormal:200,0.5]\n"
+                 "                          [--response-bytes=uniform:2048,16384] [--seed=42]\n"
+                 "Distributions: constant:<v> | uniform:<min>,<max> | lognormal:<median>,<sigma>\n";
+}
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+    using namespace palantir::benchmark;
+    const Options options(argc, argv);
+    if (options.has("help")) {
+        printUsage();
+        return 0;
+    }
+
+    try {
+        SauronStubConfig config;
+        config.port = static_cast<uint16_t>(options.getInt("port", 3000));
+        config.latencyMs = Distribution::parse(options.get("latency-ms", config.latencyMs.toString()));
+        config.responseBytes = Distribution::parse(options.get("response-bytes", config.responseBytes.toString()));
+        config.seed = static_cast<uint64_t>(options.getInt("seed", static_cast<long long>(config.seed)));
+
+        SauronStubServer server(config);
+        const auto port = server.start();
+        std::cout << "Sauron stub listening on 127.0.0.1:" << port << " latency-ms=" << config.latencyMs.toString()
+                  << " response-bytes=" << config.responseBytes.toString() << std::endl;
+
+        std::signal(SIGINT, onSignal);
+        std::signal(SIGTERM, onSignal);
+        while (stopRequested == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        server.stop();
+
+        const auto stats = server.getStats();
+        std::cout << "logins=" << stats.logins << " queries=" << stats.queries << " received=" << stats.bytesReceived
+                  << "B sent=" << stats.bytesSent << "B" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
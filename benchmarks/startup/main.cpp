@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "benchmark/latency_summary.hpp"
+#include "benchmark/options.hpp"
+#include "command/command_factory.hpp"
+#include "command/icommand.hpp"
+#include "config/config.hpp"
+#include "exception/traceable_exception.hpp"
+#include "input/key_config.hpp"
+#include "input/key_register.hpp"
+#include "input/keyboard_input_factory.hpp"
+#include "plugin_loader/plugin_manager.hpp"
+#include "signal/keyboard_signal_factory.hpp"
+#include "utils/startup_profiler.hpp"
+
+namespace {
+
+using namespace palantir;
+using namespace palantir::benchmark;
+using utils::ScopedSpan;
+using utils::StartupProfiler;
+
+auto printUsage() -> void {
+    std::cout << "Usage: startup_benchmark [--iterations=20] [--commands=64] [--plugins=<directory>]\n"
+                 "                         [--trace=<file.json>]\n"
+                 "Runs the headless parts of startup: shortcut configuration parsing, KeyRegister population,\n"
+                 "plugin loading and signal creation. The first iteration is reported as cold, the others as warm.\n";
+}
+
+// KeyRegister with a public constructor, so every iteration populates a fresh one
+class BenchmarkKeyRegister : public input::KeyRegister {
+public:
+    BenchmarkKeyRegister() = default;
+};
+
+class BenchmarkConfig : public config::Config {
+public:
+    explicit BenchmarkConfig(std::filesystem::path path) : path_(std::move(path)) {}
+
+    [[nodiscard]] auto getConfigurationFormat() const -> std::string override { return "ini"; }
+    [[nodiscard]] auto getConfigPath() const -> std::filesystem::path override { return path_; }
+
+private:
+    std::filesystem::path path_;
+};
+
+class NoopCommand : public command::ICommand {
+public:
+    auto execute() const -> void override {}
+    [[nodiscard]] auto useDebounce() const -> bool override { return false; }
+};
+
+// Same key names as the platform key codes, with made up values
+auto populateKeys(input::KeyRegister& keyRegister) -> void {
+    int code = 0;
+    for (char key = 'A'; key <= 'Z'; ++key) {
+        keyRegister.registerKey(std::string(1, key), ++code);
+    }
+    for (int digit = 0; digit <= 9; ++digit) {
+        keyRegister.registerKey(std::to_string(digit), ++code);
+        keyRegister.registerKey("Num " + std::to_string(digit), ++code);
+    }
+    for (int function = 1; function <= 24; ++function) {
+        keyRegister.registerKey("F" + std::to_string(function), ++code);
+    }
+    for (const char* key : {"/", "Space", "Enter", "Escape", "Tab", "Backspace", "Delete", "Insert", "Home", "End",
+                            "Page Up", "Page Down", "Left", "Right", "Up", "Down"}) {
+        keyRegister.registerKey(key, ++code);
+    }
+    for (const char* modifier : {"Ctrl", "Alt", "Shift", "Win", "Cmd"}) {
+        keyRegister.registerKey(modifier, ++code);
+    }
+}
+
+auto commandName(long long index) -> std::string { return "benchmark-command-" + std::to_string(index); }
+
+// A shortcuts file binding every benchmark command, in the format KeyConfig reads
+auto writeShortcuts(const std::filesystem::path& path, long long commands) -> void {
+    static const std::vector<std::string> modifiers = {"Ctrl", "Alt", "Shift"};
+    std::ofstream file(path);
+    file << "; Generated by startup_benchmark\n[commands]\n";
+    for (long long index = 0; index < commands; ++index) {
+        const auto key = std::string(1, static_cast<char>('A' + index % 26));
+        file << commandName(index) << " = " << modifiers[static_cast<std::size_t>(index / 26) % modifiers.size()]
+             << "+" << key << "    ; Benchmark command\n";
+    }
+    if (!file) {
+        throw std::runtime_error("Failed to write " + path.string());
+    }
+}
+
+// Plugins copied without their manifests, so the first iteration starts as after an install
+auto copyPlugins(const std::filesystem::path& from, const std::filesystem::path& to) -> void {
+    std::filesystem::create_directories(to);
+    for (const auto& entry : std::filesystem::directory_iterator(from)) {
+        if (entry.is_regular_file() && entry.path().extension() != ".json") {
+            std::filesystem::copy_file(entry.path(), to / entry.path().filename(),
+                                       std::filesystem::copy_options::overwrite_existing);
+        }
+    }
+}
+
+struct Phase {
+    std::string name;
+    std::function<void()> run;
+};
+
+// Total duration of each span of the last iteration, in microseconds
+auto collectPhases() -> std::map<std::string, double> {
+    std::map<std::string, double> durations;
+    for (const auto& span : StartupProfiler::getInstance()->getSpans()) {
+        durations[span.name] += std::chrono::duration<double, std::micro>(span.getDuration()).count();
+    }
+    return durations;
+}
+
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+    const Options options(argc, argv);
+    if (options.has("help")) {
+        printUsage();
+        return 0;
+    }
+
+    const auto workDirectory = std::filesystem::temp_directory_path() / "palantir-startup-benchmark";
+    try {
+        const auto iterations = std::max(2LL, options.getInt("iterations", 20));
+        const auto commands = options.getInt("commands", 64);
+        const auto pluginsSource = options.get("plugins", "");
+        const auto tracePath = options.get("trace", "");
+
+        std::filesystem::remove_all(workDirectory);
+        std::filesystem::create_directories(workDirectory);
+        const auto shortcutsPath = workDirectory / "shortcuts.ini";
+        const auto pluginsDirectory = workDirectory / "plugins";
+        writeShortcuts(shortcutsPath, commands);
+        if (!pluginsSource.empty()) {
+            copyPlugins(pluginsSource, pluginsDirectory);
+        }
+
+        // Commands bound in the generated shortcuts, signals cannot be created for unknown commands
+        for (long long index = 0; index < commands; ++index) {
+            command::CommandFactory::getInstance()->registerCommand(
+                commandName(index), []() { return std::make_unique<NoopCommand>(); });
+        }
+
+        auto config = std::make_shared<BenchmarkConfig>(workDirectory);
+        std::unique_ptr<plugin::PluginManager> pluginManager;
+        std::vector<Phase> phases = {
+            {"config", [&shortcutsPath]() { input::KeyConfig keyConfig(shortcutsPath); }},
+            {"keys",
+             []() {
+                 auto keyRegister = std::make_shared<BenchmarkKeyRegister>();
+                 populateKeys(*keyRegister);
+                 input::KeyRegister::setInstance(keyRegister);
+             }},
+            {"signals",
+             [&config]() {
+                 signal::KeyboardSignalFactory factory(std::make_shared<input::KeyboardInputFactory>(config));
+                 auto signals = factory.createSignals();
+             }},
+        };
+        if (!pluginsSource.empty()) {
+            phases.insert(phases.begin() + 2, Phase{"plugins", [&pluginManager, &pluginsDirectory]() {
+                                                        pluginManager = std::make_unique<plugin::PluginManager>();
+                                                        pluginManager->setupFromDirectory(pluginsDirectory);
+                                                    }});
+        }
+
+        const auto profiler = StartupProfiler::getInstance();
+        profiler->setEnabled(true);
+        std::map<std::string, double> cold;
+        std::map<std::string, std::vector<double>> warm;
+        for (long long iteration = 0; iteration < iterations; ++iteration) {
+            profiler->clear();
+            for (const auto& phase : phases) {
+                ScopedSpan span(phase.name);
+                phase.run();
+            }
+            // Unloading is shutdown work, outside of the measured phases
+            if (pluginManager) {
+                pluginManager->shutdownAll();
+                pluginManager.reset();
+            }
+
+            if (iteration == 0) {
+                cold = collectPhases();
+                if (!tracePath.empty() && !profiler->writeChromeTrace(tracePath)) {
+                    std::cerr << "Failed to write " << tracePath << std::endl;
+                }
+                std::cout << "== cold timeline ==\n";
+                profiler->print(std::cout);
+                std::cout << "\n";
+                continue;
+            }
+            for (const auto& [name, duration] : collectPhases()) {
+                warm[name].push_back(duration);
+            }
+        }
+
+        std::cout << "== phases ==\n";
+        for (const auto& [name, duration] : cold) {
+            std::cout << name << " cold (us): " << duration << "\n";
+            if (warm[name].empty()) {
+                // Such as the load of a plugin deferred once its manifest exists
+                std::cout << name << " warm: not run\n";
+                continue;
+            }
+            LatencySummary::fromSamples(warm[name]).print(std::cout, name + " warm");
+        }
+    } catch (const palantir::exception::TraceableBaseException& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        std::filesystem::remove_all(workDirectory);
+        return 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        std::filesystem::remove_all(workDirectory);
+        return 1;
+    }
+    std::filesystem::remove_all(workDirectory);
+    return 0;
+}
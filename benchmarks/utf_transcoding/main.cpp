@@ -0,0 +1,105 @@
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark/options.hpp"
+#include "utils/string_utils.hpp"
+
+namespace {
+
+using namespace palantir;
+using namespace palantir::benchmark;
+
+// Keeps the conversions from being optimized away
+volatile std::size_t conversionSink = 0;
+
+struct Payload {
+    std::string name;
+    std::string utf8;
+};
+
+auto printUsage() -> void {
+    std::cout << "Usage: utf_transcoding_benchmark [--bytes=1048576] [--iterations=200]\n"
+                 "Compares StringUtils UTF-8/UTF-16 transcoding with the per-char widening it replaced.\n";
+}
+
+// Repeat a sample up to about the requested size
+auto makePayload(const std::string& name, const std::string& sample, std::size_t bytes) -> Payload {
+    Payload payload{name, {}};
+    payload.utf8.reserve(bytes + sample.size());
+    while (payload.utf8.size() < bytes) {
+        payload.utf8.append(sample);
+    }
+    return payload;
+}
+
+// The former view boundary conversion, wrong for anything but ASCII
+auto naiveWiden(const std::string& utf8) -> std::u16string { return {utf8.begin(), utf8.end()}; }
+
+auto naiveNarrow(const std::u16string& utf16) -> std::string {
+    std::string narrow;
+    narrow.reserve(utf16.size());
+    for (const auto unit : utf16) {
+        narrow.push_back(static_cast<char>(unit));
+    }
+    return narrow;
+}
+
+// Run the conversion and return the throughput over the input in MB/s
+auto measure(std::size_t inputBytes, long long iterations, const std::function<std::size_t()>& convert) -> double {
+    std::size_t sink = convert();
+    const auto start = std::chrono::steady_clock::now();
+    for (long long iteration = 0; iteration < iterations; ++iteration) {
+        sink += convert();
+    }
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    conversionSink = sink;
+    return static_cast<double>(inputBytes) * static_cast<double>(iterations) / elapsed / 1e6;
+}
+
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+    const Options options(argc, argv);
+    if (options.has("help")) {
+        printUsage();
+        return 0;
+    }
+
+    try {
+        const auto bytes = static_cast<std::size_t>(options.getInt("bytes", 1048576));
+        const auto iterations = options.getInt("iterations", 200);
+        const std::vector<Payload> payloads = {
+            makePayload("ascii", R"({"response":"for (int i = 0; i < n; ++i) { sum += values[i]; }"},)", bytes),
+            makePayload("latin", "Complexit\xC3\xA9 lin\xC3\xA9" "aire, tr\xC3\xA8s efficace. ", bytes),
+            makePayload("cjk", "\xE6\x97\xB6\xE9\x97\xB4\xE5\xA4\x8D\xE6\x9D\x82\xE5\xBA\xA6 O(n) ", bytes),
+            makePayload("emoji", "done \xF0\x9F\x9A\x80 fast \xF0\x9F\x98\x80 ", bytes),
+        };
+
+        std::cout << "payload  bytes     utf8->16 MB/s  naive MB/s  utf16->8 MB/s  naive MB/s  valid\n";
+        for (const auto& payload : payloads) {
+            const auto utf16 = utils::StringUtils::utf8ToUtf16(payload.utf8);
+            const auto toUtf16 = measure(payload.utf8.size(), iterations, [&payload] {
+                return utils::StringUtils::utf8ToUtf16(payload.utf8).size();
+            });
+            const auto naiveToUtf16 =
+                measure(payload.utf8.size(), iterations, [&payload] { return naiveWiden(payload.utf8).size(); });
+            const auto toUtf8 = measure(payload.utf8.size(), iterations,
+                                        [&utf16] { return utils::StringUtils::utf16ToUtf8(utf16).size(); });
+            const auto naiveToUtf8 =
+                measure(payload.utf8.size(), iterations, [&utf16] { return naiveNarrow(utf16).size(); });
+            const bool roundTrips = utils::StringUtils::utf16ToUtf8(utf16) == payload.utf8;
+
+            std::cout << payload.name << std::string(9 - payload.name.size(), ' ') << payload.utf8.size() << "  "
+                      << toUtf16 << "  " << naiveToUtf16 << "  " << toUtf8 << "  " << naiveToUtf8 << "  "
+                      << (utils::StringUtils::isValidUtf8(payload.utf8) && roundTrips ? "yes" : "no") << "\n";
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -7,25 +7,49 @@ set(COMMAND_PALANTIR_SOURCES
     ${PROJECT_ROOT}/palantir-core/src/command/command_factory.cpp
 )
 
+set(PLUGIN_PALANTIR_SOURCES
+    ${PROJECT_ROOT}/palantir-core/src/plugin/plugin_host.cpp
+)
+
 set(CLIENT_PALANTIR_SOURCES
     ${PROJECT_ROOT}/palantir-core/src/client/sauron_register.cpp
+    ${PROJECT_ROOT}/palantir-core/src/client/backend_latency_stats.cpp
+    ${PROJECT_ROOT}/palantir-core/src/client/ai_request_strategy.cpp
 )
 
 set(SIGNAL_PALANTIR_SOURCES
     ${PROJECT_ROOT}/palantir-core/src/signal/signal.cpp
     ${PROJECT_ROOT}/palantir-core/src/signal/keyboard_signal_factory.cpp
     ${PROJECT_ROOT}/palantir-core/src/signal/keyboard_signal_manager.cpp
+    ${PROJECT_ROOT}/palantir-core/src/signal/signal_table.cpp
 )
 
 set(UTILS_PALANTIR_SOURCES
     ${PROJECT_ROOT}/palantir-core/src/utils/resource_utils.cpp
+    ${PROJECT_ROOT}/palantir-core/src/utils/string_utils.cpp
+    ${PROJECT_ROOT}/palantir-core/src/utils/payload_codec.cpp
+    ${PROJECT_ROOT}/palantir-core/src/utils/thread_pool.cpp
+    ${PROJECT_ROOT}/palantir-core/src/utils/startup_profiler.cpp
+    ${PROJECT_ROOT}/palantir-core/src/utils/task_graph.cpp
+)
+
+set(EXCEPTION_PALANTIR_SOURCES
+    ${PROJECT_ROOT}/palantir-core/src/exception/stack_trace.cpp
+)
+
+set(LOGGING_PALANTIR_SOURCES
+    ${PROJECT_ROOT}/palantir-core/src/logging/logger.cpp
+    ${PROJECT_ROOT}/palantir-core/src/logging/log_sink.cpp
+    ${PROJECT_ROOT}/palantir-core/src/logging/file_log_sink.cpp
 )
 
 set(WINDOW_PALANTIR_SOURCES
     ${PROJECT_ROOT}/palantir-core/src/window/window_manager.cpp
-    ${PROJECT_ROOT}/palantir-core/src/window/component/message/message_handler.cpp  
+    ${PROJECT_ROOT}/palantir-core/src/window/component/message/message_handler.cpp
     ${PROJECT_ROOT}/palantir-core/src/window/component/message/logger/logger_strategy.cpp
     ${PROJECT_ROOT}/palantir-core/src/window/component/message/resize/resize_strategy.cpp
+    ${PROJECT_ROOT}/palantir-core/src/window/component/message/sync/content_sync_strategy.cpp
+    ${PROJECT_ROOT}/palantir-core/src/window/component/webview/headless_view.cpp
 )
 
 set(INPUT_PALANTIR_SOURCES
@@ -37,6 +61,7 @@ set(INPUT_PALANTIR_SOURCES
 
 set(APPLICATION_PALANTIR_SOURCES
     ${PROJECT_ROOT}/palantir-core/src/application.cpp
+    ${PROJECT_ROOT}/palantir-core/src/ui_dispatcher.cpp
 )
 
 # Debug/Release includes
@@ -51,6 +76,12 @@ else()
     )
 endif()
 
+# Lowest level the PALANTIR_LOG_* macros compile, empty for debug in Debug builds and info otherwise
+set(PALANTIR_LOG_ACTIVE_LEVEL "" CACHE STRING "Lowest compiled log level, 0 (trace) to 5 (off)")
+if(NOT PALANTIR_LOG_ACTIVE_LEVEL STREQUAL "")
+    add_definitions(-DPALANTIR_LOG_ACTIVE_LEVEL=${PALANTIR_LOG_ACTIVE_LEVEL})
+endif()
+
 # Common include directories for all platforms
 set(COMMON_PALANTIR_INCLUDE_DIRS 
     ${PROJECT_ROOT}/palantir-core/include
@@ -65,12 +96,15 @@ set(ALL_PALANTIR_INCLUDE_DIRS
 # Set ALL_PALANTIR_SOURCES variable for clang tools
 set(ALL_PALANTIR_SOURCES
     ${COMMAND_PALANTIR_SOURCES}
+    ${PLUGIN_PALANTIR_SOURCES}
     ${CLIENT_PALANTIR_SOURCES}
     ${SIGNAL_PALANTIR_SOURCES}
     ${WINDOW_PALANTIR_SOURCES}
     ${INPUT_PALANTIR_SOURCES}
     ${APPLICATION_PALANTIR_SOURCES}
     ${UTILS_PALANTIR_SOURCES}
+    ${LOGGING_PALANTIR_SOURCES}
+    ${EXCEPTION_PALANTIR_SOURCES}
 ) 
 
 set(ALL_SOURCES
@@ -0,0 +1,24 @@
+# Headless support only: no keyboard hook nor key state, enough for the benchmarks and tests
+set(LINUX_PALANTIR_SOURCES
+    ${PROJECT_ROOT}/palantir-core/src/platform/linux/input/keyboard_input.cpp
+    ${PROJECT_ROOT}/palantir-core/src/platform/linux/utils/logger.cpp
+)
+
+set(LINUX_PALANTIR_INCLUDES_DIRS
+    ${PROJECT_ROOT}/palantir-core/include/platform/linux
+)
+
+set(ALL_PALANTIR_INCLUDE_DIRS
+    ${ALL_PALANTIR_INCLUDE_DIRS}
+    ${LINUX_PALANTIR_INCLUDES_DIRS}
+)
+
+set(ALL_PALANTIR_SOURCES
+    ${ALL_PALANTIR_SOURCES}
+    ${LINUX_PALANTIR_SOURCES}
+)
+
+set(ALL_SOURCES
+    ${ALL_SOURCES}
+    ${ALL_PALANTIR_SOURCES}
+)
@@ -16,6 +16,7 @@
 
 #include "core_export.hpp"
 #include "signal/isignal_manager.hpp"
+#include "ui_dispatcher.hpp"
 #include "window/window_manager.hpp"
 
 namespace palantir {
@@ -107,6 +108,23 @@ public:
      */
     [[nodiscard]] virtual auto getWindowManager() const -> const std::shared_ptr<window::WindowManager>&;
 
+    /**
+     * @brief Get the UI dispatcher.
+     * @return Reference to the UI dispatcher.
+     *
+     * Returns the dispatcher marshalling work to the UI thread. Window, webview
+     * and content calls made from other threads must go through it. It is bound
+     * to the thread creating the application, the platform run loop drains it.
+     */
+    [[nodiscard]] virtual auto getUiDispatcher() const -> const std::shared_ptr<UiDispatcher>&;
+
+    /**
+     * @brief Read the signal configuration ahead of attachSignals().
+     *
+     * Can be called from any thread, while plugins are still loading.
+     */
+    virtual auto prepareSignals() -> void;
+
     /**
      * @brief Initialize signals from configuration.
      *
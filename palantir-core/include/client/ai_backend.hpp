@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+
+#include "core_export.hpp"
+#include "sauron/dto/DTOs.hpp"
+
+namespace palantir::client {
+
+/**
+ * @brief A provider/model pair a query can be sent to.
+ *
+ * The name is the key used for latency statistics and logs, so it must be unique
+ * among the backends configured on a strategy.
+ */
+struct PALANTIR_CORE_API AIBackend {
+    std::string name;
+    sauron::dto::AIProvider provider;
+    std::string model;
+};
+
+}  // namespace palantir::client
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "client/ai_backend.hpp"
+#include "client/backend_latency_stats.hpp"
+#include "core_export.hpp"
+#include "sauron/client/SauronClient.hpp"
+#include "sauron/dto/DTOs.hpp"
+
+namespace palantir::client {
+
+/**
+ * @brief How a query is dispatched across the configured backends.
+ *
+ * SINGLE sends to the first backend only, on the calling thread.
+ * RACE sends to every backend at once and keeps the first success.
+ * HEDGE sends to the first backend, then to the next one each time the hedge delay
+ * elapses (or immediately when an in-flight request fails), and keeps the first success.
+ */
+enum class PALANTIR_CORE_API AIRequestMode { SINGLE, RACE, HEDGE };  // NOLINT
+
+/**
+ * @brief Configuration of an AIRequestStrategy.
+ */
+struct PALANTIR_CORE_API AIRequestStrategyConfig {
+    static constexpr std::chrono::milliseconds DEFAULT_HEDGE_DELAY{3000};
+    static constexpr std::size_t DEFAULT_MIN_SAMPLES_FOR_ADAPTIVE_DELAY = 20;
+
+    AIRequestMode mode{AIRequestMode::SINGLE};
+    // Backends in priority order, the first one is the primary
+    std::vector<AIBackend> backends{{"openai/gpt-4o", sauron::dto::AIProvider::OPENAI, "gpt-4o"}};
+    // Delay before each hedge, used as is unless the adaptive delay is enabled and warmed up
+    std::chrono::milliseconds hedgeDelay{DEFAULT_HEDGE_DELAY};
+    // Use the primary backend p95 as hedge delay once enough samples were recorded
+    bool adaptiveHedgeDelay{true};
+    std::size_t minSamplesForAdaptiveDelay{DEFAULT_MIN_SAMPLES_FOR_ADAPTIVE_DELAY};
+};
+
+/**
+ * @class AIRequestStrategy
+ * @brief Dispatches an AI query to one or several provider/model pairs.
+ *
+ * In RACE and HEDGE modes each backend request runs on its own thread and the first
+ * successful response is returned. Losing hedges that were not sent yet are cancelled;
+ * requests already on the wire cannot be interrupted through the Sauron client, so their
+ * result is discarded when it arrives. Their latency is still recorded so the statistics
+ * of a slow backend are not biased towards its fast responses.
+ */
+class PALANTIR_CORE_API AIRequestStrategy {
+public:
+    /** @brief Get the singleton instance of the strategy. */
+    [[nodiscard]] static auto getInstance() -> std::shared_ptr<AIRequestStrategy>;
+
+    /** @brief Set the singleton instance of the strategy. */
+    static auto setInstance(const std::shared_ptr<AIRequestStrategy>& instance) -> void;
+
+    /** @brief Destructor, waits for discarded in-flight requests to return. */
+    virtual ~AIRequestStrategy();
+
+    AIRequestStrategy(const AIRequestStrategy&) = delete;
+    auto operator=(const AIRequestStrategy&) -> AIRequestStrategy& = delete;
+    AIRequestStrategy(AIRequestStrategy&&) = delete;
+    auto operator=(AIRequestStrategy&&) -> AIRequestStrategy& = delete;
+
+    /**
+     * @brief Send a query according to the configured mode.
+     * @param sauronClient Client used for every backend request
+     * @param prompt Prompt of the query
+     * @param images Base64 encoded images attached to the query
+     * @return The first successful response
+     * @throws TraceableException<BaseException> if every backend failed
+     */
+    virtual auto execute(const std::shared_ptr<sauron::client::SauronClient>& sauronClient, const std::string& prompt,
+                         const std::vector<std::string>& images) -> sauron::dto::AIAlgorithmResponse;
+
+    /**
+     * @brief Replace the configuration used by the next queries.
+     * @throws std::invalid_argument if no backend is configured
+     */
+    virtual auto setConfig(const AIRequestStrategyConfig& config) -> void;
+
+    /** @brief Get a copy of the current configuration. */
+    [[nodiscard]] virtual auto getConfig() const -> AIRequestStrategyConfig;
+
+    /** @brief Get the hedge delay the next HEDGE query will use. */
+    [[nodiscard]] virtual auto getHedgeDelay() const -> std::chrono::milliseconds;
+
+    /** @brief Get the per-backend latency statistics. */
+    [[nodiscard]] auto getLatencyStats() const -> const BackendLatencyStats&;
+
+protected:
+    AIRequestStrategy();
+    explicit AIRequestStrategy(const AIRequestStrategyConfig& config);
+
+    /** @brief Get the per-backend latency statistics, to record samples outside of execute(). */
+    [[nodiscard]] auto getMutableLatencyStats() -> BackendLatencyStats&;
+
+private:
+    class AIRequestStrategyImpl;
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::unique_ptr<AIRequestStrategyImpl> pimpl_;
+    static std::shared_ptr<AIRequestStrategy> instance_;
+#pragma warning(pop)
+};
+
+}  // namespace palantir::client
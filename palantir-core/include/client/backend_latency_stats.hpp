@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "core_export.hpp"
+
+namespace palantir::client {
+
+/**
+ * @brief Point-in-time view of the statistics recorded for one backend.
+ */
+struct PALANTIR_CORE_API BackendStatsSnapshot {
+    std::size_t successes{0};
+    std::size_t failures{0};
+    std::size_t cancellations{0};
+    std::size_t samples{0};
+    std::optional<std::chrono::milliseconds> p50;
+    std::optional<std::chrono::milliseconds> p95;
+    std::optional<std::chrono::milliseconds> p99;
+};
+
+/**
+ * @class BackendLatencyStats
+ * @brief Thread-safe per-backend latency recorder.
+ *
+ * Keeps a bounded window of the most recent successful latencies for each backend
+ * so percentiles follow the current behaviour of a provider rather than its whole history.
+ * Failures and cancellations are counted but do not contribute latency samples.
+ */
+class PALANTIR_CORE_API BackendLatencyStats {
+public:
+    static constexpr std::size_t DEFAULT_WINDOW_SIZE = 128;
+
+    explicit BackendLatencyStats(std::size_t windowSize = DEFAULT_WINDOW_SIZE);
+    ~BackendLatencyStats();
+
+    BackendLatencyStats(const BackendLatencyStats&) = delete;
+    auto operator=(const BackendLatencyStats&) -> BackendLatencyStats& = delete;
+    BackendLatencyStats(BackendLatencyStats&&) = delete;
+    auto operator=(BackendLatencyStats&&) -> BackendLatencyStats& = delete;
+
+    /** @brief Record a successful response and its latency. */
+    auto recordSuccess(const std::string& backend, std::chrono::milliseconds latency) -> void;
+
+    /** @brief Record a request that failed with an error. */
+    auto recordFailure(const std::string& backend) -> void;
+
+    /** @brief Record a request that was cancelled or whose result was discarded. */
+    auto recordCancellation(const std::string& backend) -> void;
+
+    /**
+     * @brief Get a latency percentile for a backend.
+     * @param backend Backend name
+     * @param percentile Percentile in the range [0, 100]
+     * @return The percentile, or std::nullopt when no sample was recorded yet
+     */
+    [[nodiscard]] auto percentile(const std::string& backend, double percentile) const
+        -> std::optional<std::chrono::milliseconds>;
+
+    /** @brief Get a snapshot of the counters and common percentiles for a backend. */
+    [[nodiscard]] auto snapshot(const std::string& backend) const -> BackendStatsSnapshot;
+
+    /** @brief Drop every recorded sample and counter. */
+    auto reset() -> void;
+
+private:
+    class BackendLatencyStatsImpl;
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::unique_ptr<BackendLatencyStatsImpl> pimpl_;
+#pragma warning(pop)
+};
+
+}  // namespace palantir::client
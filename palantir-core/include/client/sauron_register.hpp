@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include "core_export.hpp"
 #include "sauron/client/SauronClient.hpp"
@@ -9,6 +10,8 @@ namespace palantir::client {
 
 class PALANTIR_CORE_API SauronRegister {
 public:
+    static constexpr const char* DEFAULT_SERVER_URL = "localhost:3000";
+
     // Delete copy and move operations
     SauronRegister(const SauronRegister&) = delete;
     auto operator=(const SauronRegister&) -> SauronRegister& = delete;
@@ -20,7 +23,14 @@ public:
 
     static auto setInstance(const std::shared_ptr<SauronRegister>& instance) -> void;
 
-    // Client accessor
+    // Create a register whose client talks to another Sauron server, e.g. a local stub
+    [[nodiscard]] static auto createForServer(const std::string& serverUrl) -> std::shared_ptr<SauronRegister>;
+
+    // Log in once, a caller arriving during the login waits for it. A failed login throws and the next call
+    // tries again. Registers created around an existing client do not log in.
+    auto login() const -> void;
+
+    // Client accessor, logs in first if no login succeeded yet
     [[nodiscard]] virtual auto getSauronClient() const -> std::shared_ptr<sauron::client::SauronClient>;
 
     // Destructor
@@ -30,6 +40,7 @@ protected:
     // Protected constructor for testing
     SauronRegister();
     explicit SauronRegister(const std::shared_ptr<sauron::client::SauronClient>& sauronClient);
+    explicit SauronRegister(const std::string& serverUrl);
 
 private:
 #pragma warning(push)
@@ -14,6 +14,7 @@ using TraceableContentManagerException = TraceableException<ContentManagerExcept
 using TraceableInputFactoryException = TraceableException<InputFactoryException>;
 using TraceableResourceLoadingException = TraceableException<ResourceLoadingException>;
 using TraceablePluginInitializationException = TraceableException<PluginInitializationException>;
+using TraceablePluginCommandException = TraceableException<PluginCommandException>;
 using TraceableUnknownCommandException = TraceableException<UnknownCommandException>;
 using TraceableUIComponentNotFoundException = TraceableException<UIComponentNotFoundException>;
 using TraceableShortcutConfigurationException = TraceableException<ShortcutConfigurationException>;
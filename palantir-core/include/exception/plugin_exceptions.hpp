@@ -13,6 +13,15 @@ public:
         : BaseException(message) {}
 };
 
+/**
+ * @brief Thrown when a command created by a plugin library fails
+ */
+class PALANTIR_CORE_API PluginCommandException : public BaseException {
+public:
+    explicit PluginCommandException(const std::string& message = "Plugin command failed")
+        : BaseException(message) {}
+};
+
 /**
  * @brief Thrown when an unknown command is encountered
  */
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+
+#include "core_export.hpp"
+
+namespace palantir::exception {
+
+/**
+ * @class StackTrace
+ * @brief Raw frame addresses of a call stack, symbolized on demand.
+ *
+ * Capturing only walks the stack, so it is cheap enough for exceptions thrown in ordinary
+ * control flow. The frames are turned into text by toString() through the StackTraceResolver.
+ */
+class PALANTIR_CORE_API StackTrace {
+public:
+    static constexpr std::size_t MAX_FRAMES = 64;
+
+    StackTrace() = default;
+
+    /**
+     * @brief Capture the stack of the calling thread.
+     *
+     * @param skip Number of frames to drop above the caller of current().
+     */
+    static auto current(std::size_t skip = 0) -> StackTrace;
+
+    [[nodiscard]] auto getFrames() const -> std::span<void* const> { return {frames_.data(), size_}; }
+
+    [[nodiscard]] auto empty() const -> bool { return size_ == 0; }
+
+    /**
+     * @brief Symbolize the frames, one per line after a "Stack trace:" header.
+     */
+    [[nodiscard]] auto toString() const -> std::string;
+
+private:
+    std::array<void*, MAX_FRAMES> frames_{};
+    std::size_t size_{0};
+};
+
+/**
+ * @class StackTraceResolver
+ * @brief Process-wide symbolizer of frame addresses, caching each address it resolved.
+ *
+ * The symbol handler is initialized on the first resolution rather than on every throw. Resolution
+ * is serialized, DbgHelp is not thread safe.
+ */
+class PALANTIR_CORE_API StackTraceResolver {
+public:
+    // Entries kept before the cache is reset, addresses of unloaded plugins would otherwise pile up
+    static constexpr std::size_t MAX_CACHED_FRAMES = 4096;
+
+    static auto getInstance() -> StackTraceResolver&;
+
+    StackTraceResolver();
+    ~StackTraceResolver();
+
+    StackTraceResolver(const StackTraceResolver&) = delete;
+    auto operator=(const StackTraceResolver&) -> StackTraceResolver& = delete;
+    StackTraceResolver(StackTraceResolver&&) = delete;
+    auto operator=(StackTraceResolver&&) -> StackTraceResolver& = delete;
+
+    /**
+     * @brief Describe a frame address, e.g. its demangled function and location.
+     */
+    [[nodiscard]] auto resolve(void* address) -> std::string;
+
+    [[nodiscard]] auto getCachedFrameCount() const -> std::size_t;
+
+    /**
+     * @brief Forget the resolved addresses, e.g. after a library was unloaded.
+     */
+    auto clear() -> void;
+
+private:
+    class StackTraceResolverImpl;
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::unique_ptr<StackTraceResolverImpl> pimpl_;
+#pragma warning(pop)
+};
+
+}  // namespace palantir::exception
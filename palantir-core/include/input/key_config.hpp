@@ -11,12 +11,15 @@
 #define KEY_CONFIG_HPP
 
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "core_export.hpp"
+#include "input/key_error.hpp"
+#include "utils/expected.hpp"
 #include "utils/string_utils.hpp"
 
 namespace palantir::input {
@@ -81,6 +84,16 @@ public:
      */
     [[nodiscard]] virtual auto getShortcut(const std::string& commandName) const -> const ShortcutConfig&;
 
+    /**
+     * @brief Get the shortcut configuration for a command without throwing.
+     * @param commandName Name of the command to get the shortcut for.
+     * @return The ShortcutConfig for the command, or KeyError::SHORTCUT_NOT_FOUND.
+     *
+     * Looks the command up once, where hasShortcut() followed by getShortcut() looks it up twice.
+     */
+    [[nodiscard]] virtual auto tryGetShortcut(const std::string& commandName) const
+        -> utils::Expected<std::reference_wrapper<const ShortcutConfig>, KeyError>;
+
     /**
      * @brief Check if a shortcut exists for a command.
      * @param commandName Name of the command to check.
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace palantir::input {
+
+/**
+ * @brief Why a shortcut or key lookup found nothing.
+ */
+enum class KeyError : uint8_t {
+    /** @brief No shortcut is configured for the command. */
+    SHORTCUT_NOT_FOUND,
+    /** @brief The key or modifier name is not registered. */
+    KEY_NOT_FOUND
+};
+
+[[nodiscard]] constexpr auto getKeyErrorMessage(KeyError error) -> std::string_view {
+    switch (error) {
+        case KeyError::SHORTCUT_NOT_FOUND:
+            return "No shortcut configured";
+        case KeyError::KEY_NOT_FOUND:
+            return "Key not found";
+    }
+    return "Unknown key error";
+}
+
+}  // namespace palantir::input
@@ -14,6 +14,8 @@
 #include <string>
 
 #include "core_export.hpp"
+#include "input/key_error.hpp"
+#include "utils/expected.hpp"
 
 namespace palantir::input {
 
@@ -56,6 +58,13 @@ public:
      */
     [[nodiscard]] static auto getKeyCode(const std::string& keyName) -> int;
 
+    /**
+     * @brief Convert a key name to its key code without throwing.
+     * @param keyName String representation of the key.
+     * @return The key code, or KeyError::KEY_NOT_FOUND if the key name is invalid.
+     */
+    [[nodiscard]] static auto tryGetKeyCode(const std::string& keyName) -> utils::Expected<int, KeyError>;
+
     /**
      * @brief Convert a modifier name to its corresponding modifier code.
      * @param modifierName String representation of the modifier.
@@ -67,6 +76,13 @@ public:
      */
     [[nodiscard]] static auto getModifierCode(const std::string& modifierName) -> int;
 
+    /**
+     * @brief Convert a modifier name to its modifier code without throwing.
+     * @param modifierName String representation of the modifier.
+     * @return The modifier code, or KeyError::KEY_NOT_FOUND if the modifier name is invalid.
+     */
+    [[nodiscard]] static auto tryGetModifierCode(const std::string& modifierName) -> utils::Expected<int, KeyError>;
+
     /**
      * @brief Check if a key name is valid.
      * @param keyName String representation of the key to validate.
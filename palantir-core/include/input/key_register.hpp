@@ -5,6 +5,8 @@
 #include <string>
 
 #include "core_export.hpp"
+#include "input/key_error.hpp"
+#include "utils/expected.hpp"
 
 namespace palantir::input {
 
@@ -31,7 +33,17 @@ public:
     static auto setInstance(const std::shared_ptr<KeyRegister>& instance) -> void;
 
     virtual auto registerKey(const std::string& key, int value) -> void;
+    /**
+     * @brief Get the value of a key.
+     * @throws std::invalid_argument if the key is not registered.
+     */
     [[nodiscard]] virtual auto get(const std::string& key) const -> int;
+
+    /**
+     * @brief Get the value of a key in a single lookup, without throwing.
+     * @return The value, or KeyError::KEY_NOT_FOUND.
+     */
+    [[nodiscard]] virtual auto tryGet(const std::string& key) const -> utils::Expected<int, KeyError>;
     [[nodiscard]] virtual auto hasKey(const std::string& key) const -> bool;
 
 protected:
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+
+#include "core_export.hpp"
+#include "logging/log_sink.hpp"
+
+namespace palantir::logging {
+
+/**
+ * @brief Sink appending lines to a file, rotated by size.
+ *
+ * When the file would grow past maxBytes it is renamed to <path>.1, the previous <path>.1 to
+ * <path>.2 and so on, the oldest beyond maxFiles being deleted. If the file cannot be opened again
+ * after a rotation, lines are dropped until a later write manages to open it.
+ */
+class PALANTIR_CORE_API FileLogSink : public LogSink {
+public:
+    static constexpr std::size_t DEFAULT_MAX_BYTES = 5 * 1024 * 1024;
+    static constexpr std::size_t DEFAULT_MAX_FILES = 3;
+
+    /**
+     * @brief Open, or create, the log file and its directory.
+     *
+     * @param path The log file.
+     * @param maxBytes Size from which the file is rotated, 0 to never rotate.
+     * @param maxFiles Number of rotated files kept.
+     * @throws std::runtime_error if the file cannot be opened.
+     */
+    explicit FileLogSink(std::filesystem::path path, std::size_t maxBytes = DEFAULT_MAX_BYTES,
+                         std::size_t maxFiles = DEFAULT_MAX_FILES);
+    ~FileLogSink() override;
+
+    FileLogSink(const FileLogSink&) = delete;
+    auto operator=(const FileLogSink&) -> FileLogSink& = delete;
+    FileLogSink(FileLogSink&&) = delete;
+    auto operator=(FileLogSink&&) -> FileLogSink& = delete;
+
+    auto write(const LogEntry& entry) -> void override;
+    auto flush() -> void override;
+
+private:
+    class FileLogSinkImpl;
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::unique_ptr<FileLogSinkImpl> pimpl_;
+#pragma warning(pop)
+};
+
+}  // namespace palantir::logging
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <ios>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+#include "logging/message_stream.hpp"
+
+#if defined(__cpp_lib_format)
+#define PALANTIR_HAS_STD_FORMAT 1
+#else
+#define PALANTIR_HAS_STD_FORMAT 0
+#endif
+
+namespace palantir::logging {
+
+#if PALANTIR_HAS_STD_FORMAT
+
+/**
+ * @brief Format string of a log call, checked against its arguments at compile time.
+ */
+template <typename... Args>
+using LogFormatString = std::format_string<const Args&...>;
+
+/**
+ * @brief Write a formatted message to a stream.
+ */
+template <typename... Args>
+auto formatTo(std::ostream& out, std::string_view format, const Args&... args) -> void {
+    std::vformat_to(std::ostreambuf_iterator<char>(out), format, std::make_format_args(args...));
+}
+
+/**
+ * @brief Format a message, through a stack buffer when it fits.
+ */
+template <typename... Args>
+auto formatToString(LogFormatString<Args...> format, const Args&... args) -> std::string {
+    std::array<char, 256> buffer;  // NOLINT
+    const auto result = std::format_to_n(buffer.data(), buffer.size(), format, args...);
+    if (static_cast<std::size_t>(result.size) <= buffer.size()) {
+        return std::string(buffer.data(), static_cast<std::size_t>(result.size));
+    }
+    return std::format(format, args...);
+}
+
+#else
+
+namespace detail {
+
+// Number of replacement fields of a format string, or -1 if a brace is unmatched
+constexpr auto countReplacementFields(std::string_view format) -> int {
+    int count = 0;
+    for (std::size_t i = 0; i < format.size(); ++i) {
+        if (format[i] == '{') {
+            if (i + 1 < format.size() && format[i + 1] == '{') {
+                ++i;
+                continue;
+            }
+            const auto end = format.find('}', i);
+            if (end == std::string_view::npos) {
+                return -1;
+            }
+            ++count;
+            i = end;
+        } else if (format[i] == '}') {
+            if (i + 1 >= format.size() || format[i + 1] != '}') {
+                return -1;
+            }
+            ++i;
+        }
+    }
+    return count;
+}
+
+// Apply the part of a format spec iostreams can express: the # and 0 flags, the width and the x, X and o types
+inline auto applySpec(std::ostream& out, std::string_view spec) -> void {
+    std::size_t i = 0;
+    if (i < spec.size() && spec[i] == '#') {
+        out << std::showbase;
+        ++i;
+    }
+    if (i < spec.size() && spec[i] == '0') {
+        out.fill('0');
+        out << std::internal;
+        ++i;
+    }
+    int width = 0;
+    while (i < spec.size() && spec[i] >= '0' && spec[i] <= '9') {
+        width = width * 10 + (spec[i] - '0');
+        ++i;
+    }
+    out.width(width);
+    if (i < spec.size()) {
+        switch (spec[i]) {
+            case 'x':
+                out << std::hex;
+                break;
+            case 'X':
+                out << std::hex << std::uppercase;
+                break;
+            case 'o':
+                out << std::oct;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+template <typename T>
+auto writeArgument(std::ostream& out, std::string_view spec, const T& value) -> void {
+    const auto flags = out.flags();
+    const auto fill = out.fill();
+    applySpec(out, spec);
+    if constexpr (std::is_same_v<T, bool>) {
+        out << std::boolalpha;
+    }
+    out << value;
+    out.flags(flags);
+    out.fill(fill);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Format string of a log call, checked against the number of arguments at compile time.
+ *
+ * The standard library has no std::format here, the fallback formatter only supports automatic
+ * indexing and the integer presentation of the format spec.
+ */
+template <typename... Args>
+class BasicLogFormatString {
+public:
+    template <typename S>
+        requires std::is_convertible_v<const S&, std::string_view>
+    consteval BasicLogFormatString(const S& format)  // NOLINT(google-explicit-constructor)
+        : format_(format) {
+        if (detail::countReplacementFields(format_) != static_cast<int>(sizeof...(Args))) {
+            throw "format string does not match the number of arguments";
+        }
+    }
+
+    [[nodiscard]] constexpr auto get() const -> std::string_view { return format_; }
+
+private:
+    std::string_view format_;
+};
+
+// The arguments are deduced from the values only, as for std::format_string
+template <typename... Args>
+using LogFormatString = BasicLogFormatString<std::type_identity_t<Args>...>;
+
+template <typename... Args>
+auto formatTo(std::ostream& out, std::string_view format, const Args&... args) -> void {
+    std::size_t argument = 0;
+    std::size_t i = 0;
+    while (i < format.size()) {
+        const char c = format[i];
+        if ((c == '{' || c == '}') && i + 1 < format.size() && format[i + 1] == c) {
+            out.put(c);
+            i += 2;
+            continue;
+        }
+        if (c != '{') {
+            out.put(c);
+            ++i;
+            continue;
+        }
+        const auto end = format.find('}', i);
+        auto field = format.substr(i + 1, end - i - 1);
+        const auto colon = field.find(':');
+        [[maybe_unused]] const auto spec =
+            colon == std::string_view::npos ? std::string_view() : field.substr(colon + 1);
+        [[maybe_unused]] std::size_t index = 0;
+        ((index++ == argument ? detail::writeArgument(out, spec, args) : void()), ...);
+        ++argument;
+        i = end + 1;
+    }
+}
+
+template <typename... Args>
+auto formatToString(LogFormatString<Args...> format, const Args&... args) -> std::string {
+    return formatWithThreadStream([&](std::ostream& out) { formatTo(out, format.get(), args...); });
+}
+
+#endif
+
+}  // namespace palantir::logging
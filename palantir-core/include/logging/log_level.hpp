@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace palantir::logging {
+
+/**
+ * @brief Severity of a log entry, in increasing order.
+ *
+ * DBG and ERR are abbreviated because DEBUG is a build definition and ERROR a Windows macro.
+ */
+enum class LogLevel : uint8_t { TRACE, DBG, INFO, WARN, ERR, OFF };
+
+/**
+ * @brief Get the name of a level as written in log lines and configuration.
+ */
+[[nodiscard]] constexpr auto getLogLevelName(LogLevel level) -> std::string_view {
+    switch (level) {
+        case LogLevel::TRACE:
+            return "trace";
+        case LogLevel::DBG:
+            return "debug";
+        case LogLevel::INFO:
+            return "info";
+        case LogLevel::WARN:
+            return "warn";
+        case LogLevel::ERR:
+            return "error";
+        case LogLevel::OFF:
+            return "off";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Get the level with this name.
+ *
+ * @return The level, unset for an unknown name.
+ */
+[[nodiscard]] constexpr auto parseLogLevel(std::string_view name) -> std::optional<LogLevel> {
+    for (auto level : {LogLevel::TRACE, LogLevel::DBG, LogLevel::INFO, LogLevel::WARN, LogLevel::ERR, LogLevel::OFF}) {
+        if (getLogLevelName(level) == name) {
+            return level;
+        }
+    }
+    return std::nullopt;
+}
+
+}  // namespace palantir::logging
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <source_location>
+
+#include "logging/logger.hpp"
+
+// Levels as numbers for the preprocessor, in the order of palantir::logging::LogLevel
+#define PALANTIR_LOG_LEVEL_TRACE 0
+#define PALANTIR_LOG_LEVEL_DEBUG 1
+#define PALANTIR_LOG_LEVEL_INFO 2
+#define PALANTIR_LOG_LEVEL_WARN 3
+#define PALANTIR_LOG_LEVEL_ERROR 4
+#define PALANTIR_LOG_LEVEL_OFF 5
+
+static_assert(static_cast<int>(palantir::logging::LogLevel::TRACE) == PALANTIR_LOG_LEVEL_TRACE &&
+              static_cast<int>(palantir::logging::LogLevel::DBG) == PALANTIR_LOG_LEVEL_DEBUG &&
+              static_cast<int>(palantir::logging::LogLevel::INFO) == PALANTIR_LOG_LEVEL_INFO &&
+              static_cast<int>(palantir::logging::LogLevel::WARN) == PALANTIR_LOG_LEVEL_WARN &&
+              static_cast<int>(palantir::logging::LogLevel::ERR) == PALANTIR_LOG_LEVEL_ERROR &&
+              static_cast<int>(palantir::logging::LogLevel::OFF) == PALANTIR_LOG_LEVEL_OFF);
+
+// Lowest level compiled in, set with the PALANTIR_LOG_ACTIVE_LEVEL CMake cache variable
+#ifndef PALANTIR_LOG_ACTIVE_LEVEL
+#ifdef DEBUG
+#define PALANTIR_LOG_ACTIVE_LEVEL PALANTIR_LOG_LEVEL_DEBUG
+#else
+#define PALANTIR_LOG_ACTIVE_LEVEL PALANTIR_LOG_LEVEL_INFO
+#endif
+#endif
+
+/**
+ * Log a message formatted as by std::format, e.g. PALANTIR_LOG_INFO("Loaded {} shortcuts", count).
+ * The format string is checked at compile time.
+ */
+#define PALANTIR_LOG(level, ...) \
+    palantir::logging::Logger::getInstance()->logFormat(level, std::source_location::current(), __VA_ARGS__)
+
+// A level below PALANTIR_LOG_ACTIVE_LEVEL still checks its format string but emits no code and
+// does not evaluate its arguments
+#define PALANTIR_LOG_DISABLED(level, ...)       \
+    do {                                        \
+        if (false) {                            \
+            PALANTIR_LOG(level, __VA_ARGS__);   \
+        }                                       \
+    } while (false)
+
+#if PALANTIR_LOG_ACTIVE_LEVEL <= PALANTIR_LOG_LEVEL_TRACE
+#define PALANTIR_LOG_TRACE(...) PALANTIR_LOG(palantir::logging::LogLevel::TRACE, __VA_ARGS__)
+#else
+#define PALANTIR_LOG_TRACE(...) PALANTIR_LOG_DISABLED(palantir::logging::LogLevel::TRACE, __VA_ARGS__)
+#endif
+
+#if PALANTIR_LOG_ACTIVE_LEVEL <= PALANTIR_LOG_LEVEL_DEBUG
+#define PALANTIR_LOG_DEBUG(...) PALANTIR_LOG(palantir::logging::LogLevel::DBG, __VA_ARGS__)
+#else
+#define PALANTIR_LOG_DEBUG(...) PALANTIR_LOG_DISABLED(palantir::logging::LogLevel::DBG, __VA_ARGS__)
+#endif
+
+#if PALANTIR_LOG_ACTIVE_LEVEL <= PALANTIR_LOG_LEVEL_INFO
+#define PALANTIR_LOG_INFO(...) PALANTIR_LOG(palantir::logging::LogLevel::INFO, __VA_ARGS__)
+#else
+#define PALANTIR_LOG_INFO(...) PALANTIR_LOG_DISABLED(palantir::logging::LogLevel::INFO, __VA_ARGS__)
+#endif
+
+#if PALANTIR_LOG_ACTIVE_LEVEL <= PALANTIR_LOG_LEVEL_WARN
+#define PALANTIR_LOG_WARN(...) PALANTIR_LOG(palantir::logging::LogLevel::WARN, __VA_ARGS__)
+#else
+#define PALANTIR_LOG_WARN(...) PALANTIR_LOG_DISABLED(palantir::logging::LogLevel::WARN, __VA_ARGS__)
+#endif
+
+#if PALANTIR_LOG_ACTIVE_LEVEL <= PALANTIR_LOG_LEVEL_ERROR
+#define PALANTIR_LOG_ERROR(...) PALANTIR_LOG(palantir::logging::LogLevel::ERR, __VA_ARGS__)
+#else
+#define PALANTIR_LOG_ERROR(...) PALANTIR_LOG_DISABLED(palantir::logging::LogLevel::ERR, __VA_ARGS__)
+#endif
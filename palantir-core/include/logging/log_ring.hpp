@@ -0,0 +1,126 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+
+#include "logging/log_level.hpp"
+
+namespace palantir::logging {
+
+/**
+ * @brief Single producer, single consumer ring of captured log calls.
+ *
+ * Each thread logs into its own ring, the logger thread is the only consumer, so neither side
+ * takes a lock: a call costs a slot write and a release store. The arguments are captured in the
+ * slot and only formatted by the consumer. A full ring rejects the call rather than block the
+ * producer.
+ */
+class LogRing {
+public:
+    // Formats the captured arguments of a slot
+    using FormatFunction = void (*)(const void* payload, std::ostream& out);
+    // Destroys the captured arguments of a slot
+    using DestroyFunction = void (*)(void* payload);
+
+    static constexpr std::size_t DEFAULT_CAPACITY = 512;
+    // Bytes available in a slot for the captured arguments, larger captures are formatted eagerly
+    static constexpr std::size_t PAYLOAD_SIZE = 256;
+
+    struct Slot {
+        LogLevel level{LogLevel::INFO};
+        std::chrono::system_clock::time_point time;
+        const char* function{""};
+        uint32_t line{0};
+        FormatFunction format{nullptr};
+        DestroyFunction destroy{nullptr};
+        alignas(std::max_align_t) std::byte payload[PAYLOAD_SIZE];
+    };
+
+    /**
+     * @param threadId Identifier of the producing thread, written in the entries.
+     * @param capacity Number of slots, rounded up to a power of two.
+     */
+    explicit LogRing(uint64_t threadId, std::size_t capacity = DEFAULT_CAPACITY)
+        : threadId_(threadId), mask_(roundUp(capacity) - 1), slots_(std::make_unique<Slot[]>(mask_ + 1)) {}
+
+    ~LogRing() {
+        consume([](const Slot&) {});
+    }
+
+    LogRing(const LogRing&) = delete;
+    auto operator=(const LogRing&) -> LogRing& = delete;
+    LogRing(LogRing&&) = delete;
+    auto operator=(LogRing&&) -> LogRing& = delete;
+
+    /**
+     * @brief Get the next free slot, producer side.
+     *
+     * @return The slot to fill then publish with commit(), nullptr if the ring is full.
+     */
+    [[nodiscard]] auto tryAcquire() -> Slot* {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) > mask_) {
+            return nullptr;
+        }
+        return &slots_[tail & mask_];
+    }
+
+    /**
+     * @brief Publish the slot returned by the last tryAcquire(), producer side.
+     */
+    auto commit() -> void { tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    /**
+     * @brief Visit then release every published slot, consumer side.
+     *
+     * @return The number of slots consumed.
+     */
+    template <typename F>
+    auto consume(F&& visit) -> std::size_t {
+        const auto head = head_.load(std::memory_order_relaxed);
+        const auto tail = tail_.load(std::memory_order_acquire);
+        for (auto index = head; index != tail; ++index) {
+            auto& slot = slots_[index & mask_];
+            visit(static_cast<const Slot&>(slot));
+            slot.destroy(slot.payload);
+        }
+        head_.store(tail, std::memory_order_release);
+        return tail - head;
+    }
+
+    [[nodiscard]] auto empty() const -> bool {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] auto getThreadId() const -> uint64_t { return threadId_; }
+
+    /**
+     * @brief Mark the ring as left by its thread, the logger drops it once drained.
+     */
+    auto release() -> void { released_.store(true, std::memory_order_release); }
+
+    [[nodiscard]] auto isReleased() const -> bool { return released_.load(std::memory_order_acquire); }
+
+private:
+    static constexpr auto roundUp(std::size_t capacity) -> std::size_t {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size *= 2;
+        }
+        return size;
+    }
+
+    uint64_t threadId_;
+    std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<bool> released_{false};
+    // Producer and consumer indexes on their own cache lines
+    alignas(64) std::atomic<std::size_t> tail_{0};
+    alignas(64) std::atomic<std::size_t> head_{0};
+};
+
+}  // namespace palantir::logging
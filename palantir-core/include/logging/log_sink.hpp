@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "core_export.hpp"
+#include "logging/log_level.hpp"
+
+namespace palantir::utils {
+
+/**
+ * @brief Write a message to the platform debug output, OutputDebugString or NSLog.
+ */
+void PALANTIR_CORE_API PlatformLog(std::string_view function, int line, const std::string& message);
+
+}  // namespace palantir::utils
+
+namespace palantir::logging {
+
+/**
+ * @brief A formatted log entry, as given to the sinks.
+ *
+ * The message view is only valid during the write call.
+ */
+struct LogEntry {
+    LogLevel level{LogLevel::INFO};
+    std::chrono::system_clock::time_point time;
+    uint64_t threadId{0};
+    const char* function{""};
+    uint32_t line{0};
+    std::string_view message;
+};
+
+/**
+ * @brief Destination of log entries.
+ *
+ * Sinks are only called from the logger thread, one entry at a time, so they need no locking.
+ */
+class PALANTIR_CORE_API LogSink {
+public:
+    LogSink() = default;
+    virtual ~LogSink() = default;
+
+    LogSink(const LogSink&) = delete;
+    auto operator=(const LogSink&) -> LogSink& = delete;
+    LogSink(LogSink&&) = delete;
+    auto operator=(LogSink&&) -> LogSink& = delete;
+
+    virtual auto write(const LogEntry& entry) -> void = 0;
+
+    /**
+     * @brief Flush buffered entries, called after each batch.
+     */
+    virtual auto flush() -> void {}
+
+    /**
+     * @brief Append an entry as a text line: time, level, thread, location and message.
+     */
+    static auto appendLine(std::string& out, const LogEntry& entry) -> void;
+};
+
+/**
+ * @brief Sink writing lines to the standard error stream.
+ */
+class PALANTIR_CORE_API StderrLogSink : public LogSink {
+public:
+    auto write(const LogEntry& entry) -> void override;
+    auto flush() -> void override;
+
+private:
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::string line_;
+#pragma warning(pop)
+};
+
+/**
+ * @brief Sink writing to the platform debug output, as DebugLog always did.
+ */
+class PALANTIR_CORE_API PlatformLogSink : public LogSink {
+public:
+    auto write(const LogEntry& entry) -> void override;
+};
+
+}  // namespace palantir::logging
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "core_export.hpp"
+#include "logging/log_format.hpp"
+#include "logging/log_level.hpp"
+#include "logging/log_ring.hpp"
+#include "logging/log_sink.hpp"
+#include "logging/message_stream.hpp"
+
+namespace palantir::logging {
+
+namespace detail {
+
+// Arguments are captured by value, strings are copied since the caller's buffer may not outlive the call
+template <typename T>
+struct LogCapture {
+    using type = T;
+};
+template <>
+struct LogCapture<const char*> {
+    using type = std::string;
+};
+template <>
+struct LogCapture<char*> {
+    using type = std::string;
+};
+template <>
+struct LogCapture<std::string_view> {
+    using type = std::string;
+};
+// Smart pointers are written as their address, holding them would delay the owned object's destruction
+template <typename T>
+struct LogCapture<std::shared_ptr<T>> {
+    using type = const void*;
+};
+template <typename T, typename D>
+struct LogCapture<std::unique_ptr<T, D>> {
+    using type = const void*;
+};
+template <typename T>
+using LogCaptureT = typename LogCapture<std::decay_t<T>>::type;
+
+template <typename T>
+auto capture(const T& value) -> const auto& {
+    return value;
+}
+template <typename T>
+auto capture(const std::shared_ptr<T>& pointer) -> const void* {
+    return pointer.get();
+}
+template <typename T, typename D>
+auto capture(const std::unique_ptr<T, D>& pointer) -> const void* {
+    return pointer.get();
+}
+
+}  // namespace detail
+
+struct LoggerStats {
+    uint64_t written{0};
+    // Calls rejected because the ring of their thread was full
+    uint64_t dropped{0};
+    // Sink writes that threw, the entry is lost for that sink only
+    uint64_t failed{0};
+};
+
+/**
+ * @class Logger
+ * @brief Asynchronous logger writing to a set of sinks from a background thread.
+ *
+ * A call below the level costs one relaxed load. Otherwise the arguments are captured by value
+ * into a lock-free ring owned by the calling thread and the logger thread formats and writes them,
+ * so logging is cheap enough for the keyboard hook. When a ring is full the call is dropped and
+ * counted rather than blocking the caller. ERR entries wake the logger thread at once, the others
+ * are written within FLUSH_INTERVAL. Entries keep their order within a thread.
+ *
+ * The level defaults to DBG in debug builds and INFO otherwise, the PALANTIR_LOG_LEVEL environment
+ * variable overrides it, e.g. PALANTIR_LOG_LEVEL=trace.
+ */
+class PALANTIR_CORE_API Logger {
+public:
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL{10};
+
+    /**
+     * @brief Get the singleton instance of the logger, created on first use.
+     */
+    static auto getInstance() -> const std::shared_ptr<Logger>&;
+
+    static auto setInstance(const std::shared_ptr<Logger>& instance) -> void;
+
+    /**
+     * @brief Create a logger with the default level and sinks and start its thread.
+     */
+    Logger();
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    auto operator=(const Logger&) -> Logger& = delete;
+    Logger(Logger&&) = delete;
+    auto operator=(Logger&&) -> Logger& = delete;
+
+    auto setLevel(LogLevel level) -> void { level_.store(level, std::memory_order_relaxed); }
+
+    [[nodiscard]] auto getLevel() const -> LogLevel { return level_.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] auto isEnabled(LogLevel level) const -> bool {
+        return level >= level_.load(std::memory_order_relaxed) && level != LogLevel::OFF;
+    }
+
+    auto addSink(std::shared_ptr<LogSink> sink) -> void;
+
+    auto clearSinks() -> void;
+
+    /**
+     * @brief Log the concatenation of the arguments, as written by operator<<.
+     *
+     * @param level The level of the entry, it is discarded below the logger level.
+     * @param location The location written in the entry.
+     * @param args The arguments, copied until the logger thread formats them.
+     */
+    template <typename... Args>
+    auto log(LogLevel level, const std::source_location& location, const Args&... args) -> void {
+        if (!isEnabled(level)) {
+            return;
+        }
+        using Payload = std::tuple<detail::LogCaptureT<Args>...>;
+        if constexpr (fitsSlot<Payload>()) {
+            enqueue<Payload>(
+                level, location,
+                [](const void* payload, std::ostream& out) {
+                    std::apply([&out](const auto&... values) { (out << ... << values); },
+                               *static_cast<const Payload*>(payload));
+                },
+                detail::capture(args)...);
+        } else {
+            // Too large to capture, format on the calling thread
+            enqueue<std::string>(level, location, &writeText,
+                                 formatWithThreadStream([&](std::ostream& out) { (out << ... << args); }));
+        }
+    }
+
+    /**
+     * @brief Log a message formatted as by std::format.
+     *
+     * The format string is checked against the arguments at compile time. As with log(), the
+     * arguments are copied and formatted by the logger thread. Prefer the PALANTIR_LOG_* macros,
+     * which compile to nothing below PALANTIR_LOG_ACTIVE_LEVEL.
+     *
+     * @param level The level of the entry, it is discarded below the logger level.
+     * @param location The location written in the entry.
+     * @param format The format string, it must outlive the logger thread, e.g. a literal.
+     * @param args The arguments of the format string.
+     */
+    template <typename... Args>
+    auto logFormat(LogLevel level, const std::source_location& location, LogFormatString<Args...> format,
+                   const Args&... args) -> void {
+        if (!isEnabled(level)) {
+            return;
+        }
+        using Payload = std::tuple<std::string_view, detail::LogCaptureT<Args>...>;
+        if constexpr (fitsSlot<Payload>()) {
+            enqueue<Payload>(
+                level, location,
+                [](const void* payload, std::ostream& out) {
+                    std::apply([&out](std::string_view text, const auto&... values) { formatTo(out, text, values...); },
+                               *static_cast<const Payload*>(payload));
+                },
+                format.get(), detail::capture(args)...);
+        } else {
+            enqueue<std::string>(level, location, &writeText, formatToString<Args...>(format, args...));
+        }
+    }
+
+    /**
+     * @brief Write every entry logged so far, from any thread but a sink.
+     */
+    auto flush() -> void;
+
+    [[nodiscard]] auto getStats() const -> LoggerStats;
+
+private:
+    template <typename Payload>
+    static constexpr auto fitsSlot() -> bool {
+        return sizeof(Payload) <= LogRing::PAYLOAD_SIZE && alignof(Payload) <= alignof(std::max_align_t);
+    }
+
+    static auto writeText(const void* payload, std::ostream& out) -> void {
+        out << *static_cast<const std::string*>(payload);
+    }
+
+    // Fill a slot of the calling thread's ring with the payload built from values, dropped if the ring is full
+    template <typename Payload, typename... Values>
+    auto enqueue(LogLevel level, const std::source_location& location, LogRing::FormatFunction format,
+                 Values&&... values) -> void {
+        auto& ring = localRing();
+        auto* slot = ring.tryAcquire();
+        if (slot == nullptr) {
+            countDropped();
+            return;
+        }
+        slot->level = level;
+        slot->time = std::chrono::system_clock::now();
+        slot->function = location.function_name();
+        slot->line = location.line();
+        new (slot->payload) Payload(std::forward<Values>(values)...);
+        slot->format = format;
+        slot->destroy = [](void* payload) { static_cast<Payload*>(payload)->~Payload(); };
+        ring.commit();
+        if (level >= LogLevel::ERR) {
+            wake();
+        }
+    }
+
+    // The ring of the calling thread, registered on first use
+    auto localRing() -> LogRing&;
+    auto countDropped() -> void;
+    auto wake() -> void;
+
+    class LoggerImpl;
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::atomic<LogLevel> level_;
+    std::unique_ptr<LoggerImpl> pimpl_;
+    static std::shared_ptr<Logger> instance_;
+#pragma warning(pop)
+};
+
+}  // namespace palantir::logging
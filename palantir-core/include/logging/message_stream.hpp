@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <ios>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace palantir::logging {
+
+/**
+ * @brief Output stream writing a log message into a string kept between messages.
+ *
+ * Unlike resetting a std::ostringstream, reset() keeps the capacity of the string, so formatting
+ * a message does not allocate once the longest message so far fits.
+ */
+class MessageStream {
+public:
+    MessageStream() : stream_(&buffer_) {}
+    ~MessageStream() = default;
+
+    MessageStream(const MessageStream&) = delete;
+    auto operator=(const MessageStream&) -> MessageStream& = delete;
+    MessageStream(MessageStream&&) = delete;
+    auto operator=(MessageStream&&) -> MessageStream& = delete;
+
+    /** @brief Empty the message and restore the default formatting flags. */
+    auto reset() -> void {
+        buffer_.clear();
+        stream_.clear();
+        stream_.flags(std::ios_base::skipws | std::ios_base::dec);
+        stream_.fill(' ');
+        stream_.width(0);
+        stream_.precision(DEFAULT_PRECISION);
+    }
+
+    [[nodiscard]] auto stream() -> std::ostream& { return stream_; }
+
+    [[nodiscard]] auto view() const -> std::string_view { return buffer_.view(); }
+
+private:
+    static constexpr std::streamsize DEFAULT_PRECISION = 6;
+
+    class StringBuffer : public std::streambuf {
+    public:
+        auto clear() -> void { text_.clear(); }
+
+        [[nodiscard]] auto view() const -> std::string_view { return text_; }
+
+    protected:
+        auto overflow(int_type c) -> int_type override {
+            if (!traits_type::eq_int_type(c, traits_type::eof())) {
+                text_.push_back(traits_type::to_char_type(c));
+            }
+            return traits_type::not_eof(c);
+        }
+
+        auto xsputn(const char_type* text, std::streamsize count) -> std::streamsize override {
+            text_.append(text, static_cast<std::size_t>(count));
+            return count;
+        }
+
+    private:
+        std::string text_;
+    };
+
+    StringBuffer buffer_;
+    std::ostream stream_;
+};
+
+/**
+ * @brief Format a message through operator<< with the reused MessageStream of the calling thread.
+ *
+ * A message formatted while another one is, e.g. by an operator<< that logs, gets its own stream.
+ *
+ * @param write Writes the message to the std::ostream it is given.
+ */
+template <typename Write>
+auto formatWithThreadStream(Write&& write) -> std::string {
+    thread_local MessageStream threadStream;
+    thread_local bool inUse = false;
+    if (inUse) {
+        MessageStream own;
+        std::forward<Write>(write)(own.stream());
+        return std::string(own.view());
+    }
+
+    inUse = true;
+    try {
+        threadStream.reset();
+        std::forward<Write>(write)(threadStream.stream());
+    } catch (...) {
+        inUse = false;
+        throw;
+    }
+    inUse = false;
+    return std::string(threadStream.view());
+}
+
+}  // namespace palantir::logging
@@ -2,33 +2,20 @@
 #define LOGGER_HPP
 
 #include <source_location>
-#include <sstream>
-#include <string>
-#include <string_view>
 
-#include "core_export.hpp"
-
-namespace palantir::utils {
-
-void PALANTIR_CORE_API PlatformLog(std::string_view function, int line, const std::string& message);
-
-template <typename T, typename... Args>
-auto PALANTIR_CORE_API LogStream(std::ostringstream& stream, const T& value, const Args&... args) -> void {
-    stream << value;  // NOLINT
-    (stream << ... << args);
-}
-}  // namespace palantir::utils
+#include "logging/log_macros.hpp"
+#include "logging/logger.hpp"
 
+/**
+ * Log the concatenation of the arguments at debug level. The arguments are copied and written by
+ * the logger thread, see palantir::logging::Logger. Prefer the PALANTIR_LOG_* macros for new code.
+ */
 template <typename... Args>
-auto PALANTIR_CORE_API DebugLog(const std::source_location& location, const Args&... args) -> void {
-    std::ostringstream stream;
-    palantir::utils::LogStream(stream, args...);
-    palantir::utils::PlatformLog(location.function_name(), location.line(), stream.str());
+auto DebugLogAt(const std::source_location& location, const Args&... args) -> void {
+    palantir::logging::Logger::getInstance()->log(palantir::logging::LogLevel::DBG, location, args...);
 }
 
-template <typename... Args>
-auto PALANTIR_CORE_API DebugLog(const Args&... args) -> void {
-    DebugLog(std::source_location::current(), args...);
-}
+// A macro so the location is the caller's, a defaulted argument cannot follow the variadic ones
+#define DebugLog(...) DebugLogAt(std::source_location::current(), __VA_ARGS__)
 
-#endif  // LOGGER_HPP
\ No newline at end of file
+#endif  // LOGGER_HPP
@@ -1,9 +1,22 @@
 #ifndef LOGGER_HPP
 #define LOGGER_HPP
 
-// Declaration only
-void platform_log(const char* function, int line, const char* format, ...);
+#include <source_location>
 
-#define DebugLog(format, ...)
+#include "logging/log_macros.hpp"
+#include "logging/logger.hpp"
 
-#endif  // LOGGER_HPP
\ No newline at end of file
+/**
+ * Log the concatenation of the arguments at debug level. Release builds default to the info level,
+ * so the call costs a level check unless PALANTIR_LOG_LEVEL or Logger::setLevel lowers it. Prefer the
+ * PALANTIR_LOG_* macros for new code, they compile to nothing below PALANTIR_LOG_ACTIVE_LEVEL.
+ */
+template <typename... Args>
+auto DebugLogAt(const std::source_location& location, const Args&... args) -> void {
+    palantir::logging::Logger::getInstance()->log(palantir::logging::LogLevel::DBG, location, args...);
+}
+
+// A macro so the location is the caller's, a defaulted argument cannot follow the variadic ones
+#define DebugLog(...) DebugLogAt(std::source_location::current(), __VA_ARGS__)
+
+#endif  // LOGGER_HPP
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <core_export.hpp>
+
+namespace palantir::signal {
+
+/**
+ * @brief Linux specialization of KeyboardHookTypes
+ *
+ * Linux has no global keyboard hook the overlay could install, so these only keep the signal
+ * code compiling for headless builds such as the benchmarks.
+ */
+struct KeyboardHookTypes {
+    using HookHandle = void*;
+    using HookProcedure = void*;
+    using ModuleHandle = void*;
+    using ThreadId = unsigned long;
+    using HookResult = long;
+    using HookCode = int;
+    using MessageParam = unsigned long;
+    using LongParam = long;
+    using BoolResult = bool;
+    using ModuleStringType = const char*;
+};
+
+/**
+ * @brief Linux implementation of the keyboard API, installing no hook
+ */
+class PALANTIR_CORE_API KeyboardApi {
+public:
+    using HookHandle = KeyboardHookTypes::HookHandle;
+    using HookProcedure = KeyboardHookTypes::HookProcedure;
+    using ModuleHandle = KeyboardHookTypes::ModuleHandle;
+    using ThreadId = KeyboardHookTypes::ThreadId;
+    using ModuleStringType = KeyboardHookTypes::ModuleStringType;
+
+    /**
+     * @brief Set a keyboard hook, not supported on Linux
+     * @return Always nullptr
+     */
+    HookHandle SetHook([[maybe_unused]] int idHook, [[maybe_unused]] HookProcedure lpfn,
+                       [[maybe_unused]] ModuleHandle hMod, [[maybe_unused]] ThreadId dwThreadId) const {
+        return nullptr;
+    }
+
+    /**
+     * @brief Remove a keyboard hook, not supported on Linux
+     * @return Always false
+     */
+    KeyboardHookTypes::BoolResult UnhookKeyboard([[maybe_unused]] HookHandle hhk) const { return false; }
+
+    /**
+     * @brief Call the next hook in the chain, not supported on Linux
+     * @return Always 0
+     */
+    KeyboardHookTypes::HookResult CallNextHook([[maybe_unused]] HookHandle hhk,
+                                               [[maybe_unused]] KeyboardHookTypes::HookCode nCode,
+                                               [[maybe_unused]] KeyboardHookTypes::MessageParam wParam,
+                                               [[maybe_unused]] KeyboardHookTypes::LongParam lParam) const {
+        return 0;
+    }
+
+    /**
+     * @brief Get the module handle of the current process, not supported on Linux
+     * @return Always nullptr
+     */
+    ModuleHandle GetModuleOSHandle([[maybe_unused]] ModuleStringType moduleName) const { return nullptr; }
+};
+}  // namespace palantir::signal
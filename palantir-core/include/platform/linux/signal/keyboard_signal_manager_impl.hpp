@@ -0,0 +1,79 @@
+#include <vector>
+
+#include "signal/isignal.hpp"
+#include "signal/keyboard_api.hpp"
+#include "signal/keyboard_signal_manager.hpp"
+#include "signal/signal_table.hpp"
+#include "utils/logger.hpp"
+
+namespace palantir::signal {
+
+/**
+ * @brief Linux implementation of SignalManager
+ *
+ * No keyboard hook is installed, signals are only checked when checkSignals() is called. Enough for
+ * headless runs, the overlay itself only runs on Windows and macOS.
+ */
+class KeyboardSignalManager::KeyboardSignalManagerImpl {
+public:
+    /**
+     * @brief Construct the implementation
+     * @param keyboardApi Keyboard API wrapper, kept for parity with the other platforms
+     */
+    explicit KeyboardSignalManagerImpl(std::unique_ptr<KeyboardApi> keyboardApi)
+        : keyboardApi_(std::move(keyboardApi)) {
+        DebugLog("Initializing SignalManager implementation for Linux, without keyboard hook");
+    }
+
+    KeyboardSignalManagerImpl(const KeyboardSignalManagerImpl&) = delete;
+    auto operator=(const KeyboardSignalManagerImpl&) -> KeyboardSignalManagerImpl& = delete;
+    KeyboardSignalManagerImpl(KeyboardSignalManagerImpl&&) = delete;
+    auto operator=(KeyboardSignalManagerImpl&&) -> KeyboardSignalManagerImpl& = delete;
+
+    ~KeyboardSignalManagerImpl() = default;
+
+    /**
+     * @brief Add a signal to the collection
+     */
+    auto addSignal(std::unique_ptr<ISignal> signal) -> void { signals_.add(std::move(signal)); }
+
+    /**
+     * @brief Check if the manager has any signals
+     * @return true if signals_ is not empty, false otherwise
+     */
+    auto hasSignals() const -> bool { return !signals_.empty(); }
+
+    /**
+     * @brief Start all signals
+     */
+    auto startSignals() const -> void { signals_.start(); }
+
+    /**
+     * @brief Stop all signals
+     */
+    auto stopSignals() const -> void { signals_.stop(); }
+
+    /**
+     * @brief Check all signals
+     */
+    auto checkSignals(const std::any& event) const -> void { signals_.check(event); }
+
+    /**
+     * @brief Replace all signals
+     */
+    auto replaceSignals(SignalTable::Signals signals) -> void {
+        // Signals attached later are created from the commands registered by then
+        if (signals_.empty()) {
+            return;
+        }
+        signals_.replace(std::move(signals));
+    }
+
+private:
+    /// Collection of managed signals, replaced at once when plugins are reloaded
+    SignalTable signals_;
+    /// Unused, no hook is installed
+    std::unique_ptr<KeyboardApi> keyboardApi_;
+};
+
+}  // namespace palantir::signal
@@ -3,6 +3,7 @@
 #include "signal/isignal.hpp"
 #include "signal/keyboard_api.hpp"
 #include "signal/keyboard_signal_manager.hpp"
+#include "signal/signal_table.hpp"
 #include "utils/logger.hpp"
 
 namespace palantir::signal {
@@ -54,7 +55,7 @@ public:
     /**
      * @brief Add a signal to the collection
      */
-    auto addSignal(std::unique_ptr<ISignal> signal) -> void { signals_.push_back(std::move(signal)); }
+    auto addSignal(std::unique_ptr<ISignal> signal) -> void { signals_.add(std::move(signal)); }
 
     /**
      * @brief Check if the manager has any signals
@@ -65,28 +66,27 @@ public:
     /**
      * @brief Start all signals
      */
-    auto startSignals() const -> void {
-        for (const auto& signal : signals_) {
-            signal->start();
-        }
-    }
+    auto startSignals() const -> void { signals_.start(); }
 
     /**
      * @brief Stop all signals
      */
-    auto stopSignals() const -> void {
-        for (const auto& signal : signals_) {
-            signal->stop();
-        }
-    }
+    auto stopSignals() const -> void { signals_.stop(); }
 
     /**
      * @brief Check all signals
      */
-    auto checkSignals(const std::any& event) const -> void {
-        for (const auto& signal : signals_) {
-            signal->check(event);
+    auto checkSignals(const std::any& event) const -> void { signals_.check(event); }
+
+    /**
+     * @brief Replace all signals while the hook keeps running
+     */
+    auto replaceSignals(SignalTable::Signals signals) -> void {
+        // Signals attached later are created from the commands registered by then
+        if (signals_.empty()) {
+            return;
         }
+        signals_.replace(std::move(signals));
     }
 
 private:
@@ -105,8 +105,8 @@ private:
 
     /// Platform-specific hook handle
     HookHandleType hook_{nullptr};
-    /// Collection of managed signals
-    std::vector<std::unique_ptr<ISignal>> signals_;
+    /// Collection of managed signals, replaced at once when plugins are reloaded
+    SignalTable signals_;
     /// Platform-specific keyboard API implementation
     std::unique_ptr<KeyboardApi> keyboardApi_;
     /// Singleton instance for callback access
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #ifdef _WIN32
 #ifdef PALANTIR_CORE_EXPORTS
@@ -19,6 +20,9 @@ namespace palantir::plugin {
 
 /**
  * @brief Interface that all plugins must implement
+ *
+ * It does not cross the library boundary: IMPLEMENT_PLUGIN exports the plugin through the C
+ * interface of plugin_abi.h and the host implements IPlugin again on top of it.
  */
 class PALANTIR_CORE_API IPlugin {
 public:
@@ -52,17 +56,32 @@ public:
      * @return Plugin version string
      */
     [[nodiscard]] virtual auto getVersion() const -> std::string = 0;
-};
 
-// Plugin creation/destruction function types
-using CreatePluginFunc = PLUGIN_API IPlugin* (*)();
-using DestroyPluginFunc = PLUGIN_API void (*)(IPlugin*);
+    /**
+     * @brief Get the plugins that must be initialized before this one
+     * @return Names of the plugins this one depends on, as returned by their getName()
+     */
+    [[nodiscard]] virtual auto getDependencies() const -> std::vector<std::string> { return {}; }
 
-}  // namespace palantir::plugin
+    /**
+     * @brief Get the commands the plugin registers in CommandFactory when initialized
+     *
+     * A plugin listing its commands, and doing nothing else when initialized, can have its library
+     * loaded on the first execution of one of them instead of at startup.
+     *
+     * @return Names of the registered commands, empty to always load the plugin at startup
+     */
+    [[nodiscard]] virtual auto getProvidedCommands() const -> std::vector<std::string> { return {}; }
 
-// Macros to help with plugin implementation
-#define IMPLEMENT_PLUGIN(PluginClass)                                                           \
-    extern "C" {                                                                                \
-    PLUGIN_API auto createPlugin() -> palantir::plugin::IPlugin* { return new PluginClass(); }  \
-    PLUGIN_API auto destroyPlugin(palantir::plugin::IPlugin* plugin) -> void { delete plugin; } \
-    }
\ No newline at end of file
+    /**
+     * @brief Get the provided commands that use debounce
+     *
+     * Recorded in the manifest with getProvidedCommands(), so the host knows how to bind them
+     * without creating them.
+     *
+     * @return Names among getProvidedCommands() whose command returns true from useDebounce()
+     */
+    [[nodiscard]] virtual auto getDebouncedCommands() const -> std::vector<std::string> { return {}; }
+};
+
+}  // namespace palantir::plugin
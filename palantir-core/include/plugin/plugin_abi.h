@@ -0,0 +1,112 @@
+/**
+ * @file plugin_abi.h
+ * @brief C interface between the application and its plugin libraries.
+ *
+ * Only C types cross the library boundary, so a plugin does not depend on the compiler or the
+ * standard library the application was built with. A plugin library exports
+ * palantirCreatePlugin(), which receives the capability table of the host and fills the function
+ * table of the plugin.
+ *
+ * PALANTIR_PLUGIN_ABI_VERSION changes on every incompatible change. Both sides require a table of
+ * at least the size they were built with, so compatible additions append functions at the end of a
+ * table and grow its size field.
+ *
+ * Strings are passed as views, never freed by the receiver. Integers returned as int are
+ * booleans, non zero meaning success. No function lets an exception escape.
+ */
+
+#ifndef PALANTIR_PLUGIN_ABI_H
+#define PALANTIR_PLUGIN_ABI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PALANTIR_PLUGIN_ABI_VERSION 1U
+#define PALANTIR_CREATE_PLUGIN_SYMBOL "palantirCreatePlugin"
+
+/** @brief Characters that are not null terminated */
+typedef struct PalantirStringView {
+    const char* data;
+    size_t size;
+} PalantirStringView;
+
+/** @brief Levels of PalantirHostApi::log, in the order of palantir::logging::LogLevel */
+typedef enum PalantirLogLevel {
+    PALANTIR_PLUGIN_LOG_TRACE = 0,
+    PALANTIR_PLUGIN_LOG_DEBUG = 1,
+    PALANTIR_PLUGIN_LOG_INFO = 2,
+    PALANTIR_PLUGIN_LOG_WARN = 3,
+    PALANTIR_PLUGIN_LOG_ERROR = 4
+} PalantirLogLevel;
+
+/** @brief A command created by a plugin, owned by the host until it calls destroy */
+typedef struct PalantirCommand {
+    void* self;
+    /* Returns 0 if the command failed, with error describing why until the next call on the same thread */
+    int (*execute)(void* self, PalantirStringView* error);
+    int (*useDebounce)(const void* self);
+    void (*destroy)(void* self);
+} PalantirCommand;
+
+/** @brief Fills command with a new command, returns 0 if none could be created */
+typedef int (*PalantirCreateCommandFunc)(void* context, PalantirCommand* command);
+
+/** @brief Frees a context handed over to the host */
+typedef void (*PalantirReleaseFunc)(void* context);
+
+/** @brief Capabilities the host offers to plugins, valid as long as the plugin is loaded */
+typedef struct PalantirHostApi {
+    uint32_t abiVersion;
+    uint32_t size;
+    void* context;
+
+    /**
+     * Register a command, replacing any command of the same name. The host calls create with
+     * createContext each time the command is needed, and release with createContext once the
+     * command is unregistered or replaced, or right away if it cannot be registered.
+     */
+    int (*registerCommand)(void* context, PalantirStringView name, PalantirCreateCommandFunc create,
+                           void* createContext, PalantirReleaseFunc release);
+    int (*unregisterCommand)(void* context, PalantirStringView name);
+    /* level is a PalantirLogLevel, passed as a fixed size integer */
+    void (*log)(void* context, int32_t level, PalantirStringView message);
+} PalantirHostApi;
+
+/**
+ * @brief A plugin, filled by palantirCreatePlugin()
+ *
+ * The views returned stay valid until destroy is called.
+ */
+typedef struct PalantirPluginApi {
+    uint32_t abiVersion;
+    uint32_t size;
+    void* self;
+
+    int (*initialize)(void* self);
+    void (*shutdown)(void* self);
+    PalantirStringView (*getName)(const void* self);
+    PalantirStringView (*getVersion)(const void* self);
+    size_t (*getDependencyCount)(const void* self);
+    PalantirStringView (*getDependency)(const void* self, size_t index);
+    size_t (*getProvidedCommandCount)(const void* self);
+    PalantirStringView (*getProvidedCommand)(const void* self, size_t index);
+    void (*destroy)(void* self);
+    size_t (*getDebouncedCommandCount)(const void* self);
+    PalantirStringView (*getDebouncedCommand)(const void* self, size_t index);
+} PalantirPluginApi;
+
+/**
+ * @brief Entry point exported by plugin libraries as PALANTIR_CREATE_PLUGIN_SYMBOL
+ * @return 0 if the plugin could not be created or does not support the version of the host
+ */
+typedef int (*PalantirCreatePluginFunc)(const PalantirHostApi* host, PalantirPluginApi* plugin);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PALANTIR_PLUGIN_ABI_H */
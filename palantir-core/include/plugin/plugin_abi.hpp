@@ -0,0 +1,242 @@
+/**
+ * @file plugin_abi.hpp
+ * @brief Plugin side of the C plugin interface.
+ *
+ * Compiled into each plugin library, it exports an IPlugin through the tables of plugin_abi.h, so
+ * plugins keep implementing IPlugin and registering ICommand creators while only C types cross the
+ * library boundary.
+ */
+
+#pragma once
+
+#include <exception>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "command/command_factory.hpp"
+#include "command/icommand.hpp"
+#include "plugin/iplugin.hpp"
+#include "plugin/plugin_abi.h"
+
+namespace palantir::plugin::abi {
+
+[[nodiscard]] inline auto toView(std::string_view text) -> PalantirStringView { return {text.data(), text.size()}; }
+
+[[nodiscard]] inline auto toStringView(PalantirStringView view) -> std::string_view {
+    return view.data != nullptr ? std::string_view(view.data, view.size) : std::string_view();
+}
+
+namespace detail {
+
+using CommandCreator = command::CommandFactory::CommandCreator;
+
+// Why the last command executed on this thread failed, handed to the host as a view
+inline auto lastError() -> std::string& {
+    thread_local std::string error;
+    return error;
+}
+
+inline auto executeCommand(void* self, PalantirStringView* error) -> int {
+    try {
+        try {
+            static_cast<const command::ICommand*>(self)->execute();
+            return 1;
+        } catch (const std::exception& e) {
+            lastError() = e.what();
+        } catch (...) {
+            lastError() = "unknown error";
+        }
+    } catch (...) {
+        lastError().clear();
+    }
+    if (error != nullptr) {
+        *error = toView(lastError());
+    }
+    return 0;
+}
+
+inline auto useDebounce(const void* self) -> int {
+    try {
+        return static_cast<const command::ICommand*>(self)->useDebounce() ? 1 : 0;
+    } catch (...) {
+        return 0;
+    }
+}
+
+inline auto destroyCommand(void* self) -> void { delete static_cast<command::ICommand*>(self); }
+
+inline auto createCommand(void* context, PalantirCommand* command) -> int {
+    try {
+        auto created = (*static_cast<const CommandCreator*>(context))();
+        if (!created) {
+            return 0;
+        }
+        *command = PalantirCommand{created.release(), &executeCommand, &useDebounce, &destroyCommand};
+        return 1;
+    } catch (...) {
+        return 0;
+    }
+}
+
+inline auto releaseCreator(void* context) -> void { delete static_cast<CommandCreator*>(context); }
+
+}  // namespace detail
+
+/**
+ * @brief Capabilities of the host, as seen by a plugin
+ *
+ * A plugin class constructible from a Host receives it when created, and uses it instead of the
+ * host singletons.
+ */
+class Host {
+public:
+    explicit Host(const PalantirHostApi* api) : api_(api) {}
+
+    /**
+     * @brief Register a command in the host
+     * @param name Name of the command, as bound in the shortcuts configuration
+     * @param creator Creates the command, called by the host each time it needs one
+     * @return false if the host refused the command
+     */
+    auto registerCommand(std::string_view name, detail::CommandCreator creator) const -> bool {
+        auto* context = new detail::CommandCreator(std::move(creator));
+        return api_->registerCommand(api_->context, toView(name), &detail::createCommand, context,
+                                     &detail::releaseCreator) != 0;
+    }
+
+    /**
+     * @brief Unregister a command registered by registerCommand()
+     * @return false if no command has this name
+     */
+    auto unregisterCommand(std::string_view name) const -> bool {
+        return api_->unregisterCommand(api_->context, toView(name)) != 0;
+    }
+
+    /**
+     * @brief Write a message in the log of the host
+     */
+    auto log(PalantirLogLevel level, std::string_view message) const -> void {
+        api_->log(api_->context, static_cast<int32_t>(level), toView(message));
+    }
+
+private:
+    const PalantirHostApi* api_;
+};
+
+/**
+ * @brief Exports a plugin class through a PalantirPluginApi
+ *
+ * getName(), getVersion(), getDependencies(), getProvidedCommands() and getDebouncedCommands() are
+ * queried once, when the plugin is created, so the views handed to the host stay valid until it is destroyed.
+ */
+template <typename PluginClass>
+class PluginExport {
+    static_assert(std::is_base_of_v<IPlugin, PluginClass>, "Plugins must implement IPlugin");
+
+public:
+    /**
+     * @brief Create the plugin and fill its table, see PalantirCreatePluginFunc
+     */
+    static auto create(const PalantirHostApi* host, PalantirPluginApi* api) -> int {
+        if (host == nullptr || api == nullptr || host->abiVersion != PALANTIR_PLUGIN_ABI_VERSION ||
+            host->size < sizeof(PalantirHostApi)) {
+            return 0;
+        }
+        try {
+            auto* exported = new PluginExport(Host(host));
+            *api = PalantirPluginApi{PALANTIR_PLUGIN_ABI_VERSION,
+                                     sizeof(PalantirPluginApi),
+                                     exported,
+                                     &initialize,
+                                     &shutdown,
+                                     &getName,
+                                     &getVersion,
+                                     &getDependencyCount,
+                                     &getDependency,
+                                     &getProvidedCommandCount,
+                                     &getProvidedCommand,
+                                     &destroy,
+                                     &getDebouncedCommandCount,
+                                     &getDebouncedCommand};
+            return 1;
+        } catch (...) {
+            return 0;
+        }
+    }
+
+private:
+    explicit PluginExport(Host host)
+        : plugin_(makePlugin(host)),
+          name_(plugin_->getName()),
+          version_(plugin_->getVersion()),
+          dependencies_(plugin_->getDependencies()),
+          commands_(plugin_->getProvidedCommands()),
+          debounced_(plugin_->getDebouncedCommands()) {}
+
+    static auto makePlugin(Host host) -> std::unique_ptr<PluginClass> {
+        if constexpr (std::is_constructible_v<PluginClass, Host>) {
+            return std::make_unique<PluginClass>(host);
+        } else {
+            return std::make_unique<PluginClass>();
+        }
+    }
+
+    static auto get(const void* self) -> const PluginExport& { return *static_cast<const PluginExport*>(self); }
+
+    static auto at(const std::vector<std::string>& names, size_t index) -> PalantirStringView {
+        return index < names.size() ? toView(names[index]) : PalantirStringView{nullptr, 0};
+    }
+
+    static auto initialize(void* self) -> int {
+        try {
+            return static_cast<PluginExport*>(self)->plugin_->initialize() ? 1 : 0;
+        } catch (...) {
+            return 0;
+        }
+    }
+
+    static auto shutdown(void* self) -> void {
+        try {
+            static_cast<PluginExport*>(self)->plugin_->shutdown();
+        } catch (...) {
+            // Nothing the host could do about it
+        }
+    }
+
+    static auto getName(const void* self) -> PalantirStringView { return toView(get(self).name_); }
+    static auto getVersion(const void* self) -> PalantirStringView { return toView(get(self).version_); }
+    static auto getDependencyCount(const void* self) -> size_t { return get(self).dependencies_.size(); }
+    static auto getDependency(const void* self, size_t index) -> PalantirStringView {
+        return at(get(self).dependencies_, index);
+    }
+    static auto getProvidedCommandCount(const void* self) -> size_t { return get(self).commands_.size(); }
+    static auto getProvidedCommand(const void* self, size_t index) -> PalantirStringView {
+        return at(get(self).commands_, index);
+    }
+    static auto getDebouncedCommandCount(const void* self) -> size_t { return get(self).debounced_.size(); }
+    static auto getDebouncedCommand(const void* self, size_t index) -> PalantirStringView {
+        return at(get(self).debounced_, index);
+    }
+    static auto destroy(void* self) -> void { delete static_cast<PluginExport*>(self); }
+
+    std::unique_ptr<PluginClass> plugin_;
+    std::string name_;
+    std::string version_;
+    std::vector<std::string> dependencies_;
+    std::vector<std::string> commands_;
+    std::vector<std::string> debounced_;
+};
+
+}  // namespace palantir::plugin::abi
+
+// Export a plugin class from its library, once per library
+#define IMPLEMENT_PLUGIN(PluginClass)                                                                        \
+    extern "C" PLUGIN_API auto palantirCreatePlugin(const PalantirHostApi* host, PalantirPluginApi* plugin) \
+        -> int {                                                                                              \
+        static_assert(std::is_same_v<decltype(&palantirCreatePlugin), PalantirCreatePluginFunc>);             \
+        return palantir::plugin::abi::PluginExport<PluginClass>::create(host, plugin);                       \
+    }
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "core_export.hpp"
+#include "plugin/plugin_abi.h"
+
+namespace palantir::plugin {
+
+/**
+ * @brief Host side of the C plugin interface
+ *
+ * Backs the capability table handed to plugins by the CommandFactory and Logger instances current
+ * when a plugin calls it. Commands created by plugins are wrapped in an ICommand calling them
+ * through their PalantirCommand.
+ */
+class PALANTIR_CORE_API PluginHost {
+public:
+    PluginHost() = delete;
+
+    /**
+     * @brief Get the capability table to pass to palantirCreatePlugin()
+     * @return A table living as long as the process
+     */
+    static auto getApi() -> const PalantirHostApi*;
+};
+
+}  // namespace palantir::plugin
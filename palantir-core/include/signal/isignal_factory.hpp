@@ -53,6 +53,14 @@ public:
      */
     [[nodiscard]] virtual auto createSignals() const -> std::vector<std::unique_ptr<ISignal>> = 0;
 
+    /**
+     * @brief Read the configuration signals are created from, ahead of createSignals().
+     *
+     * Lets the configuration be parsed while plugins are still registering their commands. The
+     * next createSignals() call uses it instead of reading it again. Does nothing by default.
+     */
+    virtual auto loadConfiguration() const -> void {}
+
 protected:
     /** @brief Protected default constructor to prevent direct instantiation. */
     ISignalFactory() = default;
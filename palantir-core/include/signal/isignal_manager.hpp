@@ -39,6 +39,13 @@ public:
      */
     virtual auto startSignals() const -> void = 0;
 
+    /**
+     * @brief Prepare what startSignals() needs and that does not depend on commands.
+     *
+     * Can run on any thread, concurrently with plugin loading. Does nothing by default.
+     */
+    virtual auto prepareSignals() const -> void {}
+
     /**
      * @brief Stop processing all managed signals.
      */
@@ -49,6 +56,14 @@ public:
      */
     virtual auto checkSignals(const std::any& event) const -> void = 0;
 
+    /**
+     * @brief Recreate all signals, with their commands, and swap them in at once.
+     *
+     * Returns once no check runs on the previous signals anymore, so the commands they held
+     * can be unloaded. Must not be called from a command.
+     */
+    virtual auto rebindSignals() const -> void = 0;
+
 protected:
     ISignalManager() = default;
 };
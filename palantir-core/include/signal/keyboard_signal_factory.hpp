@@ -59,6 +59,11 @@ public:
      */
     [[nodiscard]] virtual auto createSignals() const -> std::vector<std::unique_ptr<ISignal>>;
 
+    /**
+     * @brief Read the shortcut configuration ahead of createSignals().
+     */
+    auto loadConfiguration() const -> void override;
+
 private:
     class KeyboardSignalFactoryImpl;
 #pragma warning(push)
@@ -73,6 +73,11 @@ public:
      */
     auto startSignals() const -> void override;
 
+    /**
+     * @brief Read the shortcut configuration through the factory.
+     */
+    auto prepareSignals() const -> void override;
+
     /**
      * @brief Stop processing all managed signals.
      */
@@ -83,6 +88,11 @@ public:
      */
     auto checkSignals(const std::any& event) const -> void override;
 
+    /**
+     * @brief Recreate all signals from the factory and swap them in at once.
+     */
+    auto rebindSignals() const -> void override;
+
 private:
     // Forward declaration of platform-specific implementation
     class KeyboardSignalManagerImpl;
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <any>
+#include <memory>
+#include <vector>
+
+#include "core_export.hpp"
+#include "signal/isignal.hpp"
+
+namespace palantir::signal {
+
+/**
+ * @class SignalTable
+ * @brief Set of signals checked on every input event, replaceable while events are being checked.
+ *
+ * Checks run on a snapshot of the table. replace() installs the new signals at once, stops the
+ * previous ones, then waits for the checks still running on them before destroying them, so the
+ * commands they hold can be unloaded right after.
+ */
+class PALANTIR_CORE_API SignalTable {
+public:
+    using Signals = std::vector<std::unique_ptr<ISignal>>;
+
+    SignalTable();
+    ~SignalTable();
+
+    SignalTable(const SignalTable&) = delete;
+    auto operator=(const SignalTable&) -> SignalTable& = delete;
+    SignalTable(SignalTable&&) = delete;
+    auto operator=(SignalTable&&) -> SignalTable& = delete;
+
+    /** @brief Add a signal to the current table. */
+    auto add(std::unique_ptr<ISignal> signal) -> void;
+
+    /** @brief Whether the table holds no signal. */
+    [[nodiscard]] auto empty() const -> bool;
+
+    /** @brief Start every signal, and the signals of later tables. */
+    auto start() const -> void;
+
+    /** @brief Stop every signal. */
+    auto stop() const -> void;
+
+    /** @brief Check every signal against an event. */
+    auto check(const std::any& event) const -> void;
+
+    /**
+     * @brief Replace every signal at once.
+     *
+     * Blocks until no check runs on the previous signals anymore, so it must not be called from a
+     * command executed by a check.
+     *
+     * @param signals The new signals, started if the table is started. The previous ones are stopped.
+     */
+    auto replace(Signals signals) -> void;
+
+private:
+    class SignalTableImpl;
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::unique_ptr<SignalTableImpl> pimpl_;
+#pragma warning(pop)
+};
+
+}  // namespace palantir::signal
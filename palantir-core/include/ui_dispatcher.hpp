@@ -0,0 +1,159 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "core_export.hpp"
+
+namespace palantir {
+
+/**
+ * @brief Counters and enqueue-to-run latencies of the UI dispatcher.
+ */
+struct PALANTIR_CORE_API UiDispatcherStats {
+    uint64_t posted{0};
+    uint64_t executed{0};
+    // Tasks that threw, their exception is logged and dropped
+    uint64_t failed{0};
+    // Tasks that waited longer than the starvation threshold
+    uint64_t starved{0};
+    std::size_t pending{0};
+    std::size_t samples{0};
+    std::chrono::microseconds maxLatency{0};
+    std::optional<std::chrono::microseconds> p50;
+    std::optional<std::chrono::microseconds> p95;
+    std::optional<std::chrono::microseconds> p99;
+};
+
+/**
+ * @class UiDispatcher
+ * @brief Marshals work from any thread to the UI thread.
+ *
+ * Window, webview and content calls must run on the thread owning the message loop. Other
+ * threads post tasks here and the UI loop drains them. The loop is told about new tasks through
+ * a wakeup callback set by the platform: a registered window message on Windows, the main
+ * dispatch queue on macOS. Without a wakeup, runLoop() provides a simple blocking loop, e.g.
+ * for headless runs and tests. The wakeup is only called when the queue stops being empty, so a
+ * burst of posts costs a single platform message.
+ *
+ * The time each task waits between post and run is recorded, a growing latency means the UI
+ * thread is starved.
+ */
+class PALANTIR_CORE_API UiDispatcher {
+public:
+    using Task = std::function<void()>;
+    using Wakeup = std::function<void()>;
+
+    static constexpr std::size_t DEFAULT_LATENCY_WINDOW = 256;
+    static constexpr std::chrono::milliseconds DEFAULT_STARVATION_THRESHOLD{100};
+
+    /**
+     * @brief Create a dispatcher bound to the calling thread.
+     *
+     * @param latencyWindow Number of recent latencies the percentiles are computed on.
+     */
+    explicit UiDispatcher(std::size_t latencyWindow = DEFAULT_LATENCY_WINDOW);
+    ~UiDispatcher();
+
+    UiDispatcher(const UiDispatcher&) = delete;
+    auto operator=(const UiDispatcher&) -> UiDispatcher& = delete;
+    UiDispatcher(UiDispatcher&&) = delete;
+    auto operator=(UiDispatcher&&) -> UiDispatcher& = delete;
+
+    /**
+     * @brief Make the calling thread the UI thread.
+     */
+    auto attachToCurrentThread() -> void;
+
+    [[nodiscard]] auto isUiThread() const -> bool;
+
+    /**
+     * @brief Set the callback asking the UI loop to call drain(), it may be called from any thread.
+     *
+     * Called at once if tasks were posted before, so they do not wait for the next post.
+     */
+    auto setWakeup(Wakeup wakeup) -> void;
+
+    /**
+     * @brief Set the latency above which a task is counted, and logged, as starved.
+     */
+    auto setStarvationThreshold(std::chrono::microseconds threshold) -> void;
+
+    /**
+     * @brief Queue a task for the UI thread, even when called from it.
+     */
+    auto post(Task task) -> void;
+
+    /**
+     * @brief Queue a task for the UI thread once a delay has passed.
+     *
+     * The delay is counted by a timer thread started on the first call, then the task is posted
+     * like any other. Tasks still waiting when the dispatcher is destroyed never run.
+     */
+    auto postAfter(std::chrono::milliseconds delay, Task task) -> void;
+
+    /**
+     * @brief Run a task now when called from the UI thread, otherwise queue it.
+     */
+    auto dispatch(Task task) -> void;
+
+    /**
+     * @brief Queue a callable for the UI thread and get its result.
+     *
+     * Called from the UI thread, the callable runs at once: waiting on a queued task there
+     * would never return.
+     *
+     * @return A future holding the result, or the exception, of the callable.
+     */
+    template <typename F>
+    auto await(F&& function) -> std::future<std::invoke_result_t<std::decay_t<F>&>> {
+        using Result = std::invoke_result_t<std::decay_t<F>&>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(function));
+        auto future = task->get_future();
+        if (isUiThread()) {
+            (*task)();
+        } else {
+            post([task]() { (*task)(); });
+        }
+        return future;
+    }
+
+    /**
+     * @brief Run the tasks queued so far, on the UI thread.
+     *
+     * Tasks posted while draining wait for the next call, so a task posting itself cannot
+     * block the loop.
+     *
+     * @return The number of tasks run.
+     */
+    auto drain() -> std::size_t;
+
+    /**
+     * @brief Attach to the calling thread and run queued tasks until stop() is called.
+     */
+    auto runLoop() -> void;
+
+    /**
+     * @brief Make runLoop() return once the task in progress, if any, ends.
+     */
+    auto stop() -> void;
+
+    [[nodiscard]] auto getStats() const -> UiDispatcherStats;
+
+    auto resetStats() -> void;
+
+private:
+    class UiDispatcherImpl;
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::unique_ptr<UiDispatcherImpl> pimpl_;
+#pragma warning(pop)
+};
+
+}  // namespace palantir
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#if __has_include(<expected>)
+#include <expected>
+#endif
+
+namespace palantir::utils {
+
+#if defined(__cpp_lib_expected)
+
+/**
+ * @brief A value or the error explaining why there is none, returned by lookups whose miss is expected.
+ */
+template <typename T, typename E>
+using Expected = std::expected<T, E>;
+
+template <typename E>
+using Unexpected = std::unexpected<E>;
+
+#else
+
+/**
+ * @brief The error alternative of an Expected, as std::unexpected.
+ */
+template <typename E>
+class Unexpected {
+public:
+    constexpr explicit Unexpected(E error) : error_(std::move(error)) {}
+
+    [[nodiscard]] constexpr auto error() const& -> const E& { return error_; }
+    [[nodiscard]] constexpr auto error() && -> E&& { return std::move(error_); }
+
+private:
+    E error_;
+};
+
+/**
+ * @brief A value or the error explaining why there is none, returned by lookups whose miss is expected.
+ *
+ * The subset of std::expected used in the tree, for standard libraries that do not have it yet.
+ */
+template <typename T, typename E>
+class Expected {
+public:
+    using value_type = T;
+    using error_type = E;
+
+    constexpr Expected()
+        requires std::is_default_constructible_v<T>
+        : storage_(std::in_place_index<0>) {}
+
+    template <typename U = T>
+        requires(std::is_constructible_v<T, U &&> && !std::is_same_v<std::remove_cvref_t<U>, Expected>)
+    constexpr Expected(U&& value)  // NOLINT(google-explicit-constructor)
+        : storage_(std::in_place_index<0>, std::forward<U>(value)) {}
+
+    template <typename G>
+    constexpr Expected(Unexpected<G> error)  // NOLINT(google-explicit-constructor)
+        : storage_(std::in_place_index<1>, std::move(error).error()) {}
+
+    [[nodiscard]] constexpr auto has_value() const -> bool { return storage_.index() == 0; }  // NOLINT
+
+    constexpr explicit operator bool() const { return has_value(); }
+
+    [[nodiscard]] constexpr auto value() const& -> const T& {
+        if (!has_value()) {
+            throw std::logic_error("Expected has no value");
+        }
+        return std::get<0>(storage_);
+    }
+
+    [[nodiscard]] constexpr auto value() && -> T&& {
+        if (!has_value()) {
+            throw std::logic_error("Expected has no value");
+        }
+        return std::get<0>(std::move(storage_));
+    }
+
+    template <typename U>
+    [[nodiscard]] constexpr auto value_or(U&& fallback) const& -> T {  // NOLINT
+        return has_value() ? std::get<0>(storage_) : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    [[nodiscard]] constexpr auto error() const& -> const E& { return std::get<1>(storage_); }
+
+    [[nodiscard]] constexpr auto operator*() const& -> const T& { return std::get<0>(storage_); }
+    [[nodiscard]] constexpr auto operator*() && -> T&& { return std::get<0>(std::move(storage_)); }
+
+    [[nodiscard]] constexpr auto operator->() const -> const T* { return &std::get<0>(storage_); }
+
+private:
+    std::variant<T, E> storage_;
+};
+
+#endif
+
+/**
+ * @brief Build the error alternative of an Expected, e.g. return makeUnexpected(KeyError::KEY_NOT_FOUND).
+ */
+template <typename E>
+constexpr auto makeUnexpected(E error) -> Unexpected<E> {
+    return Unexpected<E>(std::move(error));
+}
+
+}  // namespace palantir::utils
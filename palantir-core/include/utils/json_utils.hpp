@@ -0,0 +1,26 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <string>
+
+#include "core_export.hpp"
+
+namespace palantir::utils {
+
+class PALANTIR_CORE_API JsonUtils {
+public:
+    JsonUtils() = delete;
+
+    /**
+     * @brief Serialize a json value at the end of an existing buffer.
+     *
+     * Same output as nlohmann::json::dump(), through its public API only. The temporary string it
+     * returns is appended, a caller reusing its buffer still avoids growing a new one per message.
+     *
+     * @param out The buffer to append to.
+     * @param value The value to serialize.
+     */
+    static auto appendJson(std::string& out, const nlohmann::json& value) -> void { out += value.dump(); }
+};
+
+}  // namespace palantir::utils
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <optional>
+#include <vector>
+
+namespace palantir::utils {
+
+/**
+ * @class LatencyWindow
+ * @brief The most recent latencies, up to a fixed count, and their nearest-rank percentiles.
+ *
+ * Percentiles follow the current behaviour rather than the whole history. Not thread-safe, owners
+ * guard it with their own lock.
+ *
+ * @tparam Duration A std::chrono::duration.
+ */
+template <typename Duration>
+class LatencyWindow {
+public:
+    /**
+     * @param capacity Number of recent samples kept, at least 1.
+     */
+    explicit LatencyWindow(std::size_t capacity) : capacity_(std::max<std::size_t>(capacity, 1)) {
+        samples_.reserve(capacity_);
+    }
+
+    /** @brief Add a sample, replacing the oldest one once the window is full. */
+    auto add(Duration latency) -> void {
+        if (samples_.size() < capacity_) {
+            samples_.push_back(latency);
+        } else {
+            samples_[next_] = latency;
+        }
+        next_ = (next_ + 1) % capacity_;
+    }
+
+    /** @brief Drop every sample. */
+    auto clear() -> void {
+        samples_.clear();
+        next_ = 0;
+    }
+
+    [[nodiscard]] auto size() const -> std::size_t { return samples_.size(); }
+
+    [[nodiscard]] auto empty() const -> bool { return samples_.empty(); }
+
+    /**
+     * @brief Get a percentile of the samples.
+     * @param percentile Percentile in the range [0, 100], clamped to it.
+     * @return The percentile, or std::nullopt when the window is empty.
+     */
+    [[nodiscard]] auto percentile(double percentile) const -> std::optional<Duration> {
+        return percentiles({percentile}).front();
+    }
+
+    /**
+     * @brief Get several percentiles of the samples, sorting them once.
+     * @return One value per requested percentile, all std::nullopt when the window is empty.
+     */
+    [[nodiscard]] auto percentiles(std::initializer_list<double> percentiles) const
+        -> std::vector<std::optional<Duration>> {
+        std::vector<std::optional<Duration>> values(percentiles.size());
+        if (samples_.empty()) {
+            return values;
+        }
+        auto sorted = samples_;
+        std::sort(sorted.begin(), sorted.end());
+        std::transform(percentiles.begin(), percentiles.end(), values.begin(),
+                       [&sorted](double percentile) { return percentileOf(sorted, percentile); });
+        return values;
+    }
+
+private:
+    // Nearest-rank percentile over an already sorted, non-empty window
+    static auto percentileOf(const std::vector<Duration>& sorted, double percentile) -> Duration {
+        const double clamped = std::clamp(percentile, 0.0, 100.0);
+        auto rank = static_cast<std::size_t>(std::ceil(clamped / 100.0 * static_cast<double>(sorted.size())));
+        rank = std::clamp<std::size_t>(rank, 1, sorted.size());
+        return sorted[rank - 1];
+    }
+
+    std::size_t capacity_;
+    std::vector<Duration> samples_;
+    std::size_t next_{0};
+};
+
+}  // namespace palantir::utils
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core_export.hpp"
+
+namespace palantir::utils {
+
+/**
+ * @brief Encodings a message payload can travel in between the host and the view.
+ */
+enum class PayloadEncoding { JSON, MSGPACK, CBOR };
+
+/**
+ * @brief Binary encoding of messages exchanged with the view.
+ *
+ * The web message channel only carries JSON, so a binary payload travels base64 encoded in an
+ * envelope: {"type":"encoded","encoding":"msgpack","data":"<base64>"}.
+ */
+class PALANTIR_CORE_API PayloadCodec {
+public:
+    PayloadCodec() = delete;
+
+    // Message type of the envelope wrapping a binary payload
+    static constexpr std::string_view ENCODED_MESSAGE_TYPE = "encoded";
+
+    /**
+     * @brief Get the name of an encoding as used in the envelope and during negotiation.
+     */
+    [[nodiscard]] static auto getName(PayloadEncoding encoding) -> std::string_view;
+
+    /**
+     * @brief Get the encoding with this name.
+     *
+     * @return The encoding, unset for an unknown name.
+     */
+    [[nodiscard]] static auto parseName(std::string_view name) -> std::optional<PayloadEncoding>;
+
+    /**
+     * @brief Serialize a value at the end of a byte buffer, as text for JSON.
+     */
+    static auto encode(const nlohmann::json& value, PayloadEncoding encoding, std::vector<uint8_t>& out) -> void;
+
+    /**
+     * @brief Deserialize a payload.
+     *
+     * @throws nlohmann::json::parse_error if the payload is not valid in this encoding.
+     */
+    [[nodiscard]] static auto decode(std::span<const uint8_t> payload, PayloadEncoding encoding) -> nlohmann::json;
+
+    /**
+     * @brief Append a message to a string, wrapped in an envelope for binary encodings.
+     *
+     * @param out The buffer to append to.
+     * @param message The message to send.
+     * @param encoding The encoding of the payload, JSON appends the message as is.
+     * @param scratch Reused buffer for the binary payload.
+     */
+    static auto appendMessage(std::string& out, const nlohmann::json& message, PayloadEncoding encoding,
+                              std::vector<uint8_t>& scratch) -> void;
+
+    /**
+     * @brief Extract the message wrapped in an envelope.
+     *
+     * @param envelope A message of type ENCODED_MESSAGE_TYPE.
+     * @return The decoded message.
+     * @throws std::invalid_argument if the envelope is malformed.
+     * @throws nlohmann::json::parse_error if its payload is.
+     */
+    [[nodiscard]] static auto unwrapMessage(const nlohmann::json& envelope) -> nlohmann::json;
+};
+
+}  // namespace palantir::utils
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "core_export.hpp"
@@ -50,6 +54,16 @@ public:
     [[nodiscard]] auto loadAllJavaScriptsFromDirectory(const std::filesystem::path& subdirectory) const
         -> std::vector<std::pair<std::string, std::string>>;
 
+    /**
+     * @brief Read the JavaScript files of a subdirectory ahead of their first use
+     *
+     * The next loadAllJavaScriptsFromDirectory() call for the subdirectory returns them without
+     * reading the files, unless a file was added, removed or modified since the preload. Later calls
+     * read the files again. A preload finishing after a load started is dropped.
+     * @param subdirectory The subdirectory within the resource directory
+     */
+    auto preloadJavaScriptsFromDirectory(const std::filesystem::path& subdirectory) const -> void;
+
     /**
      * @brief Get the full path to the resource directory
      * @return Path to the resource directory
@@ -90,6 +104,16 @@ private:
 #pragma warning(disable : 4251)
     static std::shared_ptr<ResourceUtils> instance_;
     std::filesystem::path resourceDirectory_;
+    struct Preloaded {
+        std::vector<std::pair<std::string, std::string>> files;
+        // Name, modification time and size of each file before it was read, sorted by name
+        std::vector<std::tuple<std::string, std::filesystem::file_time_type, std::uintmax_t>> stamps;
+    };
+    // Preloaded JavaScript files by subdirectory, handed out once
+    mutable std::map<std::filesystem::path, Preloaded> preloaded_;
+    // Loads started by subdirectory, a preload overtaken by a load is older than what it read
+    mutable std::map<std::filesystem::path, std::size_t> loadGenerations_;
+    mutable std::mutex preloadedMutex_;
 #pragma warning(pop)
 };
 
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core_export.hpp"
+
+namespace palantir::utils {
+
+/**
+ * @brief A timed phase of the startup.
+ */
+struct StartupSpan {
+    std::string name;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;
+    // Index of the recording thread, in the order threads first recorded a span
+    std::uint32_t thread{0};
+    // Number of spans open around this one on its thread
+    std::uint32_t depth{0};
+
+    [[nodiscard]] auto getDuration() const -> std::chrono::microseconds {
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    }
+};
+
+/**
+ * @class StartupProfiler
+ * @brief Timeline of the startup phases, recorded by ScopedSpan.
+ *
+ * Spans can be recorded from several threads at once. The timeline is printed as an indented list
+ * or exported in the Chrome trace event format, to open in chrome://tracing or Perfetto. Once
+ * disabled, ScopedSpan records nothing.
+ */
+class PALANTIR_CORE_API StartupProfiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Get the singleton instance of the profiler, created enabled on first use.
+     */
+    static auto getInstance() -> const std::shared_ptr<StartupProfiler>&;
+
+    static auto setInstance(const std::shared_ptr<StartupProfiler>& instance) -> void;
+
+    /**
+     * @brief Whether the instance records spans, read without locking the instance.
+     *
+     * True while no instance exists yet, as getInstance() creates it enabled.
+     */
+    [[nodiscard]] static auto isRecording() -> bool;
+
+    StartupProfiler();
+    ~StartupProfiler();
+
+    StartupProfiler(const StartupProfiler&) = delete;
+    auto operator=(const StartupProfiler&) -> StartupProfiler& = delete;
+    StartupProfiler(StartupProfiler&&) = delete;
+    auto operator=(StartupProfiler&&) -> StartupProfiler& = delete;
+
+    auto setEnabled(bool enabled) -> void;
+
+    [[nodiscard]] auto isEnabled() const -> bool;
+
+    /**
+     * @brief Add a span to the timeline, from the calling thread.
+     */
+    auto record(std::string name, Clock::time_point start, Clock::time_point end, std::uint32_t depth = 0) -> void;
+
+    /**
+     * @brief Get the recorded spans, sorted by start time.
+     */
+    [[nodiscard]] auto getSpans() const -> std::vector<StartupSpan>;
+
+    /**
+     * @brief Get when the timeline starts, the creation of the profiler or its last clear().
+     */
+    [[nodiscard]] auto getOrigin() const -> Clock::time_point;
+
+    /**
+     * @brief Drop the recorded spans and restart the timeline now.
+     */
+    auto clear() -> void;
+
+    /**
+     * @brief Write one line per span with its start offset and duration, indented by depth.
+     */
+    auto print(std::ostream& out) const -> void;
+
+    /**
+     * @brief Write the spans as complete events of the Chrome trace event format.
+     */
+    auto writeChromeTrace(std::ostream& out) const -> void;
+
+    /**
+     * @brief Write the Chrome trace to a file.
+     * @return false if the file cannot be written
+     */
+    auto writeChromeTrace(const std::filesystem::path& path) const -> bool;
+
+private:
+    class StartupProfilerImpl;
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::unique_ptr<StartupProfilerImpl> pimpl_;
+    static std::shared_ptr<StartupProfiler> instance_;
+#pragma warning(pop)
+};
+
+/**
+ * @class ScopedSpan
+ * @brief Records the lifetime of a scope as a span of the StartupProfiler instance.
+ *
+ * A name built at runtime is passed as a function, only called while the profiler records:
+ * @code
+ * ScopedSpan span([&name]() { return "plugin.load " + name; });
+ * @endcode
+ */
+class PALANTIR_CORE_API ScopedSpan {
+public:
+    explicit ScopedSpan(std::string name);
+
+    template <typename MakeName>
+        requires std::is_invocable_r_v<std::string, MakeName>
+    explicit ScopedSpan(MakeName&& makeName) {
+        if (StartupProfiler::isRecording()) {
+            start(std::forward<MakeName>(makeName)());
+        }
+    }
+
+    ~ScopedSpan();
+
+    ScopedSpan(const ScopedSpan&) = delete;
+    auto operator=(const ScopedSpan&) -> ScopedSpan& = delete;
+    ScopedSpan(ScopedSpan&&) = delete;
+    auto operator=(ScopedSpan&&) -> ScopedSpan& = delete;
+
+private:
+    auto start(std::string name) -> void;
+
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::shared_ptr<StartupProfiler> profiler_;
+    std::string name_;
+#pragma warning(pop)
+    StartupProfiler::Clock::time_point start_;
+    std::uint32_t depth_{0};
+};
+
+}  // namespace palantir::utils
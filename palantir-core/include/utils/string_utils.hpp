@@ -3,9 +3,12 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <cwchar>
 #include <locale>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #ifdef _WIN32
@@ -36,30 +39,55 @@ public:
         return str;
     }
 
+    /**
+     * @brief Transcode UTF-8 to UTF-16.
+     *
+     * ASCII runs are converted 16 bytes at a time with SSE2/NEON when available. Invalid
+     * sequences are replaced by U+FFFD, one per maximal invalid subpart.
+     * @param utf8 The UTF-8 text.
+     * @return The UTF-16 text.
+     */
+    static auto utf8ToUtf16(std::string_view utf8) -> std::u16string;
+
+    /**
+     * @brief Transcode UTF-16 to UTF-8.
+     *
+     * Lone surrogates are replaced by U+FFFD.
+     * @param utf16 The UTF-16 text.
+     * @return The UTF-8 text.
+     */
+    static auto utf16ToUtf8(std::u16string_view utf16) -> std::string;
+
+    /**
+     * @brief Check that a string is well-formed UTF-8.
+     *
+     * Overlong encodings, surrogate code points and values above U+10FFFF are rejected.
+     * @param utf8 The text to check.
+     * @return True if the text is valid UTF-8.
+     */
+    static auto isValidUtf8(std::string_view utf8) -> bool;
+
+    /**
+     * @brief Check that a string is well-formed UTF-16, i.e. has no lone surrogate.
+     * @param utf16 The text to check.
+     * @return True if the text is valid UTF-16.
+     */
+    static auto isValidUtf16(std::u16string_view utf16) -> bool;
+
 #ifdef _WIN32
     /**
      * @brief Convert a wide string to a UTF-8 string.
      * @param wstr The wide string to convert.
      * @return The UTF-8 string.
      */
-    static auto wToStr(const std::wstring& wstr) -> std::string {
-        if (wstr.empty()) {
-            return {};
-        }
-        int size_needed = WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), static_cast<int>(wstr.length()), nullptr, 0,
-                                              nullptr, nullptr);
-        std::string str(size_needed, 0);
-        WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), static_cast<int>(wstr.length()), str.data(), size_needed, nullptr,
-                            nullptr);
-        return str;
-    }
+    static auto wToStr(std::wstring_view wstr) -> std::string;
 
     /**
      * @brief Convert a UTF-8 string to a wide string.
      * @param str The UTF-8 string to convert.
      * @return The wide string.
      */
-    static auto strToW(const std::string_view& str) -> std::wstring { return {str.begin(), str.end()}; }
+    static auto strToW(std::string_view str) -> std::wstring;
 #endif
 
     // Named constants for bitwise operations
@@ -126,6 +154,23 @@ public:
         return ret;
     }
 
+    /**
+     * @brief Append the padded base64 encoding of bytes to a string.
+     *
+     * Same output as base64_encode, written straight into a buffer the caller reuses.
+     * @param out The string to append to.
+     * @param bytes The bytes to encode.
+     */
+    static auto appendBase64(std::string& out, std::span<const uint8_t> bytes) -> void;
+
+    /**
+     * @brief Decode padded base64 text.
+     * @param text The text to decode.
+     * @param out The buffer the bytes are appended to.
+     * @return False if the text is not valid base64, out then holds a partial result.
+     */
+    static auto decodeBase64(std::string_view text, std::vector<uint8_t>& out) -> bool;
+
     struct StringHash {
         using is_transparent = void;  // Enables heterogeneous operations.
 
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core_export.hpp"
+
+namespace palantir::utils {
+
+/**
+ * @brief Where a task of a TaskGraph runs, and whether TaskGraph::run() waits for it.
+ */
+enum class TaskMode {
+    WORKER,      ///< On a worker thread, run() waits for it
+    CALLER,      ///< On the thread calling run(), for work bound to the UI thread
+    BACKGROUND,  ///< On a worker thread, run() returns without waiting for it
+};
+
+/**
+ * @class TaskGraph
+ * @brief Runs named tasks as soon as the tasks they depend on are done, independent ones concurrently.
+ *
+ * A task that throws fails, and the tasks depending on it are skipped. Every task runs in a ScopedSpan
+ * of its name, so the startup timeline shows how they overlapped.
+ *
+ * Background tasks keep running after run() returns. The destructor cancels the ones not started yet and waits
+ * for the running ones, so a background task must not block without bound.
+ */
+class PALANTIR_CORE_API TaskGraph {
+public:
+    using Task = std::function<void()>;
+
+    /**
+     * @brief Create an empty graph.
+     *
+     * @param threadCount Number of workers, 0 for one per hardware thread.
+     */
+    explicit TaskGraph(std::size_t threadCount = 0);
+    ~TaskGraph();
+
+    TaskGraph(const TaskGraph&) = delete;
+    auto operator=(const TaskGraph&) -> TaskGraph& = delete;
+    TaskGraph(TaskGraph&&) = delete;
+    auto operator=(TaskGraph&&) -> TaskGraph& = delete;
+
+    /**
+     * @brief Declare a task, before run().
+     *
+     * @param name Unique name of the task, also the name of its span.
+     * @param task Work of the task.
+     * @param dependencies Tasks that must be done before this one starts, declared before or after it.
+     * @param mode Where the task runs.
+     * @throws std::invalid_argument if a task already has this name.
+     * @throws std::logic_error if the graph already ran.
+     */
+    auto addTask(const std::string& name, Task task, const std::vector<std::string>& dependencies = {},
+                 TaskMode mode = TaskMode::WORKER) -> TaskGraph&;
+
+    /**
+     * @brief Run the tasks, CALLER tasks on the calling thread, and wait for all but the background ones.
+     *
+     * @throws std::invalid_argument if a dependency is unknown, forms a cycle, or is a background task of a
+     *         task run() waits for. Nothing runs then.
+     * @throws What the first failed task threw, once every task run() waits for is done or skipped.
+     */
+    auto run() -> void;
+
+    /**
+     * @brief Wait for the background tasks after run(), returns at once if the graph did not run.
+     *
+     * @throws What the first failed background task threw.
+     */
+    auto waitForBackground() -> void;
+
+    /**
+     * @brief Drop the tasks not started yet, the running ones still finish. Dropped tasks do not count as failed.
+     */
+    auto cancel() -> void;
+
+    /**
+     * @brief Get the names of the tasks that failed or were skipped because a dependency failed.
+     */
+    [[nodiscard]] auto getFailedTasks() const -> std::vector<std::string>;
+
+private:
+    class TaskGraphImpl;
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::unique_ptr<TaskGraphImpl> pimpl_;
+#pragma warning(pop)
+};
+
+}  // namespace palantir::utils
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+
+#include "core_export.hpp"
+
+namespace palantir::utils {
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads running submitted tasks in submission order.
+ *
+ * The destructor runs the tasks still queued, then joins the workers.
+ */
+class PALANTIR_CORE_API ThreadPool {
+public:
+    /**
+     * @brief Start the workers.
+     *
+     * @param threadCount Number of workers, 0 for one per hardware thread.
+     */
+    explicit ThreadPool(std::size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    auto operator=(ThreadPool&&) -> ThreadPool& = delete;
+
+    /**
+     * @brief Queue a task.
+     *
+     * @return A future for the result of the task, holding what it threw if it failed.
+     */
+    template <typename F>
+    auto submit(F&& task) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        auto future = packaged->get_future();
+        post([packaged]() { (*packaged)(); });
+        return future;
+    }
+
+    [[nodiscard]] auto getThreadCount() const -> std::size_t;
+
+private:
+    auto post(std::function<void()> task) -> void;
+
+    class ThreadPoolImpl;
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::unique_ptr<ThreadPoolImpl> pimpl_;
+#pragma warning(pop)
+};
+
+}  // namespace palantir::utils
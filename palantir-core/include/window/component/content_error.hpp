@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace palantir::window::component {
+
+/**
+ * @brief Why content could not be read from the content manager.
+ */
+enum class ContentError : uint8_t {
+    // The element id names no content field
+    INVALID_ELEMENT_ID,
+    // The field is missing or is not text, e.g. after a root content without it
+    CONTENT_NOT_FOUND
+};
+
+[[nodiscard]] constexpr auto getContentErrorMessage(ContentError error) -> std::string_view {
+    switch (error) {
+        case ContentError::INVALID_ELEMENT_ID:
+            return "Invalid element ID";
+        case ContentError::CONTENT_NOT_FOUND:
+            return "Content not found";
+    }
+    return "Unknown content error";
+}
+
+}  // namespace palantir::window::component
@@ -2,11 +2,14 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "core_export.hpp"
 #include "window/component/icontent_manager.hpp"
 #include "window/component/message/logger/logger_strategy.hpp"
 #include "window/component/message/resize/resize_strategy.hpp"
+#include "window/component/message/static_message_dispatcher.hpp"
+#include "window/component/message/sync/content_sync_strategy.hpp"
 
 namespace palantir::window::component {
 template <typename T>
@@ -29,9 +32,10 @@ public:
      * @param nativeWindowHandle The native window handle.
      */
     auto initialize(uintptr_t nativeWindowHandle) -> void override {
-        registerMessageStrategy(message::makeStrategy(std::make_unique<message::logger::LoggerStrategy>("*")));
-        registerMessageStrategy(message::makeStrategy(std::make_unique<message::resize::ResizeStrategy>(
-            "contentSize", std::static_pointer_cast<IContentManager>(shared_from_this()))));
+        auto self = std::static_pointer_cast<IContentManager>(shared_from_this());
+        pimpl_->registerMessageDispatcher(std::make_unique<BuiltinDispatcher>(
+            std::forward_as_tuple("*"), std::forward_as_tuple("contentSize", self),
+            std::forward_as_tuple("contentReady", self)));
         pimpl_->initialize(nativeWindowHandle);
     }
 
@@ -42,6 +46,20 @@ public:
      */
     auto setRootContent(const std::string& content) -> void override { pimpl_->setRootContent(content); }
 
+    /**
+     * @brief Set the root content from an already structured value.
+     *
+     * @param content The content to set, moved into the manager.
+     */
+    auto setRootContentJson(nlohmann::json&& content) -> void override {
+        pimpl_->setRootContentJson(std::move(content));
+    }
+
+    /**
+     * @brief Send the full content to the view.
+     */
+    auto syncContent() -> void override { pimpl_->syncContent(); }
+
     /**
      * @brief Set the content.
      *
@@ -60,6 +78,16 @@ public:
      */
     auto getContent(const std::string& elementId) -> std::string override { return pimpl_->getContent(elementId); }
 
+    /**
+     * @brief Get the content without throwing.
+     *
+     * @param elementId The element id.
+     * @return The content, or why there is none.
+     */
+    auto tryGetContent(const std::string& elementId) -> utils::Expected<std::string, ContentError> override {
+        return pimpl_->tryGetContent(elementId);
+    }
+
     /**
      * @brief Toggle the content visibility.
      *
@@ -89,6 +117,66 @@ public:
         return pimpl_->getContentVisibility(elementId);
     }
 
+    /**
+     * @brief Send every pending content update to the view now.
+     */
+    auto flush() -> void override { pimpl_->flush(); }
+
+    /**
+     * @brief Notify the manager that a frame tick happened.
+     */
+    auto onFrame() -> void override { pimpl_->onFrame(); }
+
+    /**
+     * @brief Set the dispatcher of the UI thread the manager is used from.
+     *
+     * @param dispatcher The UI dispatcher.
+     */
+    auto setUiDispatcher(std::shared_ptr<UiDispatcher> dispatcher) -> void override {
+        pimpl_->setUiDispatcher(std::move(dispatcher));
+    }
+
+    /**
+     * @brief Configure how content updates are batched.
+     *
+     * @param batching The batching configuration.
+     */
+    auto setUpdateBatching(const ContentUpdateBatching& batching) -> void override {
+        pimpl_->setUpdateBatching(batching);
+    }
+
+    /**
+     * @brief Get the counters of the content updates sent to the view.
+     *
+     * @return ContentUpdateStats The counters.
+     */
+    [[nodiscard]] auto getUpdateStats() const -> ContentUpdateStats override { return pimpl_->getUpdateStats(); }
+
+    /**
+     * @brief Set the encoding content messages should use when the view supports it.
+     *
+     * @param encoding The preferred encoding.
+     */
+    auto setPayloadEncoding(utils::PayloadEncoding encoding) -> void override { pimpl_->setPayloadEncoding(encoding); }
+
+    /**
+     * @brief Pick the encoding of the content messages from the ones the view can decode.
+     *
+     * @param viewEncodings Names of the encodings the view can decode.
+     */
+    auto negotiatePayloadEncoding(const std::vector<std::string>& viewEncodings) -> void override {
+        pimpl_->negotiatePayloadEncoding(viewEncodings);
+    }
+
+    /**
+     * @brief Get the encoding content messages are currently sent in.
+     *
+     * @return utils::PayloadEncoding The negotiated encoding.
+     */
+    [[nodiscard]] auto getPayloadEncoding() const -> utils::PayloadEncoding override {
+        return pimpl_->getPayloadEncoding();
+    }
+
     /**
      * @brief Destroy the content manager.
      */
@@ -102,6 +190,30 @@ public:
      */
     auto resize(int width, int height) -> void override { pimpl_->resize(width, height); }
 
+    /**
+     * @brief Request a resize to the size reported by the view.
+     *
+     * @param width The reported content width.
+     * @param height The reported content height.
+     */
+    auto requestResize(int width, int height) -> void override { pimpl_->requestResize(width, height); }
+
+    /**
+     * @brief Configure how size reports are coalesced.
+     *
+     * @param coalescing The coalescing configuration.
+     */
+    auto setResizeCoalescing(const ContentResizeCoalescing& coalescing) -> void override {
+        pimpl_->setResizeCoalescing(coalescing);
+    }
+
+    /**
+     * @brief Get the counters of the size reports received from the view.
+     *
+     * @return ContentResizeStats The counters.
+     */
+    [[nodiscard]] auto getResizeStats() const -> ContentResizeStats override { return pimpl_->getResizeStats(); }
+
     /**
      * @brief Add an observer to be notified of content size changes.
      *
@@ -151,6 +263,11 @@ public:
     auto handleMessage(const std::string& message) -> void override { pimpl_->handleMessage(message); }
 
 private:
+    // Built-in strategies, dispatched without per-strategy allocation or virtual calls
+    using BuiltinDispatcher =
+        message::StaticMessageDispatcher<message::logger::LoggerStrategy, message::resize::ResizeStrategy,
+                                         message::sync::ContentSyncStrategy>;
+
     class ContentManagerImpl;
 #pragma warning(push)
 #pragma warning(disable : 4251)
@@ -1,11 +1,20 @@
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <nlohmann/json.hpp>
+#include <optional>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "exception/exceptions.hpp"
+#include "ui_dispatcher.hpp"
+#include "utils/json_utils.hpp"
 #include "utils/logger.hpp"
+#include "utils/payload_codec.hpp"
 #include "window/component/content_manager.hpp"
+#include "window/component/content_resize_coalescing.hpp"
+#include "window/component/content_update_batching.hpp"
 #include "window/component/icontent_size_observer.hpp"
 #include "window/component/message/logger/logger_strategy.hpp"
 #include "window/component/message/message_handler.hpp"
@@ -17,20 +26,381 @@ class ContentManager<T>::ContentManagerImpl {
 private:
     std::shared_ptr<T> view_{std::make_shared<T>()};
     nlohmann::json content_{
-        {{"explanation", ""},
-         {"response", ""},
-         {"complexity",
-          {{"time", {{"value", ""}, {"explanation", ""}}}, {"space", {{"value", ""}, {"explanation", ""}}}}}}};
+        {"explanation", ""},
+        {"response", ""},
+        {"complexity",
+         {{"time", {{"value", ""}, {"explanation", ""}}}, {"space", {{"value", ""}, {"explanation", ""}}}}}};
     std::vector<IContentSizeObserver*> observers_;
     int currentContentWidth_ = 0;
     int currentContentHeight_ = 0;
 
-    void updateWebView() {
-        if (view_) {
-            // Don't recreate the message handler since it's already initialized in the constructor
-            nlohmann::json message = {{"type", "setContent"}, {"content", content_}};
-            view_->executeJavaScript("window.dispatchEvent(new MessageEvent('message', { data: " + message.dump() +
-                                     " }));");
+    // Reused for every outgoing message so its capacity is only grown once
+    std::string messageBuffer_;
+
+    // Encoding asked for by the host and the one negotiated with the view
+    utils::PayloadEncoding preferredEncoding_ = utils::PayloadEncoding::JSON;
+    utils::PayloadEncoding encoding_ = utils::PayloadEncoding::JSON;
+    // Reused for the binary payload of encoded messages
+    std::vector<uint8_t> payloadBuffer_;
+
+    // Whether the view holds a snapshot that patches can be applied to
+    bool viewSynced_ = false;
+    // JSON pointers of the content changed since the last message, none is an ancestor of another
+    std::vector<std::string> dirtyPaths_;
+
+    struct VisibilityUpdate {
+        std::string elementId;
+        bool toggle;
+        bool visible;
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    ContentUpdateBatching batching_;
+    ContentUpdateStats stats_;
+    // Updates made since the last flush, and when the oldest of them was made
+    uint64_t pendingUpdates_ = 0;
+    Clock::time_point oldestPending_;
+    Clock::time_point lastFlush_;
+    // The next flush sends the whole content instead of a patch
+    bool snapshotPending_ = false;
+    // Operations already resolved by a root content diff, sent before the dirty paths
+    nlohmann::json pendingOperations_ = nlohmann::json::array();
+    // At most one entry per element, later updates are merged into it
+    std::vector<VisibilityUpdate> pendingVisibility_;
+
+    ContentResizeCoalescing resizeCoalescing_;
+    ContentResizeStats resizeStats_;
+    // Latest significant size reported by the view and not applied yet
+    std::optional<std::pair<int, int>> pendingResize_;
+    Clock::time_point lastResize_;
+
+    // Runs the deferred flushes when no frame tick comes
+    std::shared_ptr<UiDispatcher> uiDispatcher_;
+    bool flushScheduled_ = false;
+    bool resizeScheduled_ = false;
+    // Expires with the manager, so a deferred call still queued in the dispatcher does nothing
+    std::shared_ptr<ContentManagerImpl*> self_{std::make_shared<ContentManagerImpl*>(this)};
+
+    static void appendMessageType(std::string& out, std::string_view type) {
+        out.append(R"({"type":")").append(type).push_back('"');
+    }
+
+    void appendSnapshot(std::string& out) const {
+        appendMessageType(out, "setContent");
+        out.append(R"(,"content":)");
+        utils::JsonUtils::appendJson(out, content_);
+        out.push_back('}');
+    }
+
+    /**
+     * @brief Append the pending operations followed by the dirty paths as a patch message.
+     *
+     * Dirty paths become RFC 6902 "add" operations: "add" replaces an existing member and
+     * creates a missing one, so it covers every change setContent can make.
+     */
+    void appendPatch(std::string& out) const {
+        appendMessageType(out, "patch");
+        out.append(R"(,"ops":[)");
+        bool first = true;
+        for (const auto& operation : pendingOperations_) {
+            if (!std::exchange(first, false)) {
+                out.push_back(',');
+            }
+            utils::JsonUtils::appendJson(out, operation);
+        }
+        for (const auto& dirtyPath : dirtyPaths_) {
+            if (!std::exchange(first, false)) {
+                out.push_back(',');
+            }
+            out.append(R"({"op":"add","path":)");
+            utils::JsonUtils::appendJson(out, dirtyPath);
+            out.append(R"(,"value":)");
+            utils::JsonUtils::appendJson(out, content_.at(nlohmann::json::json_pointer(dirtyPath)));
+            out.push_back('}');
+        }
+        out.append("]}");
+    }
+
+    static void appendVisibility(std::string& out, const VisibilityUpdate& update) {
+        appendMessageType(out, update.toggle ? "toggleVisibility" : "setVisibility");
+        out.append(R"(,"elementId":)");
+        utils::JsonUtils::appendJson(out, update.elementId);
+        if (!update.toggle) {
+            out.append(update.visible ? R"(,"visible":true)" : R"(,"visible":false)");
+        }
+        out.push_back('}');
+    }
+
+    // Structured counterparts of the append functions, for the binary encodings
+    [[nodiscard]] auto snapshotMessage() const -> nlohmann::json {
+        return {{"type", "setContent"}, {"content", content_}};
+    }
+
+    [[nodiscard]] auto patchMessage() const -> nlohmann::json {
+        auto operations = pendingOperations_;
+        for (const auto& dirtyPath : dirtyPaths_) {
+            operations.push_back(
+                {{"op", "add"}, {"path", dirtyPath}, {"value", content_.at(nlohmann::json::json_pointer(dirtyPath))}});
+        }
+        return {{"type", "patch"}, {"ops", std::move(operations)}};
+    }
+
+    [[nodiscard]] static auto visibilityMessage(const VisibilityUpdate& update) -> nlohmann::json {
+        nlohmann::json message = {{"type", update.toggle ? "toggleVisibility" : "setVisibility"},
+                                  {"elementId", update.elementId}};
+        if (!update.toggle) {
+            message["visible"] = update.visible;
+        }
+        return message;
+    }
+
+    // Build the pending updates as one message in a binary encoding, wrapped for the web message channel
+    void encodePending(bool hasContent, bool snapshot, size_t parts) {
+        nlohmann::json messages = nlohmann::json::array();
+        if (hasContent) {
+            messages.push_back(snapshot ? snapshotMessage() : patchMessage());
+        }
+        for (const auto& update : pendingVisibility_) {
+            messages.push_back(visibilityMessage(update));
+        }
+        const auto message =
+            parts > 1 ? nlohmann::json{{"type", "batch"}, {"messages", std::move(messages)}} : std::move(messages[0]);
+        utils::PayloadCodec::appendMessage(messageBuffer_, message, encoding_, payloadBuffer_);
+    }
+
+    // Resolve the dirty paths now, before the content they point to is replaced
+    void moveDirtyPathsToOperations() {
+        for (auto& dirtyPath : dirtyPaths_) {
+            auto value = content_.at(nlohmann::json::json_pointer(dirtyPath));
+            pendingOperations_.push_back({{"op", "add"}, {"path", std::move(dirtyPath)}, {"value", std::move(value)}});
+        }
+        dirtyPaths_.clear();
+    }
+
+    void clearPending() {
+        pendingUpdates_ = 0;
+        snapshotPending_ = false;
+        pendingOperations_ = nlohmann::json::array();
+        dirtyPaths_.clear();
+        pendingVisibility_.clear();
+    }
+
+    /**
+     * @brief Record an update and send it right away if batching allows no more delay.
+     *
+     * The first update of a batch schedules a flush after maxLatency on the UI dispatcher,
+     * so the last updates of a burst are sent even when no frame tick follows.
+     */
+    void queueUpdate() {
+        const auto now = Clock::now();
+        if (pendingUpdates_++ == 0) {
+            oldestPending_ = now;
+        }
+        ++stats_.updates;
+        if (!batching_.enabled) {
+            flushPending();
+        } else if (now - oldestPending_ >= batching_.maxLatency) {
+            ++stats_.latencyFlushes;
+            flushPending();
+        } else {
+            scheduleFlush(batching_.maxLatency);
+        }
+    }
+
+    // Call a member on the UI thread after a delay, unless the manager is gone by then
+    void postAfter(std::chrono::milliseconds delay, void (ContentManagerImpl::*member)()) {
+        uiDispatcher_->postAfter(delay, [self = std::weak_ptr<ContentManagerImpl*>(self_), member]() {
+            if (auto manager = self.lock()) {
+                ((**manager).*member)();
+            }
+        });
+    }
+
+    void scheduleFlush(std::chrono::milliseconds delay) {
+        if (!uiDispatcher_ || flushScheduled_) {
+            return;
+        }
+        flushScheduled_ = true;
+        postAfter(delay, &ContentManagerImpl::onFlushDeadline);
+    }
+
+    // The updates pending may be a newer batch than the one the flush was scheduled for
+    void onFlushDeadline() {
+        flushScheduled_ = false;
+        if (pendingUpdates_ == 0 || !batching_.enabled) {
+            return;
+        }
+        const auto waited = Clock::now() - oldestPending_;
+        if (waited >= batching_.maxLatency) {
+            ++stats_.latencyFlushes;
+            flushPending();
+        } else {
+            scheduleFlush(std::chrono::ceil<std::chrono::milliseconds>(batching_.maxLatency - waited));
+        }
+    }
+
+    /**
+     * @brief Send every pending update as one message.
+     *
+     * A single update is sent as is, several are wrapped in a "batch" message whose
+     * entries the view dispatches in order. Content goes first, as a snapshot when the
+     * view has none yet, then the visibility changes.
+     */
+    void flushPending() {
+        if (pendingUpdates_ == 0) {
+            return;
+        }
+        lastFlush_ = Clock::now();
+        const bool hasContent = snapshotPending_ || !pendingOperations_.empty() || !dirtyPaths_.empty();
+        const bool snapshot = hasContent && (snapshotPending_ || !viewSynced_);
+        const size_t parts = (hasContent ? 1 : 0) + pendingVisibility_.size();
+        if (parts == 0 || !view_) {
+            // Everything cancelled out, e.g. an element toggled twice
+            stats_.coalesced += pendingUpdates_;
+            clearPending();
+            return;
+        }
+
+        messageBuffer_.clear();
+        if (encoding_ != utils::PayloadEncoding::JSON) {
+            encodePending(hasContent, snapshot, parts);
+        } else {
+            if (parts > 1) {
+                appendMessageType(messageBuffer_, "batch");
+                messageBuffer_.append(R"(,"messages":[)");
+            }
+            bool first = true;
+            if (hasContent) {
+                first = false;
+                snapshot ? appendSnapshot(messageBuffer_) : appendPatch(messageBuffer_);
+            }
+            for (const auto& update : pendingVisibility_) {
+                if (!std::exchange(first, false)) {
+                    messageBuffer_.push_back(',');
+                }
+                appendVisibility(messageBuffer_, update);
+            }
+            if (parts > 1) {
+                messageBuffer_.append("]}");
+            }
+        }
+
+        stats_.coalesced += pendingUpdates_ - 1;
+        ++stats_.messages;
+        viewSynced_ = viewSynced_ || snapshot;
+        clearPending();
+        view_->postMessage(messageBuffer_);
+    }
+
+    void queueVisibility(const std::string& elementId, bool toggle, bool visible) {
+        auto iterator = std::find_if(pendingVisibility_.begin(), pendingVisibility_.end(),
+                                     [&elementId](const VisibilityUpdate& update) { return update.elementId == elementId; });
+        if (iterator == pendingVisibility_.end()) {
+            pendingVisibility_.push_back(VisibilityUpdate{elementId, toggle, visible});
+        } else if (toggle && iterator->toggle) {
+            // Two toggles cancel each other out
+            pendingVisibility_.erase(iterator);
+        } else if (toggle) {
+            iterator->visible = !iterator->visible;
+        } else {
+            iterator->toggle = false;
+            iterator->visible = visible;
+        }
+        queueUpdate();
+    }
+
+    static auto isSameOrAncestor(const std::string& ancestor, const std::string& path) -> bool {
+        return path.compare(0, ancestor.size(), ancestor) == 0 &&
+               (path.size() == ancestor.size() || path[ancestor.size()] == '/');
+    }
+
+    void markDirty(std::string path) {
+        for (const auto& dirtyPath : dirtyPaths_) {
+            if (isSameOrAncestor(dirtyPath, path)) {
+                return;
+            }
+        }
+        std::erase_if(dirtyPaths_, [&path](const std::string& dirtyPath) { return isSameOrAncestor(path, dirtyPath); });
+        dirtyPaths_.push_back(std::move(path));
+    }
+
+    static auto escapePointerToken(std::string_view token) -> std::string {
+        std::string escaped;
+        escaped.reserve(token.size());
+        for (char character : token) {
+            if (character == '~') {
+                escaped.append("~0");
+            } else if (character == '/') {
+                escaped.append("~1");
+            } else {
+                escaped.push_back(character);
+            }
+        }
+        return escaped;
+    }
+
+    /**
+     * @brief Set a value below the content root and mark the changed path dirty.
+     *
+     * When intermediate objects have to be created, the first missing one is marked
+     * instead of the leaf so the patch never targets a parent the view does not have.
+     */
+    void setAt(const std::vector<std::string_view>& segments, const std::string& value) {
+        std::string pointer;
+        std::string dirtyPointer;
+        const nlohmann::json* node = &content_;
+        for (const auto& segment : segments) {
+            pointer.append("/").append(escapePointerToken(segment));
+            const nlohmann::json* child = nullptr;
+            if (node != nullptr && node->is_object()) {
+                auto iterator = node->find(segment);
+                child = iterator != node->end() ? &*iterator : nullptr;
+            }
+            if (child == nullptr && dirtyPointer.empty()) {
+                dirtyPointer = pointer;
+            }
+            node = child;
+        }
+        content_[nlohmann::json::json_pointer(pointer)] = value;
+        markDirty(dirtyPointer.empty() ? std::move(pointer) : std::move(dirtyPointer));
+    }
+
+    // Whether a reported dimension moved far enough from the current one to be applied
+    [[nodiscard]] auto isSignificant(int current, int reported) const -> bool {
+        const int delta = reported - current;
+        return delta >= resizeCoalescing_.growThreshold || -delta >= resizeCoalescing_.shrinkThreshold;
+    }
+
+    void applyPendingResize() {
+        if (!pendingResize_) {
+            return;
+        }
+        const auto [width, height] = *std::exchange(pendingResize_, std::nullopt);
+        lastResize_ = Clock::now();
+        ++resizeStats_.applied;
+        resize(width, height);
+    }
+
+    void scheduleResize(std::chrono::milliseconds delay) {
+        if (!uiDispatcher_ || resizeScheduled_) {
+            return;
+        }
+        resizeScheduled_ = true;
+        postAfter(delay, &ContentManagerImpl::onResizeDeadline);
+    }
+
+    // The pending size may have been applied by a frame tick or dropped in the meantime
+    void onResizeDeadline() {
+        resizeScheduled_ = false;
+        if (!pendingResize_) {
+            return;
+        }
+        const auto elapsed = Clock::now() - lastResize_;
+        if (elapsed >= resizeCoalescing_.minInterval) {
+            applyPendingResize();
+        } else {
+            scheduleResize(std::chrono::ceil<std::chrono::milliseconds>(resizeCoalescing_.minInterval - elapsed));
         }
     }
 
@@ -59,6 +429,8 @@ public:
     auto initialize(uintptr_t nativeWindowHandle) -> void {
         if (view_) {
             // Initialize WebView2 with completion callback
+            // A new view has no content yet, the next update must be a snapshot
+            viewSynced_ = false;
             view_->initialize(nativeWindowHandle, [this]() {
                 DebugLog("WebView2 initialization callback - loading URL");
                 view_->loadURL("http://www.google.com");
@@ -67,28 +439,61 @@ public:
     }
 
     auto setRootContent(const std::string& content) -> void {
+        nlohmann::json parsed;
         try {
-            DebugLog("Setting root content: %s", content.c_str());
-            content_ = nlohmann::json::parse(content);
-            updateWebView();
+            DebugLog("Setting root content: ", content.size(), " bytes");
+            parsed = nlohmann::json::parse(content);
         } catch (const nlohmann::json::exception& e) {
             // Handle JSON parsing error
             throw palantir::exception::TraceableContentManagerException("Invalid JSON format: " +
                                                                         std::string(e.what()));
         }
+        setRootContentJson(std::move(parsed));
+    }
+
+    auto setRootContentJson(nlohmann::json&& content) -> void {
+        if (snapshotPending_ || !viewSynced_) {
+            // The pending snapshot will carry the new content whole
+            content_ = std::move(content);
+            dirtyPaths_.clear();
+            pendingOperations_ = nlohmann::json::array();
+            snapshotPending_ = true;
+            queueUpdate();
+            return;
+        }
+        moveDirtyPathsToOperations();
+        auto operations = nlohmann::json::diff(content_, content);
+        content_ = std::move(content);
+        if (operations.empty()) {
+            return;
+        }
+        for (auto& operation : operations) {
+            pendingOperations_.push_back(std::move(operation));
+        }
+        queueUpdate();
+    }
+
+    auto syncContent() -> void {
+        // The view is waiting for its state, do not hold it until the next frame
+        snapshotPending_ = true;
+        queueUpdate();
+        flushPending();
     }
 
     auto setContent(const std::string& elementId, const std::string& content) -> void {
         try {
             if (elementId == "explanation" || elementId == "response") {
-                content_[elementId] = content;
+                setAt({elementId}, content);
             } else if (elementId.find("complexity.") == 0) {
-                auto parts = split(elementId.substr(11), ".");  // Remove "complexity." prefix
-                if (parts.size() == 2) {                        // e.g., "time.value" or "time.explanation"
-                    content_["complexity"][parts[0]][parts[1]] = content;
+                auto parts = split(std::string_view(elementId).substr(11), ".");  // Remove "complexity." prefix
+                if (parts.size() != 2) {  // e.g., "time.value" or "time.explanation"
+                    return;
                 }
+                setAt({"complexity", parts[0], parts[1]}, content);
+            } else {
+                return;
             }
-            updateWebView();
+            queueUpdate();
         } catch (const std::exception& e) {
             throw palantir::exception::TraceableContentManagerException("Failed to set content: " +
                                                                         std::string(e.what()));
@@ -96,36 +501,49 @@ public:
     }
 
     [[nodiscard]] auto getContent(const std::string& elementId) const -> std::string {
-        try {
-            if (elementId == "explanation" || elementId == "response") {
-                return content_[elementId].get<std::string>();
-            } else if (elementId.find("complexity.") == 0) {
-                auto parts = split(elementId.substr(11), ".");
-                if (parts.size() == 2) {
-                    return content_["complexity"][parts[0]][parts[1]].get<std::string>();
-                }
-            }
-            throw palantir::exception::TraceableContentManagerException("Invalid element ID");
-        } catch (const std::exception& e) {
-            throw palantir::exception::TraceableContentManagerException("Failed to get content: " +
-                                                                        std::string(e.what()));
+        auto content = tryGetContent(elementId);
+        if (!content) {
+            throw palantir::exception::TraceableContentManagerException(
+                "Failed to get content: " + std::string(getContentErrorMessage(content.error())));
         }
+        return std::move(content).value();
     }
 
-    auto toggleContentVisibility(const std::string& elementId) -> void {
-        if (view_) {
-            nlohmann::json message = {{"type", "toggleVisibility"}, {"elementId", elementId}};
-            view_->executeJavaScript("window.dispatchEvent(new MessageEvent('message', { data: " + message.dump() +
-                                     " }));");
+    [[nodiscard]] auto tryGetContent(const std::string& elementId) const -> utils::Expected<std::string, ContentError> {
+        std::vector<std::string_view> segments;
+        if (elementId == "explanation" || elementId == "response") {
+            segments.emplace_back(elementId);
+        } else if (elementId.starts_with("complexity.")) {
+            auto parts = split(std::string_view(elementId).substr(11), ".");  // Remove "complexity." prefix
+            if (parts.size() != 2) {
+                return utils::makeUnexpected(ContentError::INVALID_ELEMENT_ID);
+            }
+            segments = {"complexity", parts[0], parts[1]};
+        } else {
+            return utils::makeUnexpected(ContentError::INVALID_ELEMENT_ID);
+        }
+
+        const nlohmann::json* node = &content_;
+        for (const auto& segment : segments) {
+            if (!node->is_object()) {
+                return utils::makeUnexpected(ContentError::CONTENT_NOT_FOUND);
+            }
+            const auto iterator = node->find(segment);
+            if (iterator == node->end()) {
+                return utils::makeUnexpected(ContentError::CONTENT_NOT_FOUND);
+            }
+            node = &*iterator;
+        }
+        if (!node->is_string()) {
+            return utils::makeUnexpected(ContentError::CONTENT_NOT_FOUND);
         }
+        return node->template get<std::string>();
     }
 
+    auto toggleContentVisibility(const std::string& elementId) -> void { queueVisibility(elementId, true, false); }
+
     auto setContentVisibility(const std::string& elementId, bool visible) -> void {
-        if (view_) {
-            nlohmann::json message = {{"type", "setVisibility"}, {"elementId", elementId}, {"visible", visible}};
-            view_->executeJavaScript("window.dispatchEvent(new MessageEvent('message', { data: " + message.dump() +
-                                     " }));");
-        }
+        queueVisibility(elementId, false, visible);
     }
 
     [[nodiscard]] auto getContentVisibility([[maybe_unused]] const std::string_view& elementId) const -> bool {
@@ -134,10 +552,58 @@ public:
         return true;
     }
 
+    auto flush() -> void { flushPending(); }
+
+    auto onFrame() -> void {
+        const auto now = Clock::now();
+        if (pendingUpdates_ > 0 && now - lastFlush_ >= batching_.frameInterval) {
+            flushPending();
+        }
+        if (pendingResize_ && now - lastResize_ >= resizeCoalescing_.minInterval) {
+            applyPendingResize();
+        }
+    }
+
+    auto setUiDispatcher(std::shared_ptr<UiDispatcher> dispatcher) -> void {
+        uiDispatcher_ = std::move(dispatcher);
+        // Calls scheduled on the previous dispatcher may never run
+        flushScheduled_ = false;
+        resizeScheduled_ = false;
+        if (pendingUpdates_ > 0) {
+            onFlushDeadline();
+        }
+        onResizeDeadline();
+    }
+
+    auto setUpdateBatching(const ContentUpdateBatching& batching) -> void {
+        flushPending();
+        batching_ = batching;
+    }
+
+    [[nodiscard]] auto getUpdateStats() const -> ContentUpdateStats { return stats_; }
+
+    auto setPayloadEncoding(utils::PayloadEncoding encoding) -> void { preferredEncoding_ = encoding; }
+
+    auto negotiatePayloadEncoding(const std::vector<std::string>& viewEncodings) -> void {
+        // Messages are encoded when flushed, so pending updates follow the new encoding
+        const auto preferredName = utils::PayloadCodec::getName(preferredEncoding_);
+        const bool supported = std::find(viewEncodings.begin(), viewEncodings.end(), preferredName) != viewEncodings.end();
+        encoding_ = supported ? preferredEncoding_ : utils::PayloadEncoding::JSON;
+        DebugLog("Content messages encoding: ", utils::PayloadCodec::getName(encoding_));
+    }
+
+    [[nodiscard]] auto getPayloadEncoding() const -> utils::PayloadEncoding { return encoding_; }
+
     auto destroy() -> void {
         if (view_) {
             view_->destroy();
         }
+        // Updates for a destroyed view are dropped, the next view starts from a snapshot
+        clearPending();
+        viewSynced_ = false;
+        pendingResize_.reset();
+        // The next view negotiates its own encoding
+        encoding_ = utils::PayloadEncoding::JSON;
     }
 
     auto resize(int width, int height) -> void {
@@ -149,6 +615,41 @@ public:
         }
     }
 
+    auto requestResize(int width, int height) -> void {
+        ++resizeStats_.requests;
+        const bool unchanged = width == currentContentWidth_ && height == currentContentHeight_;
+        if (unchanged || (resizeCoalescing_.enabled && !isSignificant(currentContentWidth_, width) &&
+                          !isSignificant(currentContentHeight_, height))) {
+            // The latest report supersedes a pending one, the current size is close enough
+            pendingResize_.reset();
+            ++resizeStats_.skipped;
+            return;
+        }
+        if (!resizeCoalescing_.enabled) {
+            pendingResize_ = {width, height};
+            applyPendingResize();
+            return;
+        }
+        if (pendingResize_) {
+            ++resizeStats_.coalesced;
+        }
+        pendingResize_ = {width, height};
+        const auto elapsed = Clock::now() - lastResize_;
+        if (elapsed >= resizeCoalescing_.minInterval) {
+            applyPendingResize();
+        } else {
+            // The last report of a burst is applied even when no frame tick follows
+            scheduleResize(std::chrono::ceil<std::chrono::milliseconds>(resizeCoalescing_.minInterval - elapsed));
+        }
+    }
+
+    auto setResizeCoalescing(const ContentResizeCoalescing& coalescing) -> void {
+        applyPendingResize();
+        resizeCoalescing_ = coalescing;
+    }
+
+    [[nodiscard]] auto getResizeStats() const -> ContentResizeStats { return resizeStats_; }
+
     auto addContentSizeObserver(IContentSizeObserver* observer) -> void {
         if (observer && std::find(observers_.begin(), observers_.end(), observer) == observers_.end()) {
             observers_.push_back(observer);
@@ -182,6 +683,12 @@ public:
         }
     }
 
+    auto registerMessageDispatcher(std::unique_ptr<message::MessageDispatcherBase> dispatcher) -> void {
+        if (view_) {
+            view_->registerMessageDispatcher(std::move(dispatcher));
+        }
+    }
+
     auto handleMessage(const std::string& message) -> void {
         if (view_) {
             view_->handleMessage(message);
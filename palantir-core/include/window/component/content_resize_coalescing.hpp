@@ -0,0 +1,41 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace palantir::window::component {
+
+/**
+ * @brief How size reports from the view are turned into resizes.
+ *
+ * A reported size is dropped when it matches the current one or stays within the
+ * thresholds, otherwise it replaces any pending size and is applied on the next frame
+ * tick once minInterval has passed since the previous resize. Without frame ticks, the
+ * pending size is applied by a call scheduled on the UI dispatcher of the manager.
+ */
+struct ContentResizeCoalescing {
+    // When false every report that changes the size is applied at once
+    bool enabled{true};
+    // Smallest growth in pixels that is applied, growing late clips the content
+    int growThreshold{1};
+    // Smallest shrink in pixels that is applied, ignores the jitter of streamed text
+    int shrinkThreshold{8};
+    // Minimum time between two resizes
+    std::chrono::milliseconds minInterval{16};
+};
+
+/**
+ * @brief Counters of the size reports received from the view.
+ */
+struct ContentResizeStats {
+    // Size reports received through requestResize
+    uint64_t requests{0};
+    // Resizes actually applied to the view and observers
+    uint64_t applied{0};
+    // Reports dropped because the size did not change enough
+    uint64_t skipped{0};
+    // Pending reports replaced by a newer one before being applied
+    uint64_t coalesced{0};
+};
+
+}  // namespace palantir::window::component
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace palantir::window::component {
+
+/**
+ * @brief How content updates are batched before being sent to the view.
+ *
+ * Updates are collected and sent as one message on the next frame tick, on an explicit
+ * flush, or as soon as the oldest pending update has waited for maxLatency. Without frame
+ * ticks, maxLatency is only enforced by a flush scheduled on the UI dispatcher of the manager.
+ */
+struct ContentUpdateBatching {
+    // When false every update is sent as soon as it is made
+    bool enabled{true};
+    // Minimum time between two flushes triggered by frame ticks
+    std::chrono::milliseconds frameInterval{16};
+    // Longest time an update may wait when no frame tick comes
+    std::chrono::milliseconds maxLatency{50};
+};
+
+/**
+ * @brief Counters of the content updates sent to the view.
+ */
+struct ContentUpdateStats {
+    // Updates requested through the content manager
+    uint64_t updates{0};
+    // Messages actually sent to the view
+    uint64_t messages{0};
+    // Updates merged into another update's message instead of being sent on their own
+    uint64_t coalesced{0};
+    // Flushes forced by maxLatency instead of a frame tick or an explicit flush
+    uint64_t latencyFlushes{0};
+};
+
+}  // namespace palantir::window::component
@@ -1,13 +1,23 @@
 #pragma once
 
 #include <memory>
+#include <nlohmann/json.hpp>
 #include <string>
 #include <vector>
 
 #include "core_export.hpp"
+#include "utils/expected.hpp"
+#include "utils/payload_codec.hpp"
+#include "window/component/content_error.hpp"
+#include "window/component/content_resize_coalescing.hpp"
+#include "window/component/content_update_batching.hpp"
 #include "window/component/icontent_size_observer.hpp"
 #include "window/component/message/message_strategy_concept.hpp"
 
+namespace palantir {
+class UiDispatcher;
+}  // namespace palantir
+
 namespace palantir::window::component {
 class PALANTIR_CORE_API IContentManager {
 public:
@@ -32,6 +42,24 @@ public:
      */
     virtual auto setRootContent(const std::string& content) -> void = 0;
 
+    /**
+     * @brief Set the root content from an already structured value.
+     *
+     * Prefer this over setRootContent when the content is already a json value, e.g. a
+     * Sauron response, as it is moved in and only serialized once, into the view message.
+     *
+     * @param content The content to set, moved into the manager.
+     */
+    virtual auto setRootContentJson(nlohmann::json&& content) -> void = 0;
+
+    /**
+     * @brief Send the full content to the view.
+     *
+     * Later updates are sent as patches against this snapshot, so this must be called
+     * whenever the view (re)loads and loses its state.
+     */
+    virtual auto syncContent() -> void = 0;
+
     /**
      * @brief Set the content.
      *
@@ -48,6 +76,14 @@ public:
      */
     virtual auto getContent(const std::string& elementId) -> std::string = 0;
 
+    /**
+     * @brief Get the content without throwing.
+     *
+     * @param elementId The element id.
+     * @return The content, or why there is none.
+     */
+    virtual auto tryGetContent(const std::string& elementId) -> utils::Expected<std::string, ContentError> = 0;
+
     /**
      * @brief Toggle the content visibility.
      *
@@ -71,6 +107,71 @@ public:
      */
     virtual auto getContentVisibility(const std::string& elementId) -> bool = 0;
 
+    /**
+     * @brief Send every pending content update to the view now.
+     */
+    virtual auto flush() -> void = 0;
+
+    /**
+     * @brief Notify the manager that a frame tick happened.
+     *
+     * Pending updates are sent, and a pending resize applied, at most once per interval,
+     * so this can be called from a loop running faster than the frame rate.
+     */
+    virtual auto onFrame() -> void = 0;
+
+    /**
+     * @brief Set the dispatcher of the UI thread the manager is used from.
+     *
+     * Batched updates are then sent after maxLatency, and a coalesced resize applied after
+     * minInterval, even when no frame tick or flush comes. Without a dispatcher, the host must
+     * drive onFrame() or flush().
+     *
+     * @param dispatcher The UI dispatcher, or nullptr to stop scheduling flushes.
+     */
+    virtual auto setUiDispatcher(std::shared_ptr<UiDispatcher> dispatcher) -> void = 0;
+
+    /**
+     * @brief Configure how content updates are batched.
+     *
+     * Pending updates are flushed before the new configuration applies.
+     *
+     * @param batching The batching configuration.
+     */
+    virtual auto setUpdateBatching(const ContentUpdateBatching& batching) -> void = 0;
+
+    /**
+     * @brief Get the counters of the content updates sent to the view.
+     *
+     * @return ContentUpdateStats The counters.
+     */
+    [[nodiscard]] virtual auto getUpdateStats() const -> ContentUpdateStats = 0;
+
+    /**
+     * @brief Set the encoding content messages should use when the view supports it.
+     *
+     * Takes effect at the next negotiation, when the view reports what it can decode.
+     *
+     * @param encoding The preferred encoding, JSON by default.
+     */
+    virtual auto setPayloadEncoding(utils::PayloadEncoding encoding) -> void = 0;
+
+    /**
+     * @brief Pick the encoding of the content messages from the ones the view can decode.
+     *
+     * The preferred encoding is used if the view lists it, JSON otherwise.
+     *
+     * @param viewEncodings Names of the encodings the view can decode.
+     */
+    virtual auto negotiatePayloadEncoding(const std::vector<std::string>& viewEncodings) -> void = 0;
+
+    /**
+     * @brief Get the encoding content messages are currently sent in.
+     *
+     * @return utils::PayloadEncoding The negotiated encoding.
+     */
+    [[nodiscard]] virtual auto getPayloadEncoding() const -> utils::PayloadEncoding = 0;
+
     /**
      * @brief Destroy the content manager.
      */
@@ -84,6 +185,33 @@ public:
      */
     virtual auto resize(int width, int height) -> void = 0;
 
+    /**
+     * @brief Request a resize to the size reported by the view.
+     *
+     * Reports are coalesced: the resize is skipped when the size barely changes and applied
+     * at most once per interval, on a frame tick, see setResizeCoalescing.
+     *
+     * @param width The reported content width.
+     * @param height The reported content height.
+     */
+    virtual auto requestResize(int width, int height) -> void = 0;
+
+    /**
+     * @brief Configure how size reports are coalesced.
+     *
+     * A pending resize is applied before the new configuration applies.
+     *
+     * @param coalescing The coalescing configuration.
+     */
+    virtual auto setResizeCoalescing(const ContentResizeCoalescing& coalescing) -> void = 0;
+
+    /**
+     * @brief Get the counters of the size reports received from the view.
+     *
+     * @return ContentResizeStats The counters.
+     */
+    [[nodiscard]] virtual auto getResizeStats() const -> ContentResizeStats = 0;
+
     /**
      * @brief Add an observer to be notified of content size changes.
      *
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <nlohmann/json.hpp>
+#include <string>
+#include <string_view>
 
 #include "core_export.hpp"
 #include "window/component/message/logger/log_message_vo.hpp"
@@ -10,6 +12,9 @@ namespace palantir::window::component::message::logger {
 class PALANTIR_CORE_API LogMessageMapper {
 public:
     static auto fromJson(const nlohmann::json& json) -> LogMessageVO { return LogMessageVO{json.dump()}; }
+
+    // The event is logged as written, so the wildcard logger never parses it
+    static auto fromRawJson(std::string_view raw) -> LogMessageVO { return LogMessageVO{std::string(raw)}; }
 };
 
 }  // namespace palantir::window::component::message::logger
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <concepts>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "core_export.hpp"
+
+namespace palantir::window::component::message {
+
+/**
+ * The "event" member of a message, parsed only when a strategy asks for the json value.
+ *
+ * Built either from the raw event text found by the message scanner, which must outlive the event,
+ * or from an already parsed value. Not thread safe, a message is dispatched by one thread.
+ */
+class PALANTIR_CORE_API MessageEvent {
+public:
+    explicit MessageEvent(std::string_view raw) : raw_(raw) {}
+    explicit MessageEvent(nlohmann::json json) : json_(std::move(json)) {}
+
+    /**
+     * Get the event as written in the message.
+     *
+     * @return The raw json text, std::nullopt when the event was built from a parsed value.
+     */
+    [[nodiscard]] auto raw() const -> std::optional<std::string_view> { return raw_; }
+
+    /**
+     * Get the parsed event, parsing the raw text on the first call.
+     *
+     * @throws nlohmann::json::parse_error if the raw text is not valid json.
+     */
+    [[nodiscard]] auto json() const -> const nlohmann::json& {
+        if (!json_) {
+            json_ = nlohmann::json::parse(raw_->begin(), raw_->end());
+        }
+        return *json_;
+    }
+
+private:
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::optional<std::string_view> raw_;
+    mutable std::optional<nlohmann::json> json_;
+#pragma warning(pop)
+};
+
+/**
+ * Mapper able to build its value object from the raw event text, without parsing it.
+ */
+template <typename Mapper, typename VO>
+concept RawJsonMapper = requires(std::string_view raw) {
+    { Mapper::fromRawJson(raw) } -> std::convertible_to<VO>;
+};
+
+/**
+ * Build the value object of a strategy, from the raw text when its mapper supports it.
+ */
+template <typename Strategy>
+auto mapEvent(const MessageEvent& event) -> typename Strategy::VOType {
+    if constexpr (RawJsonMapper<typename Strategy::Mapper, typename Strategy::VOType>) {
+        if (const auto raw = event.raw()) {
+            return Strategy::Mapper::fromRawJson(*raw);
+        }
+    }
+    return Strategy::Mapper::fromJson(event.json());
+}
+
+}  // namespace palantir::window::component::message
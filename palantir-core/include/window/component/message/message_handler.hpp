@@ -1,11 +1,16 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "core_export.hpp"
+#include "utils/string_utils.hpp"
 #include "window/component/message/message_strategy_concept.hpp"
+#include "window/component/message/static_message_dispatcher.hpp"
 
 namespace palantir::window::component::message {
 
@@ -30,10 +35,24 @@ public:
      */
     auto registerStrategy(std::unique_ptr<MessageStrategyBase> strategy) -> void;
 
+    /**
+     * Register a dispatcher handling a fixed set of strategies, e.g. a StaticMessageDispatcher
+     * for the built-in ones. Dispatchers run before the strategies registered one by one.
+     *
+     * @param dispatcher The dispatcher to register.
+     */
+    auto registerDispatcher(std::unique_ptr<MessageDispatcherBase> dispatcher) -> void;
+
     /**
      * Handle a message by routing it to the appropriate strategy.
      * If no strategy is found for the message type, the message is ignored.
      *
+     * Only the top level of the message is scanned to find its type, nested values are validated
+     * but not built. The "event" member is parsed at most once, when a strategy registered for it
+     * needs the json value; mappers providing fromRawJson, such as the logger's, get the raw text.
+     * Dispatchers run first, then wildcard strategies, then the ones registered for the type.
+     * An "encoded" envelope (see utils::PayloadCodec) is unwrapped and the message it holds routed.
+     *
      * @param message The JSON message to handle as a string.
      */
     auto handleMessage(const std::string& message) const -> void;
@@ -43,6 +62,13 @@ private:
 #pragma warning(disable : 4251)
     // Collection of strategies with different parameter types
     std::vector<std::unique_ptr<MessageStrategyBase>> strategies_;
+    // Dispatchers of compile-time strategy sets
+    std::vector<std::unique_ptr<MessageDispatcherBase>> dispatchers_;
+    // Strategies registered for "*", run for every message
+    std::vector<MessageStrategyBase*> wildcardStrategies_;
+    // Strategies by event type, looked up without copying the type out of the message
+    std::unordered_map<std::string, std::vector<MessageStrategyBase*>, utils::StringUtils::StringHash, std::equal_to<>>
+        strategiesByType_;
 #pragma warning(pop)
 };
 
@@ -5,6 +5,7 @@
 #include <string>
 
 #include "core_export.hpp"
+#include "window/component/message/message_event.hpp"
 
 namespace palantir::window::component::message {
 
@@ -38,6 +39,9 @@ public:
 
     // Common execute method that accepts JSON - will be implemented by the wrapper
     virtual auto executeJson(const nlohmann::json& json) -> void = 0;
+
+    // Execute with an event parsed on demand, strategies not mapping raw text get the parsed value
+    virtual auto executeEvent(const MessageEvent& event) -> void { executeJson(event.json()); }
 };
 
 /**
@@ -59,6 +63,11 @@ public:
         strategy_->execute(param);
     }
 
+    auto executeEvent(const MessageEvent& event) -> void override {
+        auto param = mapEvent<ConcreteStrategy>(event);
+        strategy_->execute(param);
+    }
+
 private:
     std::unique_ptr<ConcreteStrategy> strategy_;
 };
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include "core_export.hpp"
+#include "window/component/message/message_event.hpp"
+#include "window/component/message/message_strategy_concept.hpp"
+
+namespace palantir::window::component::message {
+
+/**
+ * Base interface for dispatchers handling a whole set of strategies at once.
+ * The message handler makes a single call per message, the dispatcher routes it to its strategies.
+ */
+class PALANTIR_CORE_API MessageDispatcherBase {
+public:
+    MessageDispatcherBase() = default;
+    virtual ~MessageDispatcherBase() = default;
+
+    MessageDispatcherBase(const MessageDispatcherBase&) = delete;
+    auto operator=(const MessageDispatcherBase&) -> MessageDispatcherBase& = delete;
+    MessageDispatcherBase(MessageDispatcherBase&&) = delete;
+    auto operator=(MessageDispatcherBase&&) -> MessageDispatcherBase& = delete;
+
+    // Whether one of the strategies handles this event type, so the event is only parsed when needed
+    [[nodiscard]] virtual auto handles(std::string_view eventType) const -> bool = 0;
+
+    // Run every strategy handling this event type
+    virtual auto dispatch(std::string_view eventType, const MessageEvent& event) -> void = 0;
+};
+
+/**
+ * Dispatcher for a set of strategies known at compile time.
+ *
+ * The strategies are stored by value in a tuple and called directly, without the per-strategy
+ * wrapper allocation and virtual calls of TypeErasedStrategy. Meant for the built-in strategies,
+ * strategies registered at runtime (e.g. by plugins) keep going through TypeErasedStrategy.
+ * Strategies registered for "*" run before the ones registered for the event type.
+ */
+template <typename... Strategies>
+    requires(MessageStrategyConcept<Strategies> && ...)
+class StaticMessageDispatcher final : public MessageDispatcherBase {
+public:
+    /**
+     * Construct every strategy in place.
+     *
+     * @param arguments One tuple of constructor arguments per strategy, in order, e.g. std::forward_as_tuple("*").
+     */
+    template <typename... ArgumentTuples>
+        requires(sizeof...(ArgumentTuples) == sizeof...(Strategies))
+    explicit StaticMessageDispatcher(ArgumentTuples&&... arguments)
+        : strategies_(std::forward<ArgumentTuples>(arguments)...) {}
+
+    ~StaticMessageDispatcher() override = default;
+
+    StaticMessageDispatcher(const StaticMessageDispatcher&) = delete;
+    auto operator=(const StaticMessageDispatcher&) -> StaticMessageDispatcher& = delete;
+    StaticMessageDispatcher(StaticMessageDispatcher&&) = delete;
+    auto operator=(StaticMessageDispatcher&&) -> StaticMessageDispatcher& = delete;
+
+    [[nodiscard]] auto handles(std::string_view eventType) const -> bool override {
+        return std::apply(
+            [eventType](const auto&... slots) {
+                return ((isWildcard(slots.strategy) || matches(slots.strategy, eventType)) || ...);
+            },
+            strategies_);
+    }
+
+    auto dispatch(std::string_view eventType, const MessageEvent& event) -> void override {
+        std::apply(
+            [&event](auto&... slots) {
+                (runIf(slots.strategy, event, isWildcard(slots.strategy)), ...);
+            },
+            strategies_);
+        std::apply(
+            [eventType, &event](auto&... slots) {
+                (runIf(slots.strategy, event, !isWildcard(slots.strategy) && matches(slots.strategy, eventType)),
+                 ...);
+            },
+            strategies_);
+    }
+
+    /**
+     * Access a strategy of the set.
+     *
+     * @tparam Strategy The strategy type, must appear once in the set.
+     */
+    template <typename Strategy>
+    [[nodiscard]] auto get() -> Strategy& {
+        return std::get<Slot<Strategy>>(strategies_).strategy;
+    }
+
+private:
+    // Holds a non-movable strategy built from its constructor arguments
+    template <typename Strategy>
+    struct Slot {
+        template <typename ArgumentTuple>
+        explicit Slot(ArgumentTuple&& arguments)
+            : strategy(std::make_from_tuple<Strategy>(std::forward<ArgumentTuple>(arguments))) {}
+
+        Strategy strategy;
+    };
+
+    template <typename Strategy>
+    [[nodiscard]] static auto isWildcard(const Strategy& strategy) -> bool {
+        return std::string_view(strategy.getEventType()) == "*";
+    }
+
+    template <typename Strategy>
+    [[nodiscard]] static auto matches(const Strategy& strategy, std::string_view eventType) -> bool {
+        return std::string_view(strategy.getEventType()) == eventType;
+    }
+
+    template <typename Strategy>
+    static auto runIf(Strategy& strategy, const MessageEvent& event, bool selected) -> void {
+        if (selected) {
+            strategy.execute(mapEvent<Strategy>(event));
+        }
+    }
+
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::tuple<Slot<Strategies>...> strategies_;
+#pragma warning(pop)
+};
+
+}  // namespace palantir::window::component::message
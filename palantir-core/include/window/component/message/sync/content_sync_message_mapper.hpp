@@ -0,0 +1,31 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include "core_export.hpp"
+#include "window/component/message/sync/content_sync_message_vo.hpp"
+
+namespace palantir::window::component::message::sync {
+
+class PALANTIR_CORE_API ContentSyncMessageMapper {
+public:
+    static auto fromJson(const nlohmann::json& json) -> ContentSyncMessageVO {
+        ContentSyncMessageVO syncMessage;
+        if (!json.is_object()) {
+            return syncMessage;
+        }
+        if (json.contains("reason") && json["reason"].is_string()) {
+            syncMessage.reason = json["reason"].get<std::string>();
+        }
+        if (json.contains("encodings") && json["encodings"].is_array()) {
+            for (const auto& encoding : json["encodings"]) {
+                if (encoding.is_string()) {
+                    syncMessage.encodings.push_back(encoding.get<std::string>());
+                }
+            }
+        }
+        return syncMessage;
+    }
+};
+
+}  // namespace palantir::window::component::message::sync
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "core_export.hpp"
+
+namespace palantir::window::component::message::sync {
+
+/**
+ * Value Object for content synchronization requests sent by the view
+ */
+struct PALANTIR_CORE_API ContentSyncMessageVO {
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::string reason;
+    // Payload encodings the view can decode besides JSON, e.g. "msgpack"
+    std::vector<std::string> encodings;
+#pragma warning(pop)
+};
+
+}  // namespace palantir::window::component::message::sync
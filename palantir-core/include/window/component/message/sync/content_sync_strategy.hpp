@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "core_export.hpp"
+#include "window/component/icontent_manager.hpp"
+#include "window/component/message/sync/content_sync_message_mapper.hpp"
+#include "window/component/message/sync/content_sync_message_vo.hpp"
+
+namespace palantir::window::component::message::sync {
+
+/**
+ * ContentSyncStrategy - Sends a full content snapshot when the view reports it (re)loaded,
+ * so later updates can be sent as patches against a known state.
+ */
+class PALANTIR_CORE_API ContentSyncStrategy {
+public:
+    using VOType = ContentSyncMessageVO;
+    using Mapper = ContentSyncMessageMapper;
+    ContentSyncStrategy() = delete;
+    ~ContentSyncStrategy() = default;
+
+    ContentSyncStrategy(const ContentSyncStrategy&) = delete;
+    auto operator=(const ContentSyncStrategy&) -> ContentSyncStrategy& = delete;
+    ContentSyncStrategy(ContentSyncStrategy&&) = delete;
+    auto operator=(ContentSyncStrategy&&) -> ContentSyncStrategy& = delete;
+
+    /**
+     * Constructor with the event type this strategy handles.
+     *
+     * @param eventType The event type string.
+     * @param contentManager The content manager to synchronize.
+     */
+    explicit ContentSyncStrategy(std::string eventType, const std::shared_ptr<IContentManager>& contentManager);
+
+    /**
+     * Execute the strategy using the strongly typed value object
+     *
+     * @param syncMessage The typed sync message value object
+     */
+    auto execute(const ContentSyncMessageVO& syncMessage) -> void;
+
+    /**
+     * Get the event type this strategy handles.
+     *
+     * @return The event type string.
+     */
+    [[nodiscard]] auto getEventType() const -> const std::string&;
+
+private:
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::string eventType_;
+    std::shared_ptr<IContentManager> contentManager_;
+#pragma warning(pop)
+};
+
+}  // namespace palantir::window::component::message::sync
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core_export.hpp"
+#include "window/component/message/static_message_dispatcher.hpp"
+
+namespace palantir::window::component::webview {
+
+/**
+ * @brief Artificial costs the headless view spends, busy waiting, to stand in for a real view.
+ */
+struct HeadlessViewCosts {
+    // Per executeJavaScript call
+    std::chrono::nanoseconds script{0};
+    // Per postMessage call, plus perKilobyte for every 1024 bytes posted
+    std::chrono::nanoseconds post{0};
+    std::chrono::nanoseconds perKilobyte{0};
+    // Per resize call, e.g. a layout pass
+    std::chrono::nanoseconds resize{0};
+};
+
+/**
+ * @brief Counters of the calls received by the headless view.
+ */
+struct HeadlessViewStats {
+    uint64_t scripts{0};
+    uint64_t posts{0};
+    uint64_t postedBytes{0};
+    uint64_t resizes{0};
+    uint64_t handledMessages{0};
+};
+
+/**
+ * @class HeadlessView
+ * @brief A view with no window, usable as the view type of ContentManager on any platform.
+ *
+ * It provides the same calls as WebView, records what it receives and routes incoming messages
+ * through a real MessageHandler, so the content pipeline can be tested and profiled end to end.
+ * Recording keeps every script and message in memory, disable it for long benchmarks.
+ */
+class PALANTIR_CORE_API HeadlessView {
+public:
+    HeadlessView();
+    ~HeadlessView();
+
+    HeadlessView(const HeadlessView&) = delete;
+    auto operator=(const HeadlessView&) -> HeadlessView& = delete;
+    HeadlessView(HeadlessView&&) noexcept = delete;
+    auto operator=(HeadlessView&&) noexcept -> HeadlessView& = delete;
+
+    /**
+     * @brief Initialize the view, the callback is called at once.
+     *
+     * @param nativeWindowHandle Ignored, kept for interface parity.
+     * @param initCallback Called when the view is ready.
+     */
+    auto initialize(uintptr_t nativeWindowHandle, std::function<void()> initCallback) -> void;
+
+    auto loadURL(const std::string& url) -> void;
+
+    auto executeJavaScript(const std::string& script) -> void;
+
+    auto postMessage(const std::string& jsonMessage) -> void;
+
+    auto destroy() -> void;
+
+    auto resize(int width, int height) -> void;
+
+    auto registerMessageStrategy(std::unique_ptr<message::MessageStrategyBase> strategy) -> void;
+
+    auto registerMessageDispatcher(std::unique_ptr<message::MessageDispatcherBase> dispatcher) -> void;
+
+    /**
+     * @brief Handle a message as if the page had posted it.
+     *
+     * @param message The JSON message.
+     */
+    auto handleMessage(const std::string& message) -> void;
+
+    /**
+     * @brief Set the artificial costs of the following calls.
+     */
+    auto setCosts(const HeadlessViewCosts& costs) -> void;
+
+    /**
+     * @brief Enable or disable the recording of scripts, messages and sizes, enabled by default.
+     */
+    auto setRecording(bool enabled) -> void;
+
+    /**
+     * @brief Forget the recorded calls and reset the counters.
+     */
+    auto clear() -> void;
+
+    [[nodiscard]] auto getStats() const -> HeadlessViewStats;
+
+    [[nodiscard]] auto getExecutedScripts() const -> const std::vector<std::string>&;
+
+    [[nodiscard]] auto getPostedMessages() const -> const std::vector<std::string>&;
+
+    [[nodiscard]] auto getResizes() const -> const std::vector<std::pair<int, int>>&;
+
+    [[nodiscard]] auto getUrl() const -> const std::string&;
+
+    [[nodiscard]] auto isInitialized() const -> bool;
+
+private:
+    class HeadlessViewImpl;
+#pragma warning(push)
+#pragma warning(disable : 4251)
+    std::unique_ptr<HeadlessViewImpl> pimpl_;
+#pragma warning(pop)
+};
+
+}  // namespace palantir::window::component::webview
@@ -6,6 +6,7 @@
 
 #include "core_export.hpp"
 #include "window/component/icontent_manager.hpp"
+#include "window/component/message/static_message_dispatcher.hpp"
 
 namespace palantir::window::component::webview {
 /**
@@ -69,6 +70,16 @@ public:
      */
     virtual void sendMessageToJS(const std::string& message);
 
+    /**
+     * @brief Posts a structured message to the page through the native web message channel.
+     *
+     * Unlike executeJavaScript nothing is compiled, the page receives the message already
+     * parsed. Used for all content traffic, executeJavaScript is kept for the post-navigation scripts.
+     *
+     * @param jsonMessage The message, serialized as JSON.
+     */
+    virtual void postMessage(const std::string& jsonMessage);
+
     /**
      * @brief Reloads the current page in the web view.
      */
@@ -140,6 +151,13 @@ public:
      */
     virtual auto registerMessageStrategy(std::unique_ptr<message::MessageStrategyBase> strategy) -> void;
 
+    /**
+     * @brief Registers a dispatcher for a fixed set of message strategies.
+     *
+     * @param dispatcher The message dispatcher to register.
+     */
+    virtual auto registerMessageDispatcher(std::unique_ptr<message::MessageDispatcherBase> dispatcher) -> void;
+
     /**
      * @brief Handles a message from the web view.
      *
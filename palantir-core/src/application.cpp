@@ -18,8 +18,11 @@ public:
     explicit ApplicationImpl() {
         DebugLog("Creating application");
         signalManager_ = std::make_shared<signal::KeyboardSignalManager>();
+        uiDispatcher_ = std::make_shared<UiDispatcher>();
     }
 
+    auto prepareSignals() const -> void { signalManager_->prepareSignals(); }
+
     auto attachSignals() const -> void {
         DebugLog("Attaching signals from configuration");
         signalManager_->startSignals();
@@ -30,8 +33,11 @@ public:
         return signalManager_;
     }
 
+    [[nodiscard]] auto getUiDispatcher() const -> const std::shared_ptr<UiDispatcher>& { return uiDispatcher_; }
+
 private:
     std::shared_ptr<signal::ISignalManager> signalManager_;
+    std::shared_ptr<UiDispatcher> uiDispatcher_;
 };
 
 auto Application::getInstance() -> std::shared_ptr<Application> { return instance_; }
@@ -53,6 +59,12 @@ auto Application::getWindowManager() const -> const std::shared_ptr<window::Wind
     return window::WindowManager::getInstance();
 }
 
+auto Application::getUiDispatcher() const -> const std::shared_ptr<UiDispatcher>& {
+    return pImpl_->getUiDispatcher();
+}
+
+auto Application::prepareSignals() -> void { pImpl_->prepareSignals(); }
+
 auto Application::attachSignals() -> void { pImpl_->attachSignals(); }
 
 }  // namespace palantir
\ No newline at end of file
@@ -0,0 +1,267 @@
+#include "client/ai_request_strategy.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <stop_token>
+#include <thread>
+#include <utility>
+
+#include "exception/exceptions.hpp"
+#include "utils/logger.hpp"
+
+namespace palantir::client {
+
+std::shared_ptr<AIRequestStrategy> AIRequestStrategy::instance_;
+
+namespace {
+// Every benchmark worker asks for the strategy at once
+std::mutex instanceMutex;
+}  // namespace
+
+class AIRequestStrategy::AIRequestStrategyImpl {
+public:
+    explicit AIRequestStrategyImpl(AIRequestStrategyConfig config) : config_(std::move(config)) {}
+
+    AIRequestStrategyImpl(const AIRequestStrategyImpl&) = delete;
+    auto operator=(const AIRequestStrategyImpl&) -> AIRequestStrategyImpl& = delete;
+    AIRequestStrategyImpl(AIRequestStrategyImpl&&) = delete;
+    auto operator=(AIRequestStrategyImpl&&) -> AIRequestStrategyImpl& = delete;
+
+    // In-flight losers are joined here, their stop tokens are requested by the jthread destructors
+    ~AIRequestStrategyImpl() = default;
+
+    auto execute(const std::shared_ptr<sauron::client::SauronClient>& sauronClient, const std::string& prompt,
+                 const std::vector<std::string>& images) -> sauron::dto::AIAlgorithmResponse {
+        reapFinishedRaces();
+        const auto config = getConfig();
+        if (config.mode == AIRequestMode::SINGLE || config.backends.size() == 1) {
+            return executeSingle(sauronClient, config.backends.front(), prompt, images);
+        }
+        const auto hedgeDelay =
+            config.mode == AIRequestMode::HEDGE ? getHedgeDelay() : std::chrono::milliseconds::zero();
+        return executeRace(sauronClient, config, hedgeDelay, prompt, images);
+    }
+
+    auto setConfig(const AIRequestStrategyConfig& config) -> void {
+        if (config.backends.empty()) {
+            throw std::invalid_argument("AI request strategy needs at least one backend");
+        }
+        std::scoped_lock lock(configMutex_);
+        config_ = config;
+    }
+
+    [[nodiscard]] auto getConfig() const -> AIRequestStrategyConfig {
+        std::scoped_lock lock(configMutex_);
+        return config_;
+    }
+
+    [[nodiscard]] auto getHedgeDelay() const -> std::chrono::milliseconds {
+        const auto config = getConfig();
+        if (!config.adaptiveHedgeDelay) {
+            return config.hedgeDelay;
+        }
+        const auto primary = stats_.snapshot(config.backends.front().name);
+        if (primary.samples < config.minSamplesForAdaptiveDelay || !primary.p95) {
+            return config.hedgeDelay;
+        }
+        return *primary.p95;
+    }
+
+    [[nodiscard]] auto getLatencyStats() -> BackendLatencyStats& { return stats_; }
+    [[nodiscard]] auto getLatencyStats() const -> const BackendLatencyStats& { return stats_; }
+
+private:
+    // State shared between the caller and the backend workers of one query
+    struct RaceState {
+        std::mutex mutex;
+        std::condition_variable_any cv;
+        std::optional<sauron::dto::AIAlgorithmResponse> winner;
+        std::string winnerName;
+        std::string lastError;
+        // Backends with an index below this value may start without waiting for their hedge delay
+        std::size_t released{1};
+        std::size_t finished{0};
+    };
+
+    struct InFlightRace {
+        std::shared_ptr<RaceState> state;
+        std::vector<std::jthread> workers;
+    };
+
+    static auto makeRequest(const AIBackend& backend, const std::string& prompt,
+                            const std::vector<std::string>& images) -> sauron::dto::AIQueryRequest {
+        auto request = sauron::dto::AIQueryRequest(prompt, backend.provider, backend.model);
+        for (const auto& image : images) {
+            request.addImage(image);
+        }
+        return request;
+    }
+
+    auto executeSingle(const std::shared_ptr<sauron::client::SauronClient>& sauronClient, const AIBackend& backend,
+                       const std::string& prompt, const std::vector<std::string>& images)
+        -> sauron::dto::AIAlgorithmResponse {
+        const auto request = makeRequest(backend, prompt, images);
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            auto response = sauronClient->queryAlgorithm(request);
+            stats_.recordSuccess(backend.name, std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                   std::chrono::steady_clock::now() - start));
+            return response;
+        } catch (const std::exception&) {
+            stats_.recordFailure(backend.name);
+            throw;
+        }
+    }
+
+    auto executeRace(const std::shared_ptr<sauron::client::SauronClient>& sauronClient,
+                     const AIRequestStrategyConfig& config, std::chrono::milliseconds hedgeDelay,
+                     const std::string& prompt, const std::vector<std::string>& images)
+        -> sauron::dto::AIAlgorithmResponse {
+        auto state = std::make_shared<RaceState>();
+        const auto backendCount = config.backends.size();
+        if (config.mode == AIRequestMode::RACE) {
+            state->released = backendCount;
+        }
+        DebugLog("Dispatching AI query to ", backendCount, " backends, hedge delay ", hedgeDelay.count(), "ms");
+
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::jthread> workers;
+        workers.reserve(backendCount);
+        for (std::size_t index = 0; index < backendCount; ++index) {
+            const auto deadline = start + hedgeDelay * static_cast<int64_t>(index);
+            workers.emplace_back([this, state, sauronClient, index, deadline, backend = config.backends[index],
+                                  request = makeRequest(config.backends[index], prompt, images)](
+                                     const std::stop_token& stopToken) {
+                runBackend(stopToken, *state, *sauronClient, index, deadline, backend, request);
+            });
+        }
+
+        std::unique_lock lock(state->mutex);
+        state->cv.wait(lock, [&state, backendCount] { return state->winner || state->finished == backendCount; });
+        if (!state->winner) {
+            const auto lastError = state->lastError;
+            lock.unlock();
+            workers.clear();
+            throw exception::TraceableException<exception::BaseException>("All AI backends failed: " + lastError);
+        }
+        auto response = *state->winner;
+        DebugLog("AI query won by ", state->winnerName);
+        lock.unlock();
+
+        for (auto& worker : workers) {
+            worker.request_stop();
+        }
+        std::scoped_lock inFlightLock(inFlightMutex_);
+        inFlight_.push_back(InFlightRace{std::move(state), std::move(workers)});
+        return response;
+    }
+
+    auto runBackend(const std::stop_token& stopToken, RaceState& state, sauron::client::SauronClient& sauronClient,
+                    std::size_t index, std::chrono::steady_clock::time_point deadline, const AIBackend& backend,
+                    const sauron::dto::AIQueryRequest& request) -> void {
+        {
+            std::unique_lock lock(state.mutex);
+            state.cv.wait_until(lock, stopToken, deadline,
+                                [&state, index] { return state.winner.has_value() || index < state.released; });
+            if (stopToken.stop_requested() || state.winner) {
+                stats_.recordCancellation(backend.name);
+                ++state.finished;
+                state.cv.notify_all();
+                return;
+            }
+            state.released = std::max(state.released, index + 1);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            auto response = sauronClient.queryAlgorithm(request);
+            stats_.recordSuccess(backend.name, std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                   std::chrono::steady_clock::now() - start));
+            std::scoped_lock lock(state.mutex);
+            if (!state.winner) {
+                state.winner = std::move(response);
+                state.winnerName = backend.name;
+            } else {
+                DebugLog("Discarding late response from ", backend.name);
+            }
+        } catch (const std::exception& e) {
+            DebugLog("AI backend ", backend.name, " failed: ", e.what());
+            stats_.recordFailure(backend.name);
+            std::scoped_lock lock(state.mutex);
+            state.lastError = e.what();
+            // Do not wait for the next hedge delay once a request is known to have failed
+            ++state.released;
+        }
+
+        std::scoped_lock lock(state.mutex);
+        ++state.finished;
+        state.cv.notify_all();
+    }
+
+    auto reapFinishedRaces() -> void {
+        std::vector<InFlightRace> finished;
+        {
+            std::scoped_lock lock(inFlightMutex_);
+            auto split = std::partition(inFlight_.begin(), inFlight_.end(), [](const InFlightRace& race) {
+                std::scoped_lock stateLock(race.state->mutex);
+                return race.state->finished < race.workers.size();
+            });
+            std::move(split, inFlight_.end(), std::back_inserter(finished));
+            inFlight_.erase(split, inFlight_.end());
+        }
+        // Joining happens here, outside of the lock, and never blocks since every worker is done
+    }
+
+    mutable std::mutex configMutex_;
+    AIRequestStrategyConfig config_;
+    BackendLatencyStats stats_;
+    std::mutex inFlightMutex_;
+    std::vector<InFlightRace> inFlight_;
+};
+
+auto AIRequestStrategy::getInstance() -> std::shared_ptr<AIRequestStrategy> {
+    std::scoped_lock lock(instanceMutex);
+    if (!instance_) {
+        instance_ = std::shared_ptr<AIRequestStrategy>(new AIRequestStrategy());
+    }
+    return instance_;
+}
+
+auto AIRequestStrategy::setInstance(const std::shared_ptr<AIRequestStrategy>& instance) -> void {
+    std::scoped_lock lock(instanceMutex);
+    instance_ = instance;
+}
+
+AIRequestStrategy::AIRequestStrategy() : AIRequestStrategy(AIRequestStrategyConfig{}) {}
+
+AIRequestStrategy::AIRequestStrategy(const AIRequestStrategyConfig& config)
+    : pimpl_(std::make_unique<AIRequestStrategyImpl>(config)) {
+    setConfig(config);
+}
+
+AIRequestStrategy::~AIRequestStrategy() = default;
+
+auto AIRequestStrategy::execute(const std::shared_ptr<sauron::client::SauronClient>& sauronClient,
+                                const std::string& prompt, const std::vector<std::string>& images)
+    -> sauron::dto::AIAlgorithmResponse {
+    return pimpl_->execute(sauronClient, prompt, images);
+}
+
+auto AIRequestStrategy::setConfig(const AIRequestStrategyConfig& config) -> void { pimpl_->setConfig(config); }
+
+auto AIRequestStrategy::getConfig() const -> AIRequestStrategyConfig { return pimpl_->getConfig(); }
+
+auto AIRequestStrategy::getHedgeDelay() const -> std::chrono::milliseconds { return pimpl_->getHedgeDelay(); }
+
+auto AIRequestStrategy::getLatencyStats() const -> const BackendLatencyStats& {
+    return std::as_const(*pimpl_).getLatencyStats();
+}
+
+auto AIRequestStrategy::getMutableLatencyStats() -> BackendLatencyStats& { return pimpl_->getLatencyStats(); }
+
+}  // namespace palantir::client
@@ -0,0 +1,111 @@
+#include "client/backend_latency_stats.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+#include "utils/latency_window.hpp"
+
+namespace palantir::client {
+
+class BackendLatencyStats::BackendLatencyStatsImpl {
+public:
+    struct Entry {
+        explicit Entry(std::size_t windowSize) : window(windowSize) {}
+
+        utils::LatencyWindow<std::chrono::milliseconds> window;
+        std::size_t successes{0};
+        std::size_t failures{0};
+        std::size_t cancellations{0};
+    };
+
+    explicit BackendLatencyStatsImpl(std::size_t windowSize) : windowSize_(std::max<std::size_t>(windowSize, 1)) {}
+
+    auto recordSuccess(const std::string& backend, std::chrono::milliseconds latency) -> void {
+        std::scoped_lock lock(mutex_);
+        auto& entry = entryOf(backend);
+        ++entry.successes;
+        entry.window.add(latency);
+    }
+
+    auto recordFailure(const std::string& backend) -> void {
+        std::scoped_lock lock(mutex_);
+        ++entryOf(backend).failures;
+    }
+
+    auto recordCancellation(const std::string& backend) -> void {
+        std::scoped_lock lock(mutex_);
+        ++entryOf(backend).cancellations;
+    }
+
+    auto percentile(const std::string& backend, double percentile) const -> std::optional<std::chrono::milliseconds> {
+        std::scoped_lock lock(mutex_);
+        auto it = entries_.find(backend);
+        if (it == entries_.end()) {
+            return std::nullopt;
+        }
+        return it->second.window.percentile(percentile);
+    }
+
+    auto snapshot(const std::string& backend) const -> BackendStatsSnapshot {
+        std::scoped_lock lock(mutex_);
+        BackendStatsSnapshot snapshot;
+        auto it = entries_.find(backend);
+        if (it == entries_.end()) {
+            return snapshot;
+        }
+        const auto& entry = it->second;
+        snapshot.successes = entry.successes;
+        snapshot.failures = entry.failures;
+        snapshot.cancellations = entry.cancellations;
+        snapshot.samples = entry.window.size();
+        const auto percentiles = entry.window.percentiles({50.0, 95.0, 99.0});
+        snapshot.p50 = percentiles[0];
+        snapshot.p95 = percentiles[1];
+        snapshot.p99 = percentiles[2];
+        return snapshot;
+    }
+
+    auto reset() -> void {
+        std::scoped_lock lock(mutex_);
+        entries_.clear();
+    }
+
+private:
+    // Called with mutex_ held
+    auto entryOf(const std::string& backend) -> Entry& {
+        return entries_.try_emplace(backend, windowSize_).first->second;
+    }
+
+    std::size_t windowSize_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+};
+
+BackendLatencyStats::BackendLatencyStats(std::size_t windowSize)
+    : pimpl_(std::make_unique<BackendLatencyStatsImpl>(windowSize)) {}
+
+BackendLatencyStats::~BackendLatencyStats() = default;
+
+auto BackendLatencyStats::recordSuccess(const std::string& backend, std::chrono::milliseconds latency) -> void {
+    pimpl_->recordSuccess(backend, latency);
+}
+
+auto BackendLatencyStats::recordFailure(const std::string& backend) -> void { pimpl_->recordFailure(backend); }
+
+auto BackendLatencyStats::recordCancellation(const std::string& backend) -> void {
+    pimpl_->recordCancellation(backend);
+}
+
+auto BackendLatencyStats::percentile(const std::string& backend, double percentile) const
+    -> std::optional<std::chrono::milliseconds> {
+    return pimpl_->percentile(backend, percentile);
+}
+
+auto BackendLatencyStats::snapshot(const std::string& backend) const -> BackendStatsSnapshot {
+    return pimpl_->snapshot(backend);
+}
+
+auto BackendLatencyStats::reset() -> void { pimpl_->reset(); }
+
+}  // namespace palantir::client
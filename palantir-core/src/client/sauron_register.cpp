@@ -1,5 +1,7 @@
 #include "client/sauron_register.hpp"
 
+#include <mutex>
+
 #include "sauron/client/SauronClient.hpp"
 #include "sauron/client/http_client_curl.hpp"
 #include "utils/logger.hpp"
@@ -10,15 +12,10 @@ std::shared_ptr<SauronRegister> SauronRegister::instance_;
 // Implementation class (PIMPL)
 class SauronRegister::Impl {
 public:
-    Impl() {
-        auto httpClient = std::make_unique<sauron::client::HttpClientCurl>("localhost:3000");
+    // The login is left to login(), so creating the register under instanceMutex stays cheap
+    explicit Impl(const std::string& serverUrl) : loginRequired(true) {
+        auto httpClient = std::make_unique<sauron::client::HttpClientCurl>(serverUrl);
         sauronClient = std::make_shared<sauron::client::SauronClient>(std::move(httpClient));
-        try {
-            sauronClient->login(sauron::dto::LoginRequest(
-                "sk-proj-*****", sauron::dto::AIProvider::OPENAI));  // put that outside the constructor
-        } catch (const std::runtime_error& e) {
-            DebugLog("Failed to login to Sauron: {}", e.what());
-        }
     }
 
     Impl(const Impl& other) = delete;
@@ -31,20 +28,38 @@ public:
     explicit Impl(const std::shared_ptr<sauron::client::SauronClient>& sauronClient) : sauronClient(sauronClient) {}
 
     std::shared_ptr<sauron::client::SauronClient> sauronClient;
+    bool loginRequired{false};
+    // Not set when the login throws, so the next caller retries it
+    std::once_flag loginOnce;
 };
 
+namespace {
+// The register can be created by a startup task while a command asks for it
+std::mutex instanceMutex;
+}  // namespace
+
 // Singleton instance
 auto SauronRegister::getInstance() -> std::shared_ptr<SauronRegister> {
+    std::scoped_lock lock(instanceMutex);
     if (!instance_) {
         instance_ = std::shared_ptr<SauronRegister>(new SauronRegister());
     }
     return instance_;
 }
 
-auto SauronRegister::setInstance(const std::shared_ptr<SauronRegister>& instance) -> void { instance_ = instance; }
+auto SauronRegister::setInstance(const std::shared_ptr<SauronRegister>& instance) -> void {
+    std::scoped_lock lock(instanceMutex);
+    instance_ = instance;
+}
+
+auto SauronRegister::createForServer(const std::string& serverUrl) -> std::shared_ptr<SauronRegister> {
+    return std::shared_ptr<SauronRegister>(new SauronRegister(serverUrl));
+}
 
 // Constructor
-SauronRegister::SauronRegister() : pImpl_(std::make_unique<Impl>()) {}  // NOLINT
+SauronRegister::SauronRegister() : SauronRegister(std::string(DEFAULT_SERVER_URL)) {}  // NOLINT
+
+SauronRegister::SauronRegister(const std::string& serverUrl) : pImpl_(std::make_unique<Impl>(serverUrl)) {}
 
 SauronRegister::SauronRegister(const std::shared_ptr<sauron::client::SauronClient>& sauronClient)
     : pImpl_(std::make_unique<Impl>(sauronClient)) {}
@@ -52,8 +67,21 @@ SauronRegister::SauronRegister(const std::shared_ptr<sauron::client::SauronClien
 // Destructor
 SauronRegister::~SauronRegister() = default;
 
+auto SauronRegister::login() const -> void {
+    std::call_once(pImpl_->loginOnce, [this]() {
+        if (pImpl_->loginRequired) {
+            pImpl_->sauronClient->login(sauron::dto::LoginRequest("sk-proj-*****", sauron::dto::AIProvider::OPENAI));
+        }
+    });
+}
+
 // Client accessor
 auto SauronRegister::getSauronClient() const -> std::shared_ptr<sauron::client::SauronClient> {
+    try {
+        login();
+    } catch (const std::runtime_error& e) {
+        PALANTIR_LOG_WARN("Failed to login to Sauron: {}", e.what());
+    }
     return pImpl_->sauronClient;
 }
 
@@ -2,6 +2,7 @@
 
 #include "command/command_factory.hpp"
 
+#include <mutex>
 #include <unordered_map>
 
 #include "command/icommand.hpp"
@@ -10,6 +11,12 @@
 namespace palantir::command {
 
 std::shared_ptr<CommandFactory> CommandFactory::instance_;
+
+namespace {
+// Plugins register their commands while being initialized in parallel
+std::mutex instanceMutex;
+}  // namespace
+
 class CommandFactory::CommandFactoryImpl {
 public:
     CommandFactoryImpl() = default;
@@ -21,18 +28,30 @@ public:
 
     std::unordered_map<std::string, CommandFactory::CommandCreator, utils::StringUtils::StringHash, std::equal_to<>>
         commands_;
+    std::mutex mutex_;
 
     auto registerCommand(const std::string& commandName, const CommandCreator& creator) -> void {
+        std::scoped_lock lock(mutex_);
         commands_[commandName] = creator;
     }
 
     [[nodiscard]] auto unregisterCommand(const std::string& commandName) -> bool {
+        std::scoped_lock lock(mutex_);
         return commands_.erase(commandName) > 0;
     }
 
     auto getCommand(const std::string& name) -> std::unique_ptr<ICommand> {
-        auto maybeCommand = commands_.find(name);
-        return maybeCommand != commands_.end() ? maybeCommand->second() : nullptr;
+        CommandCreator creator;
+        {
+            std::scoped_lock lock(mutex_);
+            auto maybeCommand = commands_.find(name);
+            if (maybeCommand == commands_.end()) {
+                return nullptr;
+            }
+            creator = maybeCommand->second;
+        }
+        // The command may itself use the factory
+        return creator();
     }
 };
 
@@ -41,13 +60,17 @@ CommandFactory::CommandFactory() : pimpl_(std::make_unique<CommandFactoryImpl>()
 CommandFactory::~CommandFactory() = default;
 
 auto CommandFactory::getInstance() -> std::shared_ptr<CommandFactory> {
+    std::scoped_lock lock(instanceMutex);
     if (!instance_) {
         instance_ = std::shared_ptr<CommandFactory>(new CommandFactory());
     }
     return instance_;
 }
 
-auto CommandFactory::setInstance(const std::shared_ptr<CommandFactory>& instance) -> void { instance_ = instance; }
+auto CommandFactory::setInstance(const std::shared_ptr<CommandFactory>& instance) -> void {
+    std::scoped_lock lock(instanceMutex);
+    instance_ = instance;
+}
 
 auto CommandFactory::registerCommand(const std::string& commandName, const CommandCreator& creator) -> void {
     pimpl_->registerCommand(commandName, creator);
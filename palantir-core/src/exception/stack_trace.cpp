@@ -0,0 +1,244 @@
+#include "exception/stack_trace.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#if defined(_WIN32) || defined(_WIN64)
+#define STACK_TRACE_WINDOWS
+// clang-format off
+#include <windows.h>
+#include <DbgHelp.h>
+#pragma comment(lib, "DbgHelp.lib")
+// clang-format on
+#elif defined(__APPLE__) || defined(__MACH__) || defined(__linux__) || defined(__unix__)
+#define STACK_TRACE_EXECINFO
+#include <cxxabi.h>
+#include <execinfo.h>
+#endif
+
+namespace palantir::exception {
+
+namespace {
+
+#if defined(STACK_TRACE_EXECINFO)
+auto demangle(const char* name) -> std::string {
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    std::string result = (status == 0 && demangled != nullptr) ? demangled : name;
+    free(demangled);  // NOLINT
+    return result;
+}
+
+// Turn a backtrace_symbols line into "<function> [<line>]" on Linux or "<line>: <function> + <offset>" on macOS
+auto describe(char* symbol) -> std::string {
+    std::ostringstream text;
+#if defined(__APPLE__) || defined(__MACH__)
+    char* beginName = nullptr;
+    char* beginOffset = nullptr;
+    char* endOffset = nullptr;
+    for (char* p = symbol; *p; ++p) {
+        if (*p == '(') {
+            beginName = p;
+        } else if (*p == '+') {
+            beginOffset = p;
+        } else if (*p == ')' && beginOffset) {
+            endOffset = p;
+            break;
+        }
+    }
+    if (beginName && beginOffset && endOffset && beginName < beginOffset) {
+        *beginName++ = '\0';
+        *beginOffset++ = '\0';
+        *endOffset = '\0';
+        text << symbol << ": " << demangle(beginName) << " + " << beginOffset;
+    } else {
+        text << symbol;
+    }
+#else
+    char* mangledName = nullptr;
+    char* offsetBegin = nullptr;
+    char* offsetEnd = nullptr;
+    for (char* p = symbol; *p; ++p) {
+        if (*p == '(') {
+            mangledName = p + 1;
+        } else if (*p == '+') {
+            offsetBegin = p;
+        } else if (*p == ')') {
+            offsetEnd = p;
+            break;
+        }
+    }
+    if (mangledName && offsetBegin && offsetEnd && mangledName < offsetBegin) {
+        *offsetBegin++ = '\0';
+        *offsetEnd = '\0';
+        text << demangle(mangledName) << " [" << symbol << "]";
+    } else {
+        text << symbol;
+    }
+#endif
+    return text.str();
+}
+#endif
+
+}  // namespace
+
+auto StackTrace::current(std::size_t skip) -> StackTrace {
+    StackTrace trace;
+    // Skip current() itself as well
+    const auto dropped = skip + 1;
+#if defined(STACK_TRACE_WINDOWS)
+    trace.size_ = CaptureStackBackTrace(static_cast<DWORD>(dropped), static_cast<DWORD>(MAX_FRAMES),
+                                        trace.frames_.data(), nullptr);
+#elif defined(STACK_TRACE_EXECINFO)
+    std::array<void*, MAX_FRAMES + 8> frames{};
+    const auto captured = static_cast<std::size_t>(backtrace(frames.data(), static_cast<int>(frames.size())));
+    for (std::size_t i = dropped; i < captured && trace.size_ < MAX_FRAMES; ++i) {
+        trace.frames_[trace.size_++] = frames[i];
+    }
+#else
+    static_cast<void>(dropped);
+#endif
+    return trace;
+}
+
+auto StackTrace::toString() const -> std::string {
+#if !defined(STACK_TRACE_WINDOWS) && !defined(STACK_TRACE_EXECINFO)
+    return "Stack trace not available on this platform";
+#else
+    auto& resolver = StackTraceResolver::getInstance();
+    std::string trace = "Stack trace:\n";
+    for (void* frame : getFrames()) {
+        trace.append("\t").append(resolver.resolve(frame)).append("\n");
+    }
+    return trace;
+#endif
+}
+
+class StackTraceResolver::StackTraceResolverImpl {
+public:
+    StackTraceResolverImpl() = default;
+
+    ~StackTraceResolverImpl() {
+#if defined(STACK_TRACE_WINDOWS)
+        if (initialized_) {
+            SymCleanup(GetCurrentProcess());
+        }
+#endif
+    }
+
+    StackTraceResolverImpl(const StackTraceResolverImpl&) = delete;
+    auto operator=(const StackTraceResolverImpl&) -> StackTraceResolverImpl& = delete;
+    StackTraceResolverImpl(StackTraceResolverImpl&&) = delete;
+    auto operator=(StackTraceResolverImpl&&) -> StackTraceResolverImpl& = delete;
+
+    auto resolve(void* address) -> std::string {
+        std::scoped_lock lock(mutex_);
+        const auto key = reinterpret_cast<std::uintptr_t>(address);  // NOLINT
+        if (auto it = cache_.find(key); it != cache_.end()) {
+            return it->second;
+        }
+        if (cache_.size() >= MAX_CACHED_FRAMES) {
+            cache_.clear();
+        }
+        return cache_.emplace(key, symbolize(address)).first->second;
+    }
+
+    auto getCachedFrameCount() -> std::size_t {
+        std::scoped_lock lock(mutex_);
+        return cache_.size();
+    }
+
+    auto clear() -> void {
+        std::scoped_lock lock(mutex_);
+        cache_.clear();
+#if defined(STACK_TRACE_WINDOWS)
+        if (initialized_) {
+            SymRefreshModuleList(GetCurrentProcess());
+        }
+#endif
+    }
+
+private:
+#if defined(STACK_TRACE_WINDOWS)
+    auto symbolize(void* address) -> std::string {
+        HANDLE process = GetCurrentProcess();
+        if (!initialized_) {
+            // Deferred loads: module symbols are read when an address of the module is first resolved
+            SymSetOptions(SymGetOptions() | SYMOPT_DEFERRED_LOADS | SYMOPT_UNDNAME | SYMOPT_LOAD_LINES);
+            initialized_ = SymInitialize(process, nullptr, TRUE) != FALSE;
+        }
+
+        alignas(SYMBOL_INFO) std::array<char, sizeof(SYMBOL_INFO) + MAX_SYM_NAME> buffer{};
+        auto* symbol = reinterpret_cast<SYMBOL_INFO*>(buffer.data());  // NOLINT
+        symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+        symbol->MaxNameLen = MAX_SYM_NAME;
+        const auto address64 = reinterpret_cast<DWORD64>(address);  // NOLINT
+
+        BOOL found = SymFromAddr(process, address64, nullptr, symbol);
+        if (!found) {
+            // The address may belong to a module loaded after initialization, e.g. a plugin
+            SymRefreshModuleList(process);
+            found = SymFromAddr(process, address64, nullptr, symbol);
+        }
+        std::ostringstream text;
+        if (found) {
+            text << symbol->Name;
+        } else {
+            text << address;
+        }
+
+        IMAGEHLP_LINE64 line{};
+        line.SizeOfStruct = sizeof(IMAGEHLP_LINE64);
+        DWORD displacement = 0;
+        if (SymGetLineFromAddr64(process, address64, &displacement, &line)) {
+            text << " at " << line.FileName << ":" << line.LineNumber;
+        } else {
+            text << " at unknown location";
+        }
+        return text.str();
+    }
+
+    bool initialized_{false};
+#elif defined(STACK_TRACE_EXECINFO)
+    static auto symbolize(void* address) -> std::string {
+        char** symbols = backtrace_symbols(&address, 1);
+        if (symbols == nullptr) {
+            std::ostringstream text;
+            text << address;
+            return text.str();
+        }
+        auto text = describe(symbols[0]);
+        free(symbols);  // NOLINT
+        return text;
+    }
+#else
+    static auto symbolize(void* address) -> std::string {
+        std::ostringstream text;
+        text << address;
+        return text.str();
+    }
+#endif
+
+    std::mutex mutex_;
+    std::unordered_map<std::uintptr_t, std::string> cache_;
+};
+
+auto StackTraceResolver::getInstance() -> StackTraceResolver& {
+    static StackTraceResolver instance;
+    return instance;
+}
+
+StackTraceResolver::StackTraceResolver() : pimpl_(std::make_unique<StackTraceResolverImpl>()) {}
+
+StackTraceResolver::~StackTraceResolver() = default;
+
+auto StackTraceResolver::resolve(void* address) -> std::string { return pimpl_->resolve(address); }
+
+auto StackTraceResolver::getCachedFrameCount() const -> std::size_t { return pimpl_->getCachedFrameCount(); }
+
+auto StackTraceResolver::clear() -> void { pimpl_->clear(); }
+
+}  // namespace palantir::exception
@@ -74,17 +74,27 @@ auto KeyConfig::loadConfig(const std::filesystem::path& configPath) -> void {
         config.key.erase(0, config.key.find_first_not_of(" \t"));
         config.key.erase(config.key.find_last_not_of(" \t") + 1);
 
-        DebugLog("Loaded shortcut for {}: {}+{}", command, config.modifier, config.key);
+        PALANTIR_LOG_DEBUG("Loaded shortcut for {}: {}+{}", command, config.modifier, config.key);
         shortcuts_[command] = std::move(config);
     }
 }
 
 auto KeyConfig::getShortcut(const std::string& commandName) const -> const ShortcutConfig& {
-    if (!hasShortcut(commandName)) {
+    const auto shortcut = tryGetShortcut(commandName);
+    if (!shortcut) {
         throw palantir::exception::TraceableShortcutConfigurationException("No shortcut configured for command: " +
                                                                            commandName);
     }
-    return shortcuts_.at(commandName);
+    return shortcut->get();
+}
+
+auto KeyConfig::tryGetShortcut(const std::string& commandName) const
+    -> utils::Expected<std::reference_wrapper<const ShortcutConfig>, KeyError> {
+    const auto it = shortcuts_.find(commandName);
+    if (it == shortcuts_.end()) {
+        return utils::makeUnexpected(KeyError::SHORTCUT_NOT_FOUND);
+    }
+    return std::cref(it->second);
 }
 
 auto KeyConfig::hasShortcut(const std::string& commandName) const -> bool { return shortcuts_.contains(commandName); }
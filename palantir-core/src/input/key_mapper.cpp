@@ -19,16 +19,28 @@ namespace palantir::input {
  * The key name must be one of the predefined values in the key register.
  */
 auto KeyMapper::getKeyCode(const std::string& keyName) -> int {
-    DebugLog("Looking up key code for: {}", keyName);
-
-    const auto upperKey = utils::StringUtils::toUpper(keyName);
-    if (!KeyRegister::getInstance()->hasKey(upperKey)) {
-        DebugLog("Invalid key name: {}", upperKey);
+    const auto keyCode = tryGetKeyCode(keyName);
+    if (!keyCode) {
         throw std::invalid_argument("Invalid key name: " + keyName);
     }
+    return *keyCode;
+}
 
-    int keyCode = KeyRegister::getInstance()->get(upperKey);
-    DebugLog("Found key code: 0x{:x}", keyCode);
+/**
+ * @brief Get the virtual key code for a given key name without throwing.
+ * @param keyName The name of the key to look up.
+ * @return The virtual key code, or KeyError::KEY_NOT_FOUND if the key name is not recognized.
+ */
+auto KeyMapper::tryGetKeyCode(const std::string& keyName) -> utils::Expected<int, KeyError> {
+    PALANTIR_LOG_TRACE("Looking up key code for: {}", keyName);
+
+    const auto upperKey = utils::StringUtils::toUpper(keyName);
+    auto keyCode = KeyRegister::getInstance()->tryGet(upperKey);
+    if (!keyCode) {
+        PALANTIR_LOG_WARN("Invalid key name: {}", upperKey);
+        return keyCode;
+    }
+    PALANTIR_LOG_TRACE("Found key code: {:#x}", *keyCode);
     return keyCode;
 }
 
@@ -42,16 +54,28 @@ auto KeyMapper::getKeyCode(const std::string& keyName) -> int {
  * The modifier name must be one of the predefined values in the key register.
  */
 auto KeyMapper::getModifierCode(const std::string& modifierName) -> int {
-    DebugLog("Looking up modifier code for: {}", modifierName);
-
-    const auto upperModifier = utils::StringUtils::toUpper(modifierName);
-    if (!KeyRegister::getInstance()->hasKey(upperModifier)) {
-        DebugLog("Invalid modifier name: {}", upperModifier);
+    const auto modifierCode = tryGetModifierCode(modifierName);
+    if (!modifierCode) {
         throw std::invalid_argument("Invalid modifier name: " + modifierName);
     }
+    return *modifierCode;
+}
 
-    int modifierCode = KeyRegister::getInstance()->get(upperModifier);
-    DebugLog("Found modifier code: 0x{:x}", modifierCode);
+/**
+ * @brief Get the virtual key code for a given modifier name without throwing.
+ * @param modifierName The name of the modifier to look up.
+ * @return The virtual key code, or KeyError::KEY_NOT_FOUND if the modifier name is not recognized.
+ */
+auto KeyMapper::tryGetModifierCode(const std::string& modifierName) -> utils::Expected<int, KeyError> {
+    PALANTIR_LOG_TRACE("Looking up modifier code for: {}", modifierName);
+
+    const auto upperModifier = utils::StringUtils::toUpper(modifierName);
+    auto modifierCode = KeyRegister::getInstance()->tryGet(upperModifier);
+    if (!modifierCode) {
+        PALANTIR_LOG_WARN("Invalid modifier name: {}", upperModifier);
+        return modifierCode;
+    }
+    PALANTIR_LOG_TRACE("Found modifier code: {:#x}", *modifierCode);
     return modifierCode;
 }
 
@@ -66,7 +90,7 @@ auto KeyMapper::getModifierCode(const std::string& modifierName) -> int {
 auto KeyMapper::isValidKey(const std::string& keyName) -> bool {
     const auto upperKey = utils::StringUtils::toUpper(keyName);
     bool valid = KeyRegister::getInstance()->hasKey(upperKey);
-    DebugLog("Key name '{}' is {}", upperKey, valid ? "valid" : "invalid");
+    PALANTIR_LOG_TRACE("Key name '{}' is {}", upperKey, valid ? "valid" : "invalid");
     return valid;
 }
 
@@ -81,7 +105,7 @@ auto KeyMapper::isValidKey(const std::string& keyName) -> bool {
 auto KeyMapper::isValidModifier(const std::string& modifierName) -> bool {
     const auto upperModifier = utils::StringUtils::toUpper(modifierName);
     bool valid = KeyRegister::getInstance()->hasKey(upperModifier);
-    DebugLog("Modifier name '{}' is {}", upperModifier, valid ? "valid" : "invalid");
+    PALANTIR_LOG_TRACE("Modifier name '{}' is {}", upperModifier, valid ? "valid" : "invalid");
     return valid;
 }
 
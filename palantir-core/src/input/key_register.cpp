@@ -15,12 +15,12 @@ public:
 
     auto registerKey(const std::string& key, int value) -> void { keyMap[utils::StringUtils::toUpper(key)] = value; }
 
-    [[nodiscard]] auto get(const std::string& key) const -> int {
-        try {
-            return keyMap.at(utils::StringUtils::toUpper(key));
-        } catch (const std::out_of_range&) {
-            throw std::invalid_argument("Key not found: " + key);
+    [[nodiscard]] auto tryGet(const std::string& key) const -> utils::Expected<int, KeyError> {
+        const auto it = keyMap.find(utils::StringUtils::toUpper(key));
+        if (it == keyMap.end()) {
+            return utils::makeUnexpected(KeyError::KEY_NOT_FOUND);
         }
+        return it->second;
     }
 
     [[nodiscard]] auto hasKey(const std::string& key) const -> bool {
@@ -45,7 +45,17 @@ auto KeyRegister::setInstance(const std::shared_ptr<KeyRegister>& instance) -> v
 // Public interface implementation
 void KeyRegister::registerKey(const std::string& key, int value) { pimpl_->registerKey(key, value); }
 
-auto KeyRegister::get(const std::string& key) const -> int { return pimpl_->get(key); }
+auto KeyRegister::get(const std::string& key) const -> int {
+    const auto value = tryGet(key);
+    if (!value) {
+        throw std::invalid_argument("Key not found: " + key);
+    }
+    return *value;
+}
+
+auto KeyRegister::tryGet(const std::string& key) const -> utils::Expected<int, KeyError> {
+    return pimpl_->tryGet(key);
+}
 
 auto KeyRegister::hasKey(const std::string& key) const -> bool { return pimpl_->hasKey(key); }
 }  // namespace palantir::input
\ No newline at end of file
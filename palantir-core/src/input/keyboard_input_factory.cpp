@@ -9,7 +9,7 @@
 #include "exception/exceptions.hpp"
 #include "input/key_config.hpp"
 #include "input/key_mapper.hpp"
-#include "input/keyboard_Input.hpp"
+#include "input/keyboard_input.hpp"
 #include "utils/logger.hpp"
 
 namespace palantir::input {
@@ -91,13 +91,17 @@ public:
             throw palantir::exception::TraceableInputFactoryException(
                 "InputFactory not initialized. Call initialize() first.");
         }
-        const auto& shortcut = keyConfig_->getShortcut(commandName);
-        if (!KeyMapper::isValidKey(shortcut.key) || !KeyMapper::isValidModifier(shortcut.modifier)) {
+        const auto shortcut = keyConfig_->tryGetShortcut(commandName);
+        if (!shortcut) {
+            throw palantir::exception::TraceableShortcutConfigurationException("No shortcut configured for command: " +
+                                                                               commandName);
+        }
+        const auto keyCode = KeyMapper::tryGetKeyCode(shortcut->get().key);
+        const auto modifierCode = KeyMapper::tryGetModifierCode(shortcut->get().modifier);
+        if (!keyCode || !modifierCode) {
             throw std::invalid_argument("Invalid shortcut configuration for command: " + commandName);
         }
-        int keyCode = KeyMapper::getKeyCode(shortcut.key);
-        int modifierCode = KeyMapper::getModifierCode(shortcut.modifier);
-        return std::make_unique<KeyboardInput>(keyCode, modifierCode);
+        return std::make_unique<KeyboardInput>(*keyCode, *modifierCode);
     }
 
     [[nodiscard]] auto hasShortcut(const std::string& commandName) const -> bool {
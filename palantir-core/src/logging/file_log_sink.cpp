@@ -0,0 +1,90 @@
+#include "logging/file_log_sink.hpp"
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace palantir::logging {
+
+class FileLogSink::FileLogSinkImpl {
+public:
+    FileLogSinkImpl(std::filesystem::path path, std::size_t maxBytes, std::size_t maxFiles)
+        : path_(std::move(path)), maxBytes_(maxBytes), maxFiles_(maxFiles) {
+        if (path_.has_parent_path()) {
+            std::error_code error;
+            std::filesystem::create_directories(path_.parent_path(), error);
+        }
+        if (!open()) {
+            throw std::runtime_error("Failed to open log file: " + path_.string());
+        }
+    }
+
+    // Runs on the logger thread, so a file that cannot be reopened drops lines instead of throwing
+    auto write(const LogEntry& entry) -> void {
+        line_.clear();
+        LogSink::appendLine(line_, entry);
+        if (maxBytes_ > 0 && size_ > 0 && size_ + line_.size() > maxBytes_) {
+            rotate();
+        }
+        if (!file_.is_open() && !open()) {
+            return;
+        }
+        file_.write(line_.data(), static_cast<std::streamsize>(line_.size()));
+        size_ += line_.size();
+    }
+
+    auto flush() -> void { file_.flush(); }
+
+private:
+    auto open() -> bool {
+        file_.clear();
+        file_.open(path_, std::ios::binary | std::ios::app);
+        if (!file_.is_open()) {
+            return false;
+        }
+        std::error_code error;
+        const auto size = std::filesystem::file_size(path_, error);
+        size_ = error ? 0 : static_cast<std::size_t>(size);
+        return true;
+    }
+
+    auto rotatedPath(std::size_t index) const -> std::filesystem::path {
+        return std::filesystem::path(path_.string() + "." + std::to_string(index));
+    }
+
+    // Shift <path>.N to <path>.N+1, dropping the oldest, then start a new file, retried by the next write on failure
+    auto rotate() -> void {
+        file_.close();
+        std::error_code error;
+        if (maxFiles_ == 0) {
+            std::filesystem::remove(path_, error);
+        } else {
+            std::filesystem::remove(rotatedPath(maxFiles_), error);
+            for (auto index = maxFiles_; index > 1; --index) {
+                std::filesystem::rename(rotatedPath(index - 1), rotatedPath(index), error);
+            }
+            std::filesystem::rename(path_, rotatedPath(1), error);
+        }
+        size_ = 0;
+        open();
+    }
+
+    std::filesystem::path path_;
+    std::size_t maxBytes_;
+    std::size_t maxFiles_;
+    std::ofstream file_;
+    std::size_t size_{0};
+    std::string line_;
+};
+
+FileLogSink::FileLogSink(std::filesystem::path path, std::size_t maxBytes, std::size_t maxFiles)
+    : pimpl_(std::make_unique<FileLogSinkImpl>(std::move(path), maxBytes, maxFiles)) {}
+
+FileLogSink::~FileLogSink() = default;
+
+auto FileLogSink::write(const LogEntry& entry) -> void { pimpl_->write(entry); }
+
+auto FileLogSink::flush() -> void { pimpl_->flush(); }
+
+}  // namespace palantir::logging
@@ -0,0 +1,44 @@
+#include "logging/log_sink.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <ctime>
+
+namespace palantir::logging {
+
+auto LogSink::appendLine(std::string& out, const LogEntry& entry) -> void {
+    const auto time = std::chrono::system_clock::to_time_t(entry.time);
+    const auto milliseconds =
+        std::chrono::duration_cast<std::chrono::milliseconds>(entry.time.time_since_epoch()).count() % 1000;
+    std::tm local{};
+#ifdef _WIN32
+    localtime_s(&local, &time);
+#else
+    localtime_r(&time, &local);
+#endif
+    std::array<char, 64> prefix{};
+    const auto length = std::snprintf(prefix.data(), prefix.size(), "%04d-%02d-%02d %02d:%02d:%02d.%03d %-5s ",
+                                      local.tm_year + 1900, local.tm_mon + 1, local.tm_mday, local.tm_hour,
+                                      local.tm_min, local.tm_sec, static_cast<int>(milliseconds),
+                                      getLogLevelName(entry.level).data());
+    out.append(prefix.data(), static_cast<std::size_t>(std::max(length, 0)));
+    out.append("[").append(std::to_string(entry.threadId % 100000)).append("] ");
+    out.append(entry.function).append(":").append(std::to_string(entry.line)).append(" ");
+    out.append(entry.message);
+    out.push_back('\n');
+}
+
+auto StderrLogSink::write(const LogEntry& entry) -> void {
+    line_.clear();
+    appendLine(line_, entry);
+    std::fwrite(line_.data(), 1, line_.size(), stderr);
+}
+
+auto StderrLogSink::flush() -> void { std::fflush(stderr); }
+
+auto PlatformLogSink::write(const LogEntry& entry) -> void {
+    utils::PlatformLog(entry.function, static_cast<int>(entry.line), std::string(entry.message));
+}
+
+}  // namespace palantir::logging
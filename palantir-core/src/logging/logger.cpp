@@ -0,0 +1,224 @@
+#include "logging/logger.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace palantir::logging {
+
+namespace {
+
+auto defaultLevel() -> LogLevel {
+    if (const char* name = std::getenv("PALANTIR_LOG_LEVEL"); name != nullptr) {  // NOLINT
+        if (auto level = parseLogLevel(name)) {
+            return *level;
+        }
+    }
+#ifdef DEBUG
+    return LogLevel::DBG;
+#else
+    return LogLevel::INFO;
+#endif
+}
+
+auto currentThreadId() -> uint64_t { return std::hash<std::thread::id>{}(std::this_thread::get_id()); }
+
+std::atomic<uint64_t> nextLoggerId{1};
+
+/**
+ * The ring a thread logs into, for the last logger it used. Released when the thread ends so
+ * the logger can drop it once drained.
+ */
+struct ThreadRing {
+    uint64_t loggerId{0};
+    std::shared_ptr<LogRing> ring;
+
+    ThreadRing() = default;
+    ThreadRing(const ThreadRing&) = delete;
+    auto operator=(const ThreadRing&) -> ThreadRing& = delete;
+    ThreadRing(ThreadRing&&) = delete;
+    auto operator=(ThreadRing&&) -> ThreadRing& = delete;
+
+    ~ThreadRing() {
+        if (ring) {
+            ring->release();
+        }
+    }
+};
+
+thread_local ThreadRing threadRing;
+
+std::mutex instanceMutex;
+
+}  // namespace
+
+std::shared_ptr<Logger> Logger::instance_;
+
+class Logger::LoggerImpl {
+public:
+    LoggerImpl() {
+#ifdef DEBUG
+        sinks_.push_back(std::make_shared<PlatformLogSink>());
+#endif
+        worker_ = std::jthread([this](const std::stop_token& stopToken) { run(stopToken); });
+    }
+
+    ~LoggerImpl() {
+        worker_.request_stop();
+        wake();
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+        drain();
+    }
+
+    LoggerImpl(const LoggerImpl&) = delete;
+    auto operator=(const LoggerImpl&) -> LoggerImpl& = delete;
+    LoggerImpl(LoggerImpl&&) = delete;
+    auto operator=(LoggerImpl&&) -> LoggerImpl& = delete;
+
+    auto registerRing() -> std::shared_ptr<LogRing> {
+        auto ring = std::make_shared<LogRing>(currentThreadId());
+        std::scoped_lock lock(ringsMutex_);
+        rings_.push_back(ring);
+        return ring;
+    }
+
+    auto addSink(std::shared_ptr<LogSink> sink) -> void {
+        std::scoped_lock lock(drainMutex_);
+        sinks_.push_back(std::move(sink));
+    }
+
+    auto clearSinks() -> void {
+        std::scoped_lock lock(drainMutex_);
+        sinks_.clear();
+    }
+
+    auto wake() -> void {
+        {
+            std::scoped_lock lock(wakeMutex_);
+            wakeRequested_ = true;
+        }
+        wakeCondition_.notify_one();
+    }
+
+    // Format and write everything published so far, then drop the drained rings of ended threads
+    auto drain() -> void {
+        std::scoped_lock lock(drainMutex_);
+        std::vector<std::shared_ptr<LogRing>> rings;
+        {
+            std::scoped_lock ringsLock(ringsMutex_);
+            rings = rings_;
+        }
+        std::size_t consumed = 0;
+        for (const auto& ring : rings) {
+            consumed += ring->consume([this, &ring](const LogRing::Slot& slot) { write(*ring, slot); });
+        }
+        if (consumed > 0) {
+            for (const auto& sink : sinks_) {
+                sink->flush();
+            }
+        }
+        std::scoped_lock ringsLock(ringsMutex_);
+        std::erase_if(rings_, [](const auto& ring) { return ring->isReleased() && ring->empty(); });
+    }
+
+    [[nodiscard]] auto getId() const -> uint64_t { return id_; }
+
+    auto countDropped() -> void { dropped_.fetch_add(1, std::memory_order_relaxed); }
+
+    [[nodiscard]] auto getStats() const -> LoggerStats {
+        return LoggerStats{written_.load(std::memory_order_relaxed), dropped_.load(std::memory_order_relaxed),
+                           failed_.load(std::memory_order_relaxed)};
+    }
+
+private:
+    auto run(const std::stop_token& stopToken) -> void {
+        while (!stopToken.stop_requested()) {
+            {
+                std::unique_lock lock(wakeMutex_);
+                wakeCondition_.wait_for(lock, FLUSH_INTERVAL, [this]() { return wakeRequested_; });
+                wakeRequested_ = false;
+            }
+            drain();
+        }
+    }
+
+    auto write(const LogRing& ring, const LogRing::Slot& slot) -> void {
+        message_.reset();
+        slot.format(slot.payload, message_.stream());
+        const auto text = message_.view();
+        const LogEntry entry{slot.level, slot.time, ring.getThreadId(), slot.function, slot.line, text};
+        for (const auto& sink : sinks_) {
+            // An exception escaping the logger thread would terminate the process
+            try {
+                sink->write(entry);
+            } catch (...) {
+                failed_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        written_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const uint64_t id_{nextLoggerId.fetch_add(1)};
+    std::mutex ringsMutex_;
+    std::vector<std::shared_ptr<LogRing>> rings_;
+    // Held while draining, so sinks are never called concurrently
+    std::mutex drainMutex_;
+    std::vector<std::shared_ptr<LogSink>> sinks_;
+    // Reused for every entry, so its buffer grows once instead of being freed per entry
+    MessageStream message_;
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCondition_;
+    bool wakeRequested_{false};
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> failed_{0};
+    std::jthread worker_;
+};
+
+auto Logger::getInstance() -> const std::shared_ptr<Logger>& {
+    std::scoped_lock lock(instanceMutex);
+    if (!instance_) {
+        instance_ = std::make_shared<Logger>();
+    }
+    return instance_;
+}
+
+auto Logger::setInstance(const std::shared_ptr<Logger>& instance) -> void {
+    std::scoped_lock lock(instanceMutex);
+    instance_ = instance;
+}
+
+Logger::Logger() : level_(defaultLevel()), pimpl_(std::make_unique<LoggerImpl>()) {}
+
+Logger::~Logger() = default;
+
+auto Logger::addSink(std::shared_ptr<LogSink> sink) -> void { pimpl_->addSink(std::move(sink)); }
+
+auto Logger::clearSinks() -> void { pimpl_->clearSinks(); }
+
+auto Logger::flush() -> void { pimpl_->drain(); }
+
+auto Logger::getStats() const -> LoggerStats { return pimpl_->getStats(); }
+
+auto Logger::localRing() -> LogRing& {
+    if (threadRing.loggerId != pimpl_->getId()) {
+        if (threadRing.ring) {
+            threadRing.ring->release();
+        }
+        threadRing.ring = pimpl_->registerRing();
+        threadRing.loggerId = pimpl_->getId();
+    }
+    return *threadRing.ring;
+}
+
+auto Logger::countDropped() -> void { pimpl_->countDropped(); }
+
+auto Logger::wake() -> void { pimpl_->wake(); }
+
+}  // namespace palantir::logging
@@ -0,0 +1,41 @@
+#include "input/keyboard_input.hpp"
+
+#include "utils/logger.hpp"
+
+namespace palantir::input {
+
+/**
+ * @brief Implementation details for the configurable input on Linux.
+ *
+ * Without a global keyboard state to query, the input is never active. It keeps the configured
+ * codes so headless runs parse and bind shortcuts like the other platforms.
+ */
+class KeyboardInput::Impl {
+public:
+    Impl(const Impl& other) = delete;
+    auto operator=(const Impl& other) -> Impl& = delete;
+    Impl(Impl&& other) noexcept = delete;
+    auto operator=(Impl&& other) noexcept -> Impl& = delete;
+
+    Impl(int keyCode, int modifierCode) : keyCode_(keyCode), modifierCode_(modifierCode) {
+        PALANTIR_LOG_DEBUG("Initializing configurable input: key={:#x}, modifier={:#x}", keyCode, modifierCode);
+    }
+
+    ~Impl() = default;
+
+    [[nodiscard]] auto isActive([[maybe_unused]] const std::any& event) const -> bool { return false; }
+
+private:
+    [[maybe_unused]] int keyCode_;
+    [[maybe_unused]] int modifierCode_;
+};
+
+KeyboardInput::KeyboardInput(int keyCode, int modifierCode) : pImpl_(std::make_unique<Impl>(keyCode, modifierCode)) {}
+
+KeyboardInput::~KeyboardInput() = default;
+
+auto KeyboardInput::isActive(const std::any& event) const -> bool { return pImpl_->isActive(event); }
+
+auto KeyboardInput::update() -> void {}
+
+}  // namespace palantir::input
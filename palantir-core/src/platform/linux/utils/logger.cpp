@@ -0,0 +1,12 @@
+#include "utils/logger.hpp"
+
+#include <cstdio>
+
+namespace palantir::utils {
+
+auto PlatformLog(std::string_view function, int line, const std::string& message) -> void {
+    // No debugger output channel on Linux, stderr is where a terminal or journald picks it up
+    std::fprintf(stderr, "[%.*s:%d] %s\n", static_cast<int>(function.size()), function.data(), line, message.c_str());
+}
+
+}  // namespace palantir::utils
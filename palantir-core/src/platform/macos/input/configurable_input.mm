@@ -1,4 +1,4 @@
-#include "input/keyboard_Input.hpp"
+#include "input/keyboard_input.hpp"
 #import <Carbon/Carbon.h>
 #import <Cocoa/Cocoa.h>
 #include <any>
@@ -11,7 +11,7 @@ namespace palantir::input {
 class KeyboardInput::Impl {
    public:
     explicit Impl(const int keyCode, const int modifierCode) : keyCode_(keyCode), modifierCode_(modifierCode) {
-        DebugLog("Initializing configurable input: key=0x{:x}, modifier=0x{:x}", keyCode, modifierCode);
+        PALANTIR_LOG_DEBUG("Initializing configurable input: key={:#x}, modifier={:#x}", keyCode, modifierCode);
     }
 
     Impl(const Impl&) = delete;
@@ -30,13 +30,13 @@ class KeyboardInput::Impl {
             if (nsEvent.type == NSEventTypeKeyDown || nsEvent.type == NSEventTypeKeyUp) {
                 const bool pressed = (nsEvent.keyCode == keyCode_);
                 if (pressed) {
-                    DebugLog("Key 0x{:x} is {}", keyCode_,
-                              (nsEvent.type == NSEventTypeKeyDown) ? "pressed" : "released");
+                    PALANTIR_LOG_TRACE("Key {:#x} is {}", keyCode_,
+                                       (nsEvent.type == NSEventTypeKeyDown) ? "pressed" : "released");
                 }
                 return pressed && (nsEvent.type == NSEventTypeKeyDown);
             }
         } catch (const std::bad_any_cast& e) {
-            DebugLog("Invalid event type in isKeyPressed: {}", e.what());
+            PALANTIR_LOG_WARN("Invalid event type in isKeyPressed: {}", e.what());
         }
         return false;
     }
@@ -51,11 +51,11 @@ class KeyboardInput::Impl {
 
             const bool active = (nsEvent.modifierFlags & static_cast<NSUInteger>(modifierCode_)) != 0;
             if (active) {
-                DebugLog("Modifier 0x{:x} is active", modifierCode_);
+                PALANTIR_LOG_TRACE("Modifier {:#x} is active", modifierCode_);
             }
             return active;
         } catch (const std::bad_any_cast& e) {
-            DebugLog("Invalid event type in isModifierActive: {}", e.what());
+            PALANTIR_LOG_WARN("Invalid event type in isModifierActive: {}", e.what());
         }
         return false;
     }
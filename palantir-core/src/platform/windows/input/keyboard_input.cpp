@@ -1,4 +1,4 @@
-#include "input/keyboard_Input.hpp"
+#include "input/keyboard_input.hpp"
 
 #include <Windows.h>
 
@@ -31,8 +31,12 @@ public:
      * Initializes the implementation with the specified key and modifier codes.
      * These codes are used to check the state of keyboard inputs.
      */
-    Impl(int keyCode, int modifierCode) : keyCode_(keyCode), modifierCode_(modifierCode) {
-        DebugLog("Initializing configurable input: key=0x{:x}, modifier=0x{:x}", keyCode, modifierCode);
+    Impl(int keyCode, int modifierCode)
+        : keyCode_(keyCode),
+          modifierCode_(modifierCode),
+          keyPressedMask_(static_cast<uint16_t>(
+              KeyRegister::getInstance()->tryGet("KEY_PRESSED_MASK").value_or(DEFAULT_KEY_PRESSED_MASK))) {
+        PALANTIR_LOG_DEBUG("Initializing configurable input: key={:#x}, modifier={:#x}", keyCode, modifierCode);
     }
 
     /** 
@@ -54,10 +58,9 @@ public:
      * key is currently in a pressed state.
      */
     [[nodiscard]] auto isKeyPressed([[maybe_unused]] const std::any& event) const -> bool {
-        bool pressed = (static_cast<uint16_t>(GetAsyncKeyState(keyCode_)) &
-                        static_cast<uint16_t>(KeyRegister::getInstance()->get("KEY_PRESSED_MASK"))) != 0;
+        bool pressed = (static_cast<uint16_t>(GetAsyncKeyState(keyCode_)) & keyPressedMask_) != 0;
         if (pressed) {
-            DebugLog("Key 0x{:x} is pressed", keyCode_);
+            PALANTIR_LOG_TRACE("Key {:#x} is pressed", keyCode_);
         }
         return pressed;
     }
@@ -70,10 +73,9 @@ public:
      * modifier key is currently in a pressed state.
      */
     [[nodiscard]] auto isModifierActive([[maybe_unused]] const std::any& event) const -> bool {
-        bool active = (static_cast<uint16_t>(GetAsyncKeyState(modifierCode_)) &
-                       static_cast<uint16_t>(KeyRegister::getInstance()->get("KEY_PRESSED_MASK"))) != 0;
+        bool active = (static_cast<uint16_t>(GetAsyncKeyState(modifierCode_)) & keyPressedMask_) != 0;
         if (active) {
-            DebugLog("Modifier 0x{:x} is active", modifierCode_);
+            PALANTIR_LOG_TRACE("Modifier {:#x} is active", modifierCode_);
         }
         return active;
     }
@@ -97,8 +99,12 @@ public:
     ~Impl() = default;
 
 private:
-    int keyCode_;       ///< Virtual key code for the input key
-    int modifierCode_;  ///< Virtual key code for the modifier key
+    /// High bit of GetAsyncKeyState, used when the application registered no KEY_PRESSED_MASK
+    static constexpr int DEFAULT_KEY_PRESSED_MASK = 0x8000;
+
+    int keyCode_;              ///< Virtual key code for the input key
+    int modifierCode_;         ///< Virtual key code for the modifier key
+    uint16_t keyPressedMask_;  ///< Pressed bit of GetAsyncKeyState, looked up once rather than on every poll
 };
 
 KeyboardInput::~KeyboardInput() = default;
@@ -47,8 +47,8 @@ auto CALLBACK LowLevelKeyboardProc(int nCode, WPARAM wParam, LPARAM lParam) -> L
 
         // Only check signals on key down or key up events
         if (wParam == WM_KEYDOWN || wParam == WM_KEYUP || wParam == WM_SYSKEYDOWN || wParam == WM_SYSKEYUP) {
-            DebugLog("Keyboard event: vkCode=0x%x, scanCode=0x%x, flags=0x%x", pKeyboard->vkCode, pKeyboard->scanCode,
-                      pKeyboard->flags);
+            PALANTIR_LOG_TRACE("Keyboard event: vkCode={:#x}, scanCode={:#x}, flags={:#x}", pKeyboard->vkCode,
+                               pKeyboard->scanCode, pKeyboard->flags);
             g_signalManager->checkSignals(nullptr);
         }
     }
@@ -96,7 +96,7 @@ public:
 
         if (g_keyboardHook == nullptr) {
             DWORD error = GetLastError();
-            DebugLog("Failed to install keyboard hook: error=%lu", error);
+            PALANTIR_LOG_ERROR("Failed to install keyboard hook: error={}", error);
             throw exception::KeyboardHookException("Failed to install keyboard hook");
         }
 
@@ -122,7 +122,7 @@ public:
         while ((result = GetMessage(&msg, nullptr, 0, 0)) != 0) {
             if (result == -1) {
                 DWORD error = GetLastError();
-                DebugLog("GetMessage failed: error=%lu", error);
+                PALANTIR_LOG_ERROR("GetMessage failed: error={}", error);
                 return 1;
             }
 
@@ -130,7 +130,7 @@ public:
             DispatchMessage(&msg);
         }
 
-        DebugLog("Message loop ended with exit code %d", static_cast<int>(msg.wParam));
+        PALANTIR_LOG_INFO("Message loop ended with exit code {}", static_cast<int>(msg.wParam));
         return static_cast<int>(msg.wParam);
     }
 
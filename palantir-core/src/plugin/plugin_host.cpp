@@ -0,0 +1,130 @@
+#include "plugin/plugin_host.hpp"
+
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "command/command_factory.hpp"
+#include "command/icommand.hpp"
+#include "exception/exceptions.hpp"
+#include "logging/log_macros.hpp"
+
+namespace palantir::plugin {
+
+namespace {
+
+static_assert(static_cast<int>(logging::LogLevel::TRACE) == PALANTIR_PLUGIN_LOG_TRACE &&
+              static_cast<int>(logging::LogLevel::ERR) == PALANTIR_PLUGIN_LOG_ERROR);
+
+auto toString(PalantirStringView view) -> std::string {
+    return view.data != nullptr ? std::string(view.data, view.size) : std::string();
+}
+
+// Creator registered by a plugin, released through the plugin once the factory drops it
+class CommandCreator {
+public:
+    CommandCreator(PalantirCreateCommandFunc create, void* context, PalantirReleaseFunc release)
+        : create_(create), context_(context), release_(release) {}
+
+    ~CommandCreator() {
+        if (release_ != nullptr) {
+            release_(context_);
+        }
+    }
+
+    CommandCreator(const CommandCreator&) = delete;
+    auto operator=(const CommandCreator&) -> CommandCreator& = delete;
+    CommandCreator(CommandCreator&&) = delete;
+    auto operator=(CommandCreator&&) -> CommandCreator& = delete;
+
+    [[nodiscard]] auto create(PalantirCommand* command) const -> bool { return create_(context_, command) != 0; }
+
+private:
+    PalantirCreateCommandFunc create_;
+    void* context_;
+    PalantirReleaseFunc release_;
+};
+
+// Command created by a plugin
+class AbiCommand final : public command::ICommand {
+public:
+    AbiCommand(std::string name, PalantirCommand command) : name_(std::move(name)), command_(command) {}
+
+    ~AbiCommand() override { command_.destroy(command_.self); }
+
+    AbiCommand(const AbiCommand&) = delete;
+    auto operator=(const AbiCommand&) -> AbiCommand& = delete;
+    AbiCommand(AbiCommand&&) = delete;
+    auto operator=(AbiCommand&&) -> AbiCommand& = delete;
+
+    // Rethrows the failure on the host side, like a command of the host would
+    auto execute() const -> void override {
+        PalantirStringView error{nullptr, 0};
+        if (command_.execute(command_.self, &error) == 0) {
+            throw exception::TraceablePluginCommandException("Command " + name_ + " failed: " + toString(error));
+        }
+    }
+
+    [[nodiscard]] auto useDebounce() const -> bool override { return command_.useDebounce(command_.self) != 0; }
+
+private:
+    std::string name_;
+    PalantirCommand command_;
+};
+
+auto registerCommand(void* /*context*/, PalantirStringView name, PalantirCreateCommandFunc create,
+                     void* createContext, PalantirReleaseFunc release) -> int {
+    // Owns createContext from here, whatever happens
+    auto creator = std::make_shared<CommandCreator>(create, createContext, release);
+    try {
+        auto commandName = toString(name);
+        if (commandName.empty() || create == nullptr) {
+            return 0;
+        }
+        command::CommandFactory::getInstance()->registerCommand(
+            commandName, [commandName, creator]() -> std::unique_ptr<command::ICommand> {
+                PalantirCommand command{};
+                if (!creator->create(&command) || command.execute == nullptr || command.useDebounce == nullptr ||
+                    command.destroy == nullptr) {
+                    PALANTIR_LOG_ERROR("Plugin failed to create command {}", commandName);
+                    return nullptr;
+                }
+                return std::make_unique<AbiCommand>(commandName, command);
+            });
+        return 1;
+    } catch (const std::exception& e) {
+        PALANTIR_LOG_ERROR("Cannot register plugin command {}: {}", toString(name), e.what());
+        return 0;
+    }
+}
+
+auto unregisterCommand(void* /*context*/, PalantirStringView name) -> int {
+    try {
+        return command::CommandFactory::getInstance()->unregisterCommand(toString(name)) ? 1 : 0;
+    } catch (const std::exception& e) {
+        PALANTIR_LOG_ERROR("Cannot unregister plugin command {}: {}", toString(name), e.what());
+        return 0;
+    }
+}
+
+auto writeLog(void* /*context*/, int32_t level, PalantirStringView message) -> void {
+    if (level < PALANTIR_PLUGIN_LOG_TRACE || level > PALANTIR_PLUGIN_LOG_ERROR) {
+        level = PALANTIR_PLUGIN_LOG_ERROR;
+    }
+    try {
+        PALANTIR_LOG(static_cast<logging::LogLevel>(level), "{}", toString(message));
+    } catch (...) {
+        // Logging must not fail a plugin
+    }
+}
+
+const PalantirHostApi HOST_API{PALANTIR_PLUGIN_ABI_VERSION, sizeof(PalantirHostApi), nullptr, &registerCommand,
+                               &unregisterCommand, &writeLog};
+
+}  // namespace
+
+auto PluginHost::getApi() -> const PalantirHostApi* { return &HOST_API; }
+
+}  // namespace palantir::plugin
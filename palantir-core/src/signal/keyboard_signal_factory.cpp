@@ -1,5 +1,6 @@
 #include "signal/keyboard_signal_factory.hpp"
 
+#include <atomic>
 #include <stdexcept>
 
 #include "command/command_factory.hpp"
@@ -11,6 +12,7 @@
 #include "input/keyboard_input_factory.hpp"
 #include "signal/signal.hpp"
 #include "utils/logger.hpp"
+#include "utils/startup_profiler.hpp"
 
 namespace palantir::signal {
 
@@ -27,9 +29,18 @@ public:
     KeyboardSignalFactoryImpl(KeyboardSignalFactoryImpl&&) = delete;
     auto operator=(KeyboardSignalFactoryImpl&&) -> KeyboardSignalFactoryImpl& = delete;
 
+    auto loadConfiguration() const -> void {
+        readConfiguration();
+        configurationLoaded_ = true;
+    }
+
     auto createSignals() const -> std::vector<std::unique_ptr<ISignal>> {
         std::vector<std::unique_ptr<ISignal>> signals;
-        inputFactory_->initialize();
+        // Read again on every call but the one following loadConfiguration(), so a rebind sees edits
+        if (!configurationLoaded_.exchange(false)) {
+            readConfiguration();
+        }
+        utils::ScopedSpan span("signals.create");
         for (const auto& commandName : inputFactory_->getConfiguredCommands()) {
             auto command = command::CommandFactory::getInstance()->getCommand(commandName);
             if (command) {
@@ -37,7 +48,7 @@ public:
                 signals.push_back(
                     std::make_unique<Signal>(std::move(input), std::move(command), command->useDebounce()));
             } else {
-                DebugLog("Unknown command in configuration: {}", commandName);
+                PALANTIR_LOG_ERROR("Unknown command in configuration: {}", commandName);
                 throw palantir::exception::TraceableUnknownCommandException("Unknown command in configuration: " +
                                                                             commandName);
             }
@@ -47,7 +58,13 @@ public:
     }
 
 private:
+    auto readConfiguration() const -> void {
+        utils::ScopedSpan span("signals.config");
+        inputFactory_->initialize();
+    }
+
     std::shared_ptr<input::IInputFactory> inputFactory_;
+    mutable std::atomic<bool> configurationLoaded_{false};
 };
 
 KeyboardSignalFactory::KeyboardSignalFactory() : pimpl_(std::make_unique<KeyboardSignalFactoryImpl>()) {}  // NOLINT
@@ -60,4 +77,6 @@ auto KeyboardSignalFactory::createSignals() const -> std::vector<std::unique_ptr
     return pimpl_->createSignals();
 }
 
-}  // namespace palantir::signal
\ No newline at end of file
+auto KeyboardSignalFactory::loadConfiguration() const -> void { pimpl_->loadConfiguration(); }
+
+}  // namespace palantir::signal
@@ -40,6 +40,12 @@ auto KeyboardSignalManager::startSignals() const -> void {
     pImpl_->startSignals();
 }
 
+auto KeyboardSignalManager::prepareSignals() const -> void {
+    if (!pImpl_->hasSignals() && factory_) {
+        factory_->loadConfiguration();
+    }
+}
+
 auto KeyboardSignalManager::stopSignals() const -> void {
     DebugLog("Stopping signals");
     pImpl_->stopSignals();
@@ -47,4 +53,12 @@ auto KeyboardSignalManager::stopSignals() const -> void {
 
 auto KeyboardSignalManager::checkSignals(const std::any& event) const -> void { pImpl_->checkSignals(event); }
 
+auto KeyboardSignalManager::rebindSignals() const -> void {
+    if (!factory_) {
+        return;
+    }
+    DebugLog("Rebinding signals");
+    pImpl_->replaceSignals(factory_->createSignals());
+}
+
 }  // namespace palantir::signal
\ No newline at end of file
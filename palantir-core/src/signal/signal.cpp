@@ -1,8 +1,10 @@
 #include "signal/signal.hpp"
 
 #include <chrono>
+#include <exception>
 
 #include "command/icommand.hpp"
+#include "exception/traceable_exception.hpp"
 #include "input/iinput.hpp"
 #include "utils/logger.hpp"
 
@@ -35,7 +37,15 @@ auto Signal::check(const std::any& event) -> void {
 
         if (!useDebounce_ || (currentTime - lastTriggerTime_ > DEBOUNCE_TIME)) {
             DebugLog("Signal triggered");
-            command_->execute();
+            // Checked from the keyboard hook, which must not let an exception through
+            try {
+                command_->execute();
+            } catch (const exception::TraceableBaseException& e) {
+                PALANTIR_LOG_ERROR("Command of signal failed: {}", e.what());
+                DebugLog("Stack trace: ", e.getStackTraceString());
+            } catch (const std::exception& e) {
+                PALANTIR_LOG_ERROR("Command of signal failed: {}", e.what());
+            }
             lastTriggerTime_ = currentTime;
         }
     }
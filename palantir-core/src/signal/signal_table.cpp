@@ -0,0 +1,144 @@
+#include "signal/signal_table.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "utils/logger.hpp"
+
+namespace palantir::signal {
+
+class SignalTable::SignalTableImpl {
+public:
+    SignalTableImpl() = default;
+    ~SignalTableImpl() = default;
+
+    SignalTableImpl(const SignalTableImpl&) = delete;
+    auto operator=(const SignalTableImpl&) -> SignalTableImpl& = delete;
+    SignalTableImpl(SignalTableImpl&&) = delete;
+    auto operator=(SignalTableImpl&&) -> SignalTableImpl& = delete;
+
+    auto add(std::unique_ptr<ISignal> signal) -> void {
+        std::scoped_lock lock(mutex_);
+        // Copy on write, checks may still be running on the current table
+        auto next = std::make_shared<SharedSignals>(*signals_);
+        next->push_back(std::move(signal));
+        signals_ = std::move(next);
+    }
+
+    [[nodiscard]] auto empty() const -> bool {
+        std::scoped_lock lock(mutex_);
+        return signals_->empty();
+    }
+
+    auto start() -> void {
+        started_ = true;
+        visit([](const SharedSignals& signals) {
+            for (const auto& signal : signals) {
+                signal->start();
+            }
+        });
+    }
+
+    auto stop() -> void {
+        started_ = false;
+        visit([](const SharedSignals& signals) {
+            for (const auto& signal : signals) {
+                signal->stop();
+            }
+        });
+    }
+
+    auto check(const std::any& event) const -> void {
+        visit([&event](const SharedSignals& signals) {
+            for (const auto& signal : signals) {
+                signal->check(event);
+            }
+        });
+    }
+
+    auto replace(Signals signals) -> void {
+        if (started_) {
+            for (const auto& signal : signals) {
+                signal->start();
+            }
+        }
+
+        auto previous = std::make_shared<SharedSignals>(std::make_move_iterator(signals.begin()),
+                                                        std::make_move_iterator(signals.end()));
+        std::unique_lock lock(mutex_);
+        signals_.swap(previous);
+        const auto generation = generation_++;
+        lock.unlock();
+
+        // Checks still running on the previous signals do not trigger their commands anymore
+        for (const auto& signal : *previous) {
+            signal->stop();
+        }
+
+        // Drain the visits of the previous signals, or of an older copy of them, before destroying the commands
+        lock.lock();
+        drained_.wait(lock, [this, generation]() { return visits_.empty() || visits_.begin()->first > generation; });
+        lock.unlock();
+        previous.reset();
+        PALANTIR_LOG_DEBUG("Signals rebound");
+    }
+
+private:
+    // Signals are shared between a table and the copies add() makes of it
+    using SharedSignals = std::vector<std::shared_ptr<ISignal>>;
+
+    // Runs a function on the current signals, replace() waits for it before destroying them
+    template <typename Function>
+    auto visit(Function&& function) const -> void {
+        // Drops the signals before the visit is counted as done, replace() must hold the last reference
+        struct Visit {
+            const SignalTableImpl& table;
+            std::shared_ptr<const SharedSignals> signals;
+            std::size_t generation;
+
+            ~Visit() {
+                signals.reset();
+                std::scoped_lock lock(table.mutex_);
+                if (auto visits = table.visits_.find(generation); --visits->second == 0) {
+                    table.visits_.erase(visits);
+                    table.drained_.notify_all();
+                }
+            }
+        };
+
+        std::unique_lock lock(mutex_);
+        Visit visit{*this, signals_, generation_};
+        ++visits_[generation_];
+        lock.unlock();
+        std::forward<Function>(function)(*visit.signals);
+    }
+
+    mutable std::mutex mutex_;
+    std::shared_ptr<SharedSignals> signals_{std::make_shared<SharedSignals>()};
+    // Bumped by replace(), with the number of visits still running by the generation they started in
+    std::size_t generation_{0};
+    mutable std::map<std::size_t, std::size_t> visits_;
+    mutable std::condition_variable drained_;
+    std::atomic<bool> started_{false};
+};
+
+SignalTable::SignalTable() : pimpl_(std::make_unique<SignalTableImpl>()) {}
+
+SignalTable::~SignalTable() = default;
+
+auto SignalTable::add(std::unique_ptr<ISignal> signal) -> void { pimpl_->add(std::move(signal)); }
+
+auto SignalTable::empty() const -> bool { return pimpl_->empty(); }
+
+auto SignalTable::start() const -> void { pimpl_->start(); }
+
+auto SignalTable::stop() const -> void { pimpl_->stop(); }
+
+auto SignalTable::check(const std::any& event) const -> void { pimpl_->check(event); }
+
+auto SignalTable::replace(Signals signals) -> void { pimpl_->replace(std::move(signals)); }
+
+}  // namespace palantir::signal
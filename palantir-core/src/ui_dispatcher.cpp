@@ -0,0 +1,271 @@
+#include "ui_dispatcher.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "exception/exceptions.hpp"
+#include "utils/latency_window.hpp"
+#include "utils/logger.hpp"
+
+namespace palantir {
+
+class UiDispatcher::UiDispatcherImpl {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        Task task;
+        Clock::time_point postedAt;
+    };
+
+    explicit UiDispatcherImpl(std::size_t latencyWindow)
+        : uiThread_(std::this_thread::get_id()), latencies_(latencyWindow) {}
+
+    ~UiDispatcherImpl() {
+        {
+            std::scoped_lock lock(timerMutex_);
+            timersStopping_ = true;
+        }
+        timerChanged_.notify_all();
+        if (timerThread_.joinable()) {
+            timerThread_.join();
+        }
+    }
+
+    UiDispatcherImpl(const UiDispatcherImpl&) = delete;
+    auto operator=(const UiDispatcherImpl&) -> UiDispatcherImpl& = delete;
+    UiDispatcherImpl(UiDispatcherImpl&&) = delete;
+    auto operator=(UiDispatcherImpl&&) -> UiDispatcherImpl& = delete;
+
+    auto attachToCurrentThread() -> void { uiThread_.store(std::this_thread::get_id()); }
+
+    [[nodiscard]] auto isUiThread() const -> bool { return uiThread_.load() == std::this_thread::get_id(); }
+
+    auto setWakeup(Wakeup wakeup) -> void {
+        Wakeup pending;
+        {
+            std::scoped_lock lock(mutex_);
+            wakeup_ = std::move(wakeup);
+            // Tasks posted before the loop could be woken up would otherwise wait for the next post
+            if (wakeup_ && !queue_.empty() && !wakeupRequested_) {
+                wakeupRequested_ = true;
+                pending = wakeup_;
+            }
+        }
+        if (pending) {
+            pending();
+        }
+    }
+
+    auto setStarvationThreshold(std::chrono::microseconds threshold) -> void {
+        std::scoped_lock lock(mutex_);
+        starvationThreshold_ = threshold;
+    }
+
+    auto post(Task task) -> void {
+        Wakeup wakeup;
+        {
+            std::scoped_lock lock(mutex_);
+            queue_.push_back(Entry{std::move(task), Clock::now()});
+            ++stats_.posted;
+            // One wakeup per drain, whatever the number of tasks posted in between. Only latched
+            // when a wakeup is called, so posts made before setWakeup do not swallow the next one
+            if (!wakeupRequested_ && wakeup_) {
+                wakeupRequested_ = true;
+                wakeup = wakeup_;
+            }
+        }
+        available_.notify_one();
+        if (wakeup) {
+            wakeup();
+        }
+    }
+
+    auto postAfter(std::chrono::milliseconds delay, Task task) -> void {
+        {
+            std::scoped_lock lock(timerMutex_);
+            // Equal deadlines keep the order they were posted in
+            timers_.emplace(Clock::now() + delay, std::move(task));
+            if (!timerThread_.joinable()) {
+                timerThread_ = std::thread([this]() { runTimers(); });
+            }
+        }
+        timerChanged_.notify_one();
+    }
+
+    auto dispatch(Task task) -> void {
+        if (isUiThread()) {
+            run(task);
+            return;
+        }
+        post(std::move(task));
+    }
+
+    auto drain() -> std::size_t {
+        std::deque<Entry> batch;
+        {
+            std::scoped_lock lock(mutex_);
+            batch.swap(queue_);
+            wakeupRequested_ = false;
+        }
+        for (auto& entry : batch) {
+            record(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - entry.postedAt));
+            run(entry.task);
+        }
+        return batch.size();
+    }
+
+    auto runLoop() -> void {
+        attachToCurrentThread();
+        DebugLog("UI dispatcher loop started");
+        while (true) {
+            {
+                std::unique_lock lock(mutex_);
+                available_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+                if (stopping_) {
+                    stopping_ = false;
+                    break;
+                }
+            }
+            drain();
+        }
+        DebugLog("UI dispatcher loop stopped");
+    }
+
+    auto stop() -> void {
+        {
+            std::scoped_lock lock(mutex_);
+            stopping_ = true;
+        }
+        available_.notify_all();
+    }
+
+    [[nodiscard]] auto getStats() const -> UiDispatcherStats {
+        std::scoped_lock lock(mutex_);
+        auto stats = stats_;
+        stats.pending = queue_.size();
+        stats.samples = latencies_.size();
+        const auto percentiles = latencies_.percentiles({50.0, 95.0, 99.0});
+        stats.p50 = percentiles[0];
+        stats.p95 = percentiles[1];
+        stats.p99 = percentiles[2];
+        return stats;
+    }
+
+    auto resetStats() -> void {
+        std::scoped_lock lock(mutex_);
+        stats_ = UiDispatcherStats{};
+        latencies_.clear();
+    }
+
+private:
+    auto runTimers() -> void {
+        std::unique_lock lock(timerMutex_);
+        while (!timersStopping_) {
+            if (timers_.empty()) {
+                timerChanged_.wait(lock);
+                continue;
+            }
+            const auto next = timers_.begin();
+            if (next->first > Clock::now()) {
+                // Woken up early by an earlier deadline or the destructor
+                timerChanged_.wait_until(lock, next->first);
+                continue;
+            }
+            auto task = std::move(next->second);
+            timers_.erase(next);
+            lock.unlock();
+            post(std::move(task));
+            lock.lock();
+        }
+    }
+
+    auto record(std::chrono::microseconds latency) -> void {
+        std::scoped_lock lock(mutex_);
+        ++stats_.executed;
+        stats_.maxLatency = std::max(stats_.maxLatency, latency);
+        latencies_.add(latency);
+        if (latency > starvationThreshold_) {
+            ++stats_.starved;
+            DebugLog("UI task waited ", latency.count(), "us before running, the UI thread is starved");
+        }
+    }
+
+    auto run(const Task& task) -> void {
+        try {
+            task();
+        } catch (const exception::TraceableBaseException& e) {
+            countFailure();
+            DebugLog("Exception in UI task: ", e.what());
+            DebugLog("Stack trace: ", e.getStackTraceString());
+        } catch (const std::exception& e) {
+            countFailure();
+            DebugLog("Exception in UI task: ", e.what());
+        } catch (...) {
+            countFailure();
+            DebugLog("Unknown exception in UI task");
+        }
+    }
+
+    auto countFailure() -> void {
+        std::scoped_lock lock(mutex_);
+        ++stats_.failed;
+    }
+
+    std::atomic<std::thread::id> uiThread_;
+    mutable std::mutex mutex_;
+    std::condition_variable available_;
+    std::deque<Entry> queue_;
+    Wakeup wakeup_;
+    bool wakeupRequested_{false};
+    bool stopping_{false};
+    std::chrono::microseconds starvationThreshold_{DEFAULT_STARVATION_THRESHOLD};
+    UiDispatcherStats stats_;
+    utils::LatencyWindow<std::chrono::microseconds> latencies_;
+
+    // Delayed tasks by deadline, kept apart from mutex_ so waiting never blocks post()
+    std::mutex timerMutex_;
+    std::condition_variable timerChanged_;
+    std::multimap<Clock::time_point, Task> timers_;
+    bool timersStopping_{false};
+    std::thread timerThread_;
+};
+
+UiDispatcher::UiDispatcher(std::size_t latencyWindow) : pimpl_(std::make_unique<UiDispatcherImpl>(latencyWindow)) {}
+
+UiDispatcher::~UiDispatcher() = default;
+
+auto UiDispatcher::attachToCurrentThread() -> void { pimpl_->attachToCurrentThread(); }
+
+auto UiDispatcher::isUiThread() const -> bool { return pimpl_->isUiThread(); }
+
+auto UiDispatcher::setWakeup(Wakeup wakeup) -> void { pimpl_->setWakeup(std::move(wakeup)); }
+
+auto UiDispatcher::setStarvationThreshold(std::chrono::microseconds threshold) -> void {
+    pimpl_->setStarvationThreshold(threshold);
+}
+
+auto UiDispatcher::post(Task task) -> void { pimpl_->post(std::move(task)); }
+
+auto UiDispatcher::postAfter(std::chrono::milliseconds delay, Task task) -> void {
+    pimpl_->postAfter(delay, std::move(task));
+}
+
+auto UiDispatcher::dispatch(Task task) -> void { pimpl_->dispatch(std::move(task)); }
+
+auto UiDispatcher::drain() -> std::size_t { return pimpl_->drain(); }
+
+auto UiDispatcher::runLoop() -> void { pimpl_->runLoop(); }
+
+auto UiDispatcher::stop() -> void { pimpl_->stop(); }
+
+auto UiDispatcher::getStats() const -> UiDispatcherStats { return pimpl_->getStats(); }
+
+auto UiDispatcher::resetStats() -> void { pimpl_->resetStats(); }
+
+}  // namespace palantir
@@ -0,0 +1,93 @@
+#include "utils/payload_codec.hpp"
+
+#include <stdexcept>
+
+#include "utils/json_utils.hpp"
+#include "utils/string_utils.hpp"
+
+namespace palantir::utils {
+
+auto PayloadCodec::getName(PayloadEncoding encoding) -> std::string_view {
+    switch (encoding) {
+        case PayloadEncoding::MSGPACK:
+            return "msgpack";
+        case PayloadEncoding::CBOR:
+            return "cbor";
+        case PayloadEncoding::JSON:
+        default:
+            return "json";
+    }
+}
+
+auto PayloadCodec::parseName(std::string_view name) -> std::optional<PayloadEncoding> {
+    for (const auto encoding : {PayloadEncoding::JSON, PayloadEncoding::MSGPACK, PayloadEncoding::CBOR}) {
+        if (getName(encoding) == name) {
+            return encoding;
+        }
+    }
+    return std::nullopt;
+}
+
+auto PayloadCodec::encode(const nlohmann::json& value, PayloadEncoding encoding, std::vector<uint8_t>& out) -> void {
+    switch (encoding) {
+        case PayloadEncoding::MSGPACK:
+            nlohmann::json::to_msgpack(value, out);
+            break;
+        case PayloadEncoding::CBOR:
+            nlohmann::json::to_cbor(value, out);
+            break;
+        case PayloadEncoding::JSON:
+        default: {
+            std::string text;
+            JsonUtils::appendJson(text, value);
+            out.insert(out.end(), text.begin(), text.end());
+            break;
+        }
+    }
+}
+
+auto PayloadCodec::decode(std::span<const uint8_t> payload, PayloadEncoding encoding) -> nlohmann::json {
+    switch (encoding) {
+        case PayloadEncoding::MSGPACK:
+            return nlohmann::json::from_msgpack(payload.begin(), payload.end());
+        case PayloadEncoding::CBOR:
+            return nlohmann::json::from_cbor(payload.begin(), payload.end());
+        case PayloadEncoding::JSON:
+        default:
+            return nlohmann::json::parse(payload.begin(), payload.end());
+    }
+}
+
+auto PayloadCodec::appendMessage(std::string& out, const nlohmann::json& message, PayloadEncoding encoding,
+                                 std::vector<uint8_t>& scratch) -> void {
+    if (encoding == PayloadEncoding::JSON) {
+        JsonUtils::appendJson(out, message);
+        return;
+    }
+    scratch.clear();
+    encode(message, encoding, scratch);
+    out.append(R"({"type":")").append(ENCODED_MESSAGE_TYPE);
+    out.append(R"(","encoding":")").append(getName(encoding));
+    out.append(R"(","data":")");
+    StringUtils::appendBase64(out, scratch);
+    out.append(R"("})");
+}
+
+auto PayloadCodec::unwrapMessage(const nlohmann::json& envelope) -> nlohmann::json {
+    const auto encodingName = envelope.find("encoding");
+    const auto data = envelope.find("data");
+    if (encodingName == envelope.end() || !encodingName->is_string() || data == envelope.end() || !data->is_string()) {
+        throw std::invalid_argument("Encoded message is missing its encoding or data");
+    }
+    const auto encoding = parseName(encodingName->get_ref<const std::string&>());
+    if (!encoding) {
+        throw std::invalid_argument("Unknown payload encoding: " + encodingName->get<std::string>());
+    }
+    std::vector<uint8_t> payload;
+    if (!StringUtils::decodeBase64(data->get_ref<const std::string&>(), payload)) {
+        throw std::invalid_argument("Encoded message data is not valid base64");
+    }
+    return decode(payload, *encoding);
+}
+
+}  // namespace palantir::utils
@@ -1,6 +1,8 @@
 #include "utils/resource_utils.hpp"
 
+#include <algorithm>
 #include <cstdlib>
+#include <optional>
 
 #include "exception/exceptions.hpp"
 #include "utils/logger.hpp"
@@ -10,16 +12,40 @@ namespace palantir::utils {
 // Initialize the static instance
 std::shared_ptr<ResourceUtils> ResourceUtils::instance_ = nullptr;
 
+namespace {
+// Resources are preloaded from a startup task while the window is created
+std::mutex instanceMutex;
+
+// Detects files added, removed or modified between a preload and the load using it
+auto stampFiles(const std::filesystem::path& directory, const std::string& extension)
+    -> std::vector<std::tuple<std::string, std::filesystem::file_time_type, std::uintmax_t>> {
+    std::vector<std::tuple<std::string, std::filesystem::file_time_type, std::uintmax_t>> stamps;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+        if (entry.is_regular_file(error) && entry.path().extension() == extension) {
+            stamps.emplace_back(entry.path().filename().string(), entry.last_write_time(error),
+                                entry.file_size(error));
+        }
+    }
+    std::sort(stamps.begin(), stamps.end());
+    return stamps;
+}
+}  // namespace
+
 ResourceUtils::ResourceUtils() { initializeResourceDirectory(); }
 
 auto ResourceUtils::getInstance() -> std::shared_ptr<ResourceUtils> {
+    std::scoped_lock lock(instanceMutex);
     if (!instance_) {
         instance_ = std::shared_ptr<ResourceUtils>(new ResourceUtils());
     }
     return instance_;
 }
 
-auto ResourceUtils::setInstance(const std::shared_ptr<ResourceUtils>& instance) -> void { instance_ = instance; }
+auto ResourceUtils::setInstance(const std::shared_ptr<ResourceUtils>& instance) -> void {
+    std::scoped_lock lock(instanceMutex);
+    instance_ = instance;
+}
 
 /**
  * @brief Load a JavaScript file from the resource directory
@@ -38,7 +64,42 @@ auto ResourceUtils::loadJavaScript(const std::filesystem::path& filename) const
  */
 auto ResourceUtils::loadAllJavaScriptsFromDirectory(const std::filesystem::path& subdirectory) const
     -> std::vector<std::pair<std::string, std::string>> {
-    return readAllFilesFromDirectory(getResourceDirectory() / subdirectory, ".js");
+    const auto directory = getResourceDirectory() / subdirectory;
+    std::optional<Preloaded> preloaded;
+    {
+        std::scoped_lock lock(preloadedMutex_);
+        ++loadGenerations_[subdirectory];
+        if (auto found = preloaded_.find(subdirectory); found != preloaded_.end()) {
+            preloaded = std::move(found->second);
+            preloaded_.erase(found);
+        }
+    }
+    if (preloaded && preloaded->stamps == stampFiles(directory, ".js")) {
+        return std::move(preloaded->files);
+    }
+    return readAllFilesFromDirectory(directory, ".js");
+}
+
+/**
+ * @brief Read the JavaScript files of a subdirectory for the next loadAllJavaScriptsFromDirectory() call
+ * @param subdirectory The subdirectory within the resource directory
+ */
+auto ResourceUtils::preloadJavaScriptsFromDirectory(const std::filesystem::path& subdirectory) const -> void {
+    const auto directory = getResourceDirectory() / subdirectory;
+    std::size_t generation = 0;
+    {
+        std::scoped_lock lock(preloadedMutex_);
+        generation = loadGenerations_[subdirectory];
+    }
+    Preloaded preloaded;
+    // Stamped before reading, so a file modified while it is read does not match anymore
+    preloaded.stamps = stampFiles(directory, ".js");
+    preloaded.files = readAllFilesFromDirectory(directory, ".js");
+
+    std::scoped_lock lock(preloadedMutex_);
+    if (loadGenerations_[subdirectory] == generation) {
+        preloaded_[subdirectory] = std::move(preloaded);
+    }
 }
 
 /**
@@ -0,0 +1,191 @@
+#include "utils/startup_profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include <nlohmann/json.hpp>
+
+namespace palantir::utils {
+
+std::shared_ptr<StartupProfiler> StartupProfiler::instance_;
+
+namespace {
+std::mutex instanceMutex;
+// Mirrors isEnabled() of the instance, so disabled spans skip instanceMutex
+std::atomic<bool> recording{true};
+// Spans open on the calling thread
+thread_local std::uint32_t openSpans = 0;
+
+auto toMicroseconds(StartupProfiler::Clock::duration duration) -> long long {
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+}  // namespace
+
+class StartupProfiler::StartupProfilerImpl {
+public:
+    StartupProfilerImpl() = default;
+    ~StartupProfilerImpl() = default;
+
+    StartupProfilerImpl(const StartupProfilerImpl&) = delete;
+    auto operator=(const StartupProfilerImpl&) -> StartupProfilerImpl& = delete;
+    StartupProfilerImpl(StartupProfilerImpl&&) = delete;
+    auto operator=(StartupProfilerImpl&&) -> StartupProfilerImpl& = delete;
+
+    auto record(std::string name, Clock::time_point start, Clock::time_point end, std::uint32_t depth) -> void {
+        std::scoped_lock lock(mutex_);
+        auto [thread, inserted] =
+            threads_.try_emplace(std::this_thread::get_id(), static_cast<std::uint32_t>(threads_.size()));
+        spans_.push_back(StartupSpan{std::move(name), start, end, thread->second, depth});
+    }
+
+    [[nodiscard]] auto getSpans() const -> std::vector<StartupSpan> {
+        std::vector<StartupSpan> spans;
+        {
+            std::scoped_lock lock(mutex_);
+            spans = spans_;
+        }
+        // Enclosing spans end last, so they are recorded after the spans they hold
+        std::stable_sort(spans.begin(), spans.end(), [](const StartupSpan& left, const StartupSpan& right) {
+            return left.start != right.start ? left.start < right.start : left.depth < right.depth;
+        });
+        return spans;
+    }
+
+    [[nodiscard]] auto getOrigin() const -> Clock::time_point {
+        std::scoped_lock lock(mutex_);
+        return origin_;
+    }
+
+    auto clear() -> void {
+        std::scoped_lock lock(mutex_);
+        spans_.clear();
+        threads_.clear();
+        origin_ = Clock::now();
+    }
+
+    std::atomic<bool> enabled_{true};
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<StartupSpan> spans_;
+    std::unordered_map<std::thread::id, std::uint32_t> threads_;
+    Clock::time_point origin_{Clock::now()};
+};
+
+auto StartupProfiler::getInstance() -> const std::shared_ptr<StartupProfiler>& {
+    std::scoped_lock lock(instanceMutex);
+    if (!instance_) {
+        instance_ = std::make_shared<StartupProfiler>();
+    }
+    return instance_;
+}
+
+auto StartupProfiler::setInstance(const std::shared_ptr<StartupProfiler>& instance) -> void {
+    std::scoped_lock lock(instanceMutex);
+    instance_ = instance;
+    recording.store(!instance_ || instance_->isEnabled(), std::memory_order_relaxed);
+}
+
+auto StartupProfiler::isRecording() -> bool { return recording.load(std::memory_order_relaxed); }
+
+StartupProfiler::StartupProfiler() : pimpl_(std::make_unique<StartupProfilerImpl>()) {}
+
+StartupProfiler::~StartupProfiler() = default;
+
+auto StartupProfiler::setEnabled(bool enabled) -> void {
+    std::scoped_lock lock(instanceMutex);
+    pimpl_->enabled_.store(enabled, std::memory_order_relaxed);
+    if (instance_.get() == this) {
+        recording.store(enabled, std::memory_order_relaxed);
+    }
+}
+
+auto StartupProfiler::isEnabled() const -> bool { return pimpl_->enabled_.load(std::memory_order_relaxed); }
+
+auto StartupProfiler::record(std::string name, Clock::time_point start, Clock::time_point end, std::uint32_t depth)
+    -> void {
+    pimpl_->record(std::move(name), start, end, depth);
+}
+
+auto StartupProfiler::getSpans() const -> std::vector<StartupSpan> { return pimpl_->getSpans(); }
+
+auto StartupProfiler::getOrigin() const -> Clock::time_point { return pimpl_->getOrigin(); }
+
+auto StartupProfiler::clear() -> void { pimpl_->clear(); }
+
+auto StartupProfiler::print(std::ostream& out) const -> void {
+    const auto origin = getOrigin();
+    const auto flags = out.flags();
+    out << std::fixed << std::setprecision(3);
+    for (const auto& span : getSpans()) {
+        out << std::setw(10) << static_cast<double>(toMicroseconds(span.start - origin)) / 1000.0 << " ms  "
+            << std::string(static_cast<std::size_t>(span.depth) * 2, ' ') << span.name << "  "
+            << static_cast<double>(span.getDuration().count()) / 1000.0 << " ms";
+        if (span.thread != 0) {
+            out << "  [thread " << span.thread << "]";
+        }
+        out << "\n";
+    }
+    out.flags(flags);
+}
+
+auto StartupProfiler::writeChromeTrace(std::ostream& out) const -> void {
+    const auto origin = getOrigin();
+    auto events = nlohmann::json::array();
+    for (const auto& span : getSpans()) {
+        events.push_back({{"name", span.name},
+                          {"cat", "startup"},
+                          {"ph", "X"},
+                          {"ts", toMicroseconds(span.start - origin)},
+                          {"dur", span.getDuration().count()},
+                          {"pid", 1},
+                          {"tid", span.thread}});
+    }
+    out << nlohmann::json{{"traceEvents", std::move(events)}, {"displayTimeUnit", "ms"}}.dump();
+}
+
+auto StartupProfiler::writeChromeTrace(const std::filesystem::path& path) const -> bool {
+    std::ofstream file(path);
+    if (!file) {
+        return false;
+    }
+    writeChromeTrace(file);
+    return static_cast<bool>(file);
+}
+
+ScopedSpan::ScopedSpan(std::string name) {
+    if (StartupProfiler::isRecording()) {
+        start(std::move(name));
+    }
+}
+
+auto ScopedSpan::start(std::string name) -> void {
+    profiler_ = StartupProfiler::getInstance();
+    if (!profiler_ || !profiler_->isEnabled()) {
+        profiler_.reset();
+        return;
+    }
+    name_ = std::move(name);
+    depth_ = openSpans++;
+    start_ = StartupProfiler::Clock::now();
+}
+
+ScopedSpan::~ScopedSpan() {
+    if (!profiler_) {
+        return;
+    }
+    const auto end = StartupProfiler::Clock::now();
+    --openSpans;
+    try {
+        profiler_->record(std::move(name_), start_, end, depth_);
+    } catch (...) {
+        // A lost span must not take the startup down
+    }
+}
+
+}  // namespace palantir::utils
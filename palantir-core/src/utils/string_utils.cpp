@@ -0,0 +1,392 @@
+#include "utils/string_utils.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PALANTIR_UTF_SSE2 1
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define PALANTIR_UTF_NEON 1
+#endif
+
+namespace palantir::utils {
+
+namespace {
+
+constexpr char32_t REPLACEMENT_CHARACTER = 0xFFFD;
+constexpr char32_t MAX_BMP = 0xFFFF;
+constexpr char16_t HIGH_SURROGATE_MIN = 0xD800;
+constexpr char16_t LOW_SURROGATE_MIN = 0xDC00;
+constexpr char16_t SURROGATE_MAX = 0xDFFF;
+constexpr uint64_t ASCII_WORD_MASK = 0x8080808080808080ULL;
+constexpr uint64_t ASCII_UNITS_MASK = 0xFF80FF80FF80FF80ULL;
+
+struct DecodedSequence {
+    char32_t codePoint;
+    // Bytes consumed, an invalid sequence consumes its maximal valid prefix (at least one byte)
+    std::size_t length;
+    bool valid;
+};
+
+constexpr auto isContinuation(unsigned char byte) -> bool { return (byte & 0xC0U) == 0x80U; }
+
+/**
+ * @brief Decode the non-ASCII UTF-8 sequence starting at bytes.
+ *
+ * Follows the Unicode "maximal subpart" practice: an invalid sequence is replaced by one
+ * U+FFFD per maximal prefix that could have started a valid sequence.
+ */
+auto decodeSequence(const unsigned char* bytes, std::size_t remaining) -> DecodedSequence {
+    const unsigned char lead = bytes[0];
+    std::size_t length = 0;
+    char32_t codePoint = 0;
+    unsigned char secondMin = 0x80;
+    unsigned char secondMax = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        length = 2;
+        codePoint = lead & 0x1FU;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        length = 3;
+        codePoint = lead & 0x0FU;
+        // No overlong encodings, no UTF-16 surrogates
+        secondMin = lead == 0xE0 ? 0xA0 : 0x80;
+        secondMax = lead == 0xED ? 0x9F : 0xBF;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        length = 4;
+        codePoint = lead & 0x07U;
+        // No overlong encodings, nothing above U+10FFFF
+        secondMin = lead == 0xF0 ? 0x90 : 0x80;
+        secondMax = lead == 0xF4 ? 0x8F : 0xBF;
+    } else {
+        return {REPLACEMENT_CHARACTER, 1, false};
+    }
+
+    for (std::size_t index = 1; index < length; ++index) {
+        if (index >= remaining) {
+            return {REPLACEMENT_CHARACTER, index, false};
+        }
+        const unsigned char byte = bytes[index];
+        const bool inRange = index == 1 ? byte >= secondMin && byte <= secondMax : isContinuation(byte);
+        if (!inRange) {
+            return {REPLACEMENT_CHARACTER, index, false};
+        }
+        codePoint = (codePoint << 6U) | (byte & 0x3FU);
+    }
+    return {codePoint, length, true};
+}
+
+// Length of the ASCII run at the start of data, 16 bytes at a time when SIMD is available
+auto asciiPrefixLength(const char* data, std::size_t size) -> std::size_t {
+    std::size_t index = 0;
+#if defined(PALANTIR_UTF_SSE2)
+    for (; index + 16 <= size; index += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+        const auto mask = static_cast<unsigned int>(_mm_movemask_epi8(chunk));
+        if (mask != 0) {
+            return index + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+#elif defined(PALANTIR_UTF_NEON)
+    for (; index + 16 <= size; index += 16) {
+        if (vmaxvq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(data + index))) >= 0x80) {
+            break;
+        }
+    }
+#endif
+    for (; index + 8 <= size; index += 8) {
+        uint64_t word = 0;
+        std::memcpy(&word, data + index, sizeof(word));
+        if ((word & ASCII_WORD_MASK) != 0) {
+            break;
+        }
+    }
+    while (index < size && static_cast<unsigned char>(data[index]) < 0x80) {
+        ++index;
+    }
+    return index;
+}
+
+// Length of the run of UTF-16 units below U+0080 at the start of data
+template <typename Unit>
+auto asciiUnitsPrefixLength(const Unit* data, std::size_t size) -> std::size_t {
+    static_assert(sizeof(Unit) == 2);
+    std::size_t index = 0;
+#if defined(PALANTIR_UTF_SSE2)
+    const __m128i highBits = _mm_set1_epi16(static_cast<int16_t>(0xFF80));
+    const __m128i zero = _mm_setzero_si128();
+    for (; index + 8 <= size; index += 8) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+        const auto mask =
+            static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chunk, highBits), zero)));
+        if (mask != 0xFFFFU) {
+            return index + static_cast<std::size_t>(std::countr_one(mask)) / 2;
+        }
+    }
+#elif defined(PALANTIR_UTF_NEON)
+    for (; index + 8 <= size; index += 8) {
+        if (vmaxvq_u16(vld1q_u16(reinterpret_cast<const uint16_t*>(data + index))) >= 0x80) {
+            break;
+        }
+    }
+#endif
+    for (; index + 4 <= size; index += 4) {
+        uint64_t word = 0;
+        std::memcpy(&word, data + index, sizeof(word));
+        if ((word & ASCII_UNITS_MASK) != 0) {
+            break;
+        }
+    }
+    while (index < size && static_cast<char16_t>(data[index]) < 0x80) {
+        ++index;
+    }
+    return index;
+}
+
+template <typename Unit>
+auto widenAscii(const char* input, std::size_t size, Unit* output) -> void {
+    static_assert(sizeof(Unit) == 2);
+    std::size_t index = 0;
+#if defined(PALANTIR_UTF_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; index + 16 <= size; index += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + index), _mm_unpacklo_epi8(chunk, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + index + 8), _mm_unpackhi_epi8(chunk, zero));
+    }
+#elif defined(PALANTIR_UTF_NEON)
+    for (; index + 16 <= size; index += 16) {
+        const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(input + index));
+        vst1q_u16(reinterpret_cast<uint16_t*>(output + index), vmovl_u8(vget_low_u8(chunk)));
+        vst1q_u16(reinterpret_cast<uint16_t*>(output + index + 8), vmovl_u8(vget_high_u8(chunk)));
+    }
+#endif
+    for (; index < size; ++index) {
+        output[index] = static_cast<Unit>(static_cast<unsigned char>(input[index]));
+    }
+}
+
+template <typename Unit>
+auto narrowAscii(const Unit* input, std::size_t size, char* output) -> void {
+    static_assert(sizeof(Unit) == 2);
+    std::size_t index = 0;
+#if defined(PALANTIR_UTF_SSE2)
+    for (; index + 16 <= size; index += 16) {
+        const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index));
+        const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index + 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + index), _mm_packus_epi16(low, high));
+    }
+#elif defined(PALANTIR_UTF_NEON)
+    for (; index + 16 <= size; index += 16) {
+        const uint16x8_t low = vld1q_u16(reinterpret_cast<const uint16_t*>(input + index));
+        const uint16x8_t high = vld1q_u16(reinterpret_cast<const uint16_t*>(input + index + 8));
+        vst1q_u8(reinterpret_cast<uint8_t*>(output + index), vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+    }
+#endif
+    for (; index < size; ++index) {
+        output[index] = static_cast<char>(input[index]);
+    }
+}
+
+// Transcode into output, which must hold at least input.size() units, and return the units written
+template <typename Unit>
+auto utf8ToUtf16Units(std::string_view input, Unit* output) -> std::size_t {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(input.data());
+    const std::size_t size = input.size();
+    std::size_t read = 0;
+    std::size_t written = 0;
+    while (read < size) {
+        const std::size_t ascii = asciiPrefixLength(input.data() + read, size - read);
+        widenAscii(input.data() + read, ascii, output + written);
+        read += ascii;
+        written += ascii;
+        if (read == size) {
+            break;
+        }
+        const auto sequence = decodeSequence(bytes + read, size - read);
+        read += sequence.length;
+        if (sequence.codePoint > MAX_BMP) {
+            const char32_t offset = sequence.codePoint - 0x10000;
+            output[written++] = static_cast<Unit>(HIGH_SURROGATE_MIN + (offset >> 10U));
+            output[written++] = static_cast<Unit>(LOW_SURROGATE_MIN + (offset & 0x3FFU));
+        } else {
+            output[written++] = static_cast<Unit>(sequence.codePoint);
+        }
+    }
+    return written;
+}
+
+// Transcode into output, which must hold at least 3 * input.size() bytes, and return the bytes written
+template <typename Unit>
+auto utf16ToUtf8Bytes(const Unit* input, std::size_t size, char* output) -> std::size_t {
+    std::size_t read = 0;
+    std::size_t written = 0;
+    while (read < size) {
+        const std::size_t ascii = asciiUnitsPrefixLength(input + read, size - read);
+        narrowAscii(input + read, ascii, output + written);
+        read += ascii;
+        written += ascii;
+        if (read == size) {
+            break;
+        }
+
+        char32_t codePoint = static_cast<char16_t>(input[read++]);
+        if (codePoint >= HIGH_SURROGATE_MIN && codePoint <= SURROGATE_MAX) {
+            const bool isHigh = codePoint < LOW_SURROGATE_MIN;
+            if (isHigh && read < size && static_cast<char16_t>(input[read]) >= LOW_SURROGATE_MIN &&
+                static_cast<char16_t>(input[read]) <= SURROGATE_MAX) {
+                codePoint = 0x10000 + ((codePoint - HIGH_SURROGATE_MIN) << 10U) +
+                            (static_cast<char16_t>(input[read++]) - LOW_SURROGATE_MIN);
+            } else {
+                // Lone surrogate
+                codePoint = REPLACEMENT_CHARACTER;
+            }
+        }
+
+        if (codePoint < 0x800) {
+            output[written++] = static_cast<char>(0xC0U | (codePoint >> 6U));
+            output[written++] = static_cast<char>(0x80U | (codePoint & 0x3FU));
+        } else if (codePoint <= MAX_BMP) {
+            output[written++] = static_cast<char>(0xE0U | (codePoint >> 12U));
+            output[written++] = static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3FU));
+            output[written++] = static_cast<char>(0x80U | (codePoint & 0x3FU));
+        } else {
+            output[written++] = static_cast<char>(0xF0U | (codePoint >> 18U));
+            output[written++] = static_cast<char>(0x80U | ((codePoint >> 12U) & 0x3FU));
+            output[written++] = static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3FU));
+            output[written++] = static_cast<char>(0x80U | (codePoint & 0x3FU));
+        }
+    }
+    return written;
+}
+
+constexpr std::string_view BASE64_ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr uint8_t INVALID_SEXTET = 0xFF;
+
+constexpr auto makeBase64DecodeTable() -> std::array<uint8_t, 256> {
+    std::array<uint8_t, 256> table{};
+    table.fill(INVALID_SEXTET);
+    for (std::size_t index = 0; index < BASE64_ALPHABET.size(); ++index) {
+        table[static_cast<uint8_t>(BASE64_ALPHABET[index])] = static_cast<uint8_t>(index);
+    }
+    return table;
+}
+
+constexpr auto BASE64_DECODE_TABLE = makeBase64DecodeTable();
+
+}  // namespace
+
+auto StringUtils::utf8ToUtf16(std::string_view utf8) -> std::u16string {
+    // A UTF-8 byte never produces more than one UTF-16 unit
+    std::u16string utf16(utf8.size(), u'\0');
+    utf16.resize(utf8ToUtf16Units(utf8, utf16.data()));
+    return utf16;
+}
+
+auto StringUtils::utf16ToUtf8(std::u16string_view utf16) -> std::string {
+    // A UTF-16 unit never produces more than three UTF-8 bytes
+    std::string utf8(utf16.size() * 3, '\0');
+    utf8.resize(utf16ToUtf8Bytes(utf16.data(), utf16.size(), utf8.data()));
+    return utf8;
+}
+
+auto StringUtils::isValidUtf8(std::string_view utf8) -> bool {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(utf8.data());
+    std::size_t index = 0;
+    while (index < utf8.size()) {
+        index += asciiPrefixLength(utf8.data() + index, utf8.size() - index);
+        if (index == utf8.size()) {
+            break;
+        }
+        const auto sequence = decodeSequence(bytes + index, utf8.size() - index);
+        if (!sequence.valid) {
+            return false;
+        }
+        index += sequence.length;
+    }
+    return true;
+}
+
+auto StringUtils::isValidUtf16(std::u16string_view utf16) -> bool {
+    for (std::size_t index = 0; index < utf16.size(); ++index) {
+        const char16_t unit = utf16[index];
+        if (unit < HIGH_SURROGATE_MIN || unit > SURROGATE_MAX) {
+            continue;
+        }
+        if (unit >= LOW_SURROGATE_MIN || index + 1 == utf16.size() || utf16[index + 1] < LOW_SURROGATE_MIN ||
+            utf16[index + 1] > SURROGATE_MAX) {
+            return false;
+        }
+        ++index;
+    }
+    return true;
+}
+
+auto StringUtils::appendBase64(std::string& out, std::span<const uint8_t> bytes) -> void {
+    out.reserve(out.size() + (bytes.size() + 2) / 3 * 4);
+    std::size_t index = 0;
+    for (; index + 3 <= bytes.size(); index += 3) {
+        const uint32_t triple = (uint32_t{bytes[index]} << 16) | (uint32_t{bytes[index + 1]} << 8) | bytes[index + 2];
+        out.push_back(BASE64_ALPHABET[(triple >> 18) & 0x3F]);
+        out.push_back(BASE64_ALPHABET[(triple >> 12) & 0x3F]);
+        out.push_back(BASE64_ALPHABET[(triple >> 6) & 0x3F]);
+        out.push_back(BASE64_ALPHABET[triple & 0x3F]);
+    }
+    const std::size_t remaining = bytes.size() - index;
+    if (remaining > 0) {
+        uint32_t triple = uint32_t{bytes[index]} << 16;
+        if (remaining == 2) {
+            triple |= uint32_t{bytes[index + 1]} << 8;
+        }
+        out.push_back(BASE64_ALPHABET[(triple >> 18) & 0x3F]);
+        out.push_back(BASE64_ALPHABET[(triple >> 12) & 0x3F]);
+        out.push_back(remaining == 2 ? BASE64_ALPHABET[(triple >> 6) & 0x3F] : '=');
+        out.push_back('=');
+    }
+}
+
+auto StringUtils::decodeBase64(std::string_view text, std::vector<uint8_t>& out) -> bool {
+    if (text.size() % 4 != 0) {
+        return false;
+    }
+    out.reserve(out.size() + text.size() / 4 * 3);
+    for (std::size_t index = 0; index < text.size(); index += 4) {
+        const bool last = index + 4 == text.size();
+        const std::size_t padding = last ? (text[index + 3] == '=' ? (text[index + 2] == '=' ? 2 : 1) : 0) : 0;
+        uint32_t triple = 0;
+        for (std::size_t offset = 0; offset < 4 - padding; ++offset) {
+            const uint8_t sextet = BASE64_DECODE_TABLE[static_cast<uint8_t>(text[index + offset])];
+            if (sextet == INVALID_SEXTET) {
+                return false;
+            }
+            triple |= uint32_t{sextet} << (18 - 6 * offset);
+        }
+        out.push_back(static_cast<uint8_t>(triple >> 16));
+        if (padding < 2) {
+            out.push_back(static_cast<uint8_t>(triple >> 8));
+        }
+        if (padding < 1) {
+            out.push_back(static_cast<uint8_t>(triple));
+        }
+    }
+    return true;
+}
+
+#ifdef _WIN32
+auto StringUtils::wToStr(std::wstring_view wstr) -> std::string {
+    std::string str(wstr.size() * 3, '\0');
+    str.resize(utf16ToUtf8Bytes(wstr.data(), wstr.size(), str.data()));
+    return str;
+}
+
+auto StringUtils::strToW(std::string_view str) -> std::wstring {
+    std::wstring wstr(str.size(), L'\0');
+    wstr.resize(utf8ToUtf16Units(str, wstr.data()));
+    return wstr;
+}
+#endif
+
+}  // namespace palantir::utils
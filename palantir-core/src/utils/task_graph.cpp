@@ -0,0 +1,311 @@
+#include "utils/task_graph.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
+#include "exception/traceable_exception.hpp"
+#include "utils/logger.hpp"
+#include "utils/startup_profiler.hpp"
+#include "utils/thread_pool.hpp"
+
+namespace palantir::utils {
+
+class TaskGraph::TaskGraphImpl {
+public:
+    explicit TaskGraphImpl(std::size_t threadCount) : threadCount_(threadCount) {}
+
+    ~TaskGraphImpl() {
+        // Drops the background tasks not started yet and waits for the running ones while everything they use
+        // is alive
+        cancel();
+        pool_.reset();
+    }
+
+    TaskGraphImpl(const TaskGraphImpl&) = delete;
+    auto operator=(const TaskGraphImpl&) -> TaskGraphImpl& = delete;
+    TaskGraphImpl(TaskGraphImpl&&) = delete;
+    auto operator=(TaskGraphImpl&&) -> TaskGraphImpl& = delete;
+
+    auto addTask(const std::string& name, Task task, const std::vector<std::string>& dependencies, TaskMode mode)
+        -> void {
+        std::scoped_lock lock(mutex_);
+        if (started_) {
+            throw std::logic_error("Cannot add task " + name + ", the graph already ran");
+        }
+        if (nodes_.contains(name)) {
+            throw std::invalid_argument("Duplicate task " + name);
+        }
+        auto& node = nodes_[name];
+        node.task = std::move(task);
+        node.dependencies = dependencies;
+        node.mode = mode;
+    }
+
+    auto run() -> void {
+        std::unique_lock lock(mutex_);
+        if (started_) {
+            throw std::logic_error("The graph already ran");
+        }
+        validate();
+        started_ = true;
+
+        for (auto& [name, node] : nodes_) {
+            for (const auto& dependency : node.dependencies) {
+                nodes_[dependency].dependents.push_back(name);
+            }
+            node.pending = node.dependencies.size();
+            if (node.mode == TaskMode::BACKGROUND) {
+                ++background_;
+            } else {
+                ++waiting_;
+            }
+        }
+        if (std::any_of(nodes_.begin(), nodes_.end(),
+                        [](const auto& entry) { return entry.second.mode != TaskMode::CALLER; })) {
+            pool_ = std::make_unique<ThreadPool>(threadCount_);
+        }
+        for (auto& [name, node] : nodes_) {
+            if (node.pending == 0) {
+                schedule(name);
+            }
+        }
+
+        while (true) {
+            condition_.wait(lock, [this]() { return !callerTasks_.empty() || waiting_ == 0; });
+            if (callerTasks_.empty()) {
+                break;
+            }
+            const auto name = std::move(callerTasks_.front());
+            callerTasks_.pop_front();
+            lock.unlock();
+            auto error = execute(name);
+            lock.lock();
+            finish(name, std::move(error));
+        }
+
+        if (firstError_) {
+            std::rethrow_exception(firstError_);
+        }
+    }
+
+    auto waitForBackground() -> void {
+        std::unique_lock lock(mutex_);
+        condition_.wait(lock, [this]() { return background_ == 0; });
+        if (firstBackgroundError_) {
+            std::rethrow_exception(firstBackgroundError_);
+        }
+    }
+
+    auto cancel() -> void {
+        std::scoped_lock lock(mutex_);
+        cancelled_ = true;
+    }
+
+    [[nodiscard]] auto getFailedTasks() const -> std::vector<std::string> {
+        std::scoped_lock lock(mutex_);
+        std::vector<std::string> failed;
+        for (const auto& [name, node] : nodes_) {
+            if (node.failed) {
+                failed.push_back(name);
+            }
+        }
+        return failed;
+    }
+
+private:
+    struct Node {
+        Task task;
+        std::vector<std::string> dependencies;
+        std::vector<std::string> dependents;
+        TaskMode mode{TaskMode::WORKER};
+        std::size_t pending{0};
+        bool finished{false};
+        bool failed{false};
+    };
+
+    // Called with mutex_ held, checks the whole graph before anything runs
+    auto validate() const -> void {
+        std::map<std::string, std::size_t> pending;
+        for (const auto& [name, node] : nodes_) {
+            for (const auto& dependency : node.dependencies) {
+                auto found = nodes_.find(dependency);
+                if (found == nodes_.end()) {
+                    throw std::invalid_argument("Task " + name + " depends on unknown task " + dependency);
+                }
+                if (found->second.mode == TaskMode::BACKGROUND && node.mode != TaskMode::BACKGROUND) {
+                    throw std::invalid_argument("Task " + name + " cannot wait for background task " + dependency);
+                }
+            }
+            pending[name] = node.dependencies.size();
+        }
+
+        // Tasks never reaching zero pending dependencies are part of a cycle or depend on one
+        std::vector<std::string> ready;
+        for (const auto& [name, count] : pending) {
+            if (count == 0) {
+                ready.push_back(name);
+            }
+        }
+        std::size_t reached = 0;
+        while (!ready.empty()) {
+            const auto name = std::move(ready.back());
+            ready.pop_back();
+            ++reached;
+            for (const auto& [dependent, node] : nodes_) {
+                for (const auto& dependency : node.dependencies) {
+                    if (dependency == name && --pending[dependent] == 0) {
+                        ready.push_back(dependent);
+                    }
+                }
+            }
+        }
+        if (reached != nodes_.size()) {
+            std::string blocked;
+            for (const auto& [name, count] : pending) {
+                if (count > 0) {
+                    blocked += (blocked.empty() ? "" : ", ") + name;
+                }
+            }
+            throw std::invalid_argument("Task dependency cycle involving " + blocked);
+        }
+    }
+
+    // Called with mutex_ held
+    auto schedule(const std::string& name) -> void {
+        if (cancelled_) {
+            skip(name, false);
+            return;
+        }
+        if (nodes_[name].mode == TaskMode::CALLER) {
+            callerTasks_.push_back(name);
+            condition_.notify_all();
+            return;
+        }
+        pool_->submit([this, name]() {
+            {
+                // Queued before cancel(), never started
+                std::scoped_lock lock(mutex_);
+                if (cancelled_) {
+                    skip(name, false);
+                    return;
+                }
+            }
+            auto error = execute(name);
+            std::scoped_lock lock(mutex_);
+            finish(name, std::move(error));
+        });
+    }
+
+    // Called without mutex_, the task of a node is not touched by anything else once scheduled
+    auto execute(const std::string& name) -> std::exception_ptr {
+        Task* task = nullptr;
+        {
+            std::scoped_lock lock(mutex_);
+            task = &nodes_[name].task;
+        }
+        std::exception_ptr error;
+        try {
+            ScopedSpan span([&name]() { return name; });
+            (*task)();
+        } catch (const exception::TraceableBaseException& e) {
+            PALANTIR_LOG_ERROR("Task {} failed: {}", name, e.what());
+            error = std::current_exception();
+        } catch (const std::exception& e) {
+            PALANTIR_LOG_ERROR("Task {} failed: {}", name, e.what());
+            error = std::current_exception();
+        } catch (...) {
+            PALANTIR_LOG_ERROR("Task {} failed", name);
+            error = std::current_exception();
+        }
+        return error;
+    }
+
+    // Called with mutex_ held, a failure is passed on to every task depending on this one
+    auto finish(const std::string& name, std::exception_ptr error) -> void {
+        auto& node = nodes_[name];
+        if (node.finished) {
+            return;
+        }
+        node.finished = true;
+        node.failed = error != nullptr;
+        if (error) {
+            auto& first = node.mode == TaskMode::BACKGROUND ? firstBackgroundError_ : firstError_;
+            if (!first) {
+                first = std::move(error);
+            }
+        }
+
+        for (const auto& dependent : node.dependents) {
+            if (node.failed) {
+                if (!nodes_[dependent].finished) {
+                    PALANTIR_LOG_WARN("Task {} skipped, its dependency {} failed", dependent, name);
+                }
+                skip(dependent, true);
+            } else if (--nodes_[dependent].pending == 0 && !nodes_[dependent].finished) {
+                schedule(dependent);
+            }
+        }
+
+        done(node);
+    }
+
+    // Called with mutex_ held, for a task that never runs because a dependency failed or the graph was cancelled
+    auto skip(const std::string& name, bool failed) -> void {
+        auto& node = nodes_[name];
+        if (node.finished) {
+            return;
+        }
+        node.finished = true;
+        node.failed = failed;
+        for (const auto& dependent : node.dependents) {
+            skip(dependent, failed);
+        }
+        done(node);
+    }
+
+    // Called with mutex_ held
+    auto done(const Node& node) -> void {
+        --(node.mode == TaskMode::BACKGROUND ? background_ : waiting_);
+        condition_.notify_all();
+    }
+
+    std::size_t threadCount_;
+    // Ordered so tasks ready at once are started in name order
+    std::map<std::string, Node> nodes_;
+    std::deque<std::string> callerTasks_;
+    std::size_t waiting_{0};
+    std::size_t background_{0};
+    std::exception_ptr firstError_;
+    std::exception_ptr firstBackgroundError_;
+    bool started_{false};
+    bool cancelled_{false};
+    mutable std::mutex mutex_;
+    std::condition_variable condition_;
+    // Declared last so the workers are joined before anything they use is destroyed
+    std::unique_ptr<ThreadPool> pool_;
+};
+
+TaskGraph::TaskGraph(std::size_t threadCount) : pimpl_(std::make_unique<TaskGraphImpl>(threadCount)) {}
+
+TaskGraph::~TaskGraph() = default;
+
+auto TaskGraph::addTask(const std::string& name, Task task, const std::vector<std::string>& dependencies,
+                        TaskMode mode) -> TaskGraph& {
+    pimpl_->addTask(name, std::move(task), dependencies, mode);
+    return *this;
+}
+
+auto TaskGraph::run() -> void { pimpl_->run(); }
+
+auto TaskGraph::waitForBackground() -> void { pimpl_->waitForBackground(); }
+
+auto TaskGraph::cancel() -> void { pimpl_->cancel(); }
+
+auto TaskGraph::getFailedTasks() const -> std::vector<std::string> { return pimpl_->getFailedTasks(); }
+
+}  // namespace palantir::utils
@@ -0,0 +1,82 @@
+#include "utils/thread_pool.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace palantir::utils {
+
+class ThreadPool::ThreadPoolImpl {
+public:
+    explicit ThreadPoolImpl(std::size_t threadCount) {
+        if (threadCount == 0) {
+            threadCount = std::max(1U, std::thread::hardware_concurrency());
+        }
+        workers_.reserve(threadCount);
+        for (std::size_t i = 0; i < threadCount; ++i) {
+            workers_.emplace_back([this]() { run(); });
+        }
+    }
+
+    ~ThreadPoolImpl() {
+        {
+            std::scoped_lock lock(mutex_);
+            stopping_ = true;
+        }
+        condition_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    ThreadPoolImpl(const ThreadPoolImpl&) = delete;
+    auto operator=(const ThreadPoolImpl&) -> ThreadPoolImpl& = delete;
+    ThreadPoolImpl(ThreadPoolImpl&&) = delete;
+    auto operator=(ThreadPoolImpl&&) -> ThreadPoolImpl& = delete;
+
+    auto post(std::function<void()> task) -> void {
+        {
+            std::scoped_lock lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        condition_.notify_one();
+    }
+
+    [[nodiscard]] auto getThreadCount() const -> std::size_t { return workers_.size(); }
+
+private:
+    auto run() -> void {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mutex_);
+                condition_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<std::function<void()>> tasks_;
+    bool stopping_{false};
+    std::vector<std::thread> workers_;
+};
+
+ThreadPool::ThreadPool(std::size_t threadCount) : pimpl_(std::make_unique<ThreadPoolImpl>(threadCount)) {}
+
+ThreadPool::~ThreadPool() = default;
+
+auto ThreadPool::getThreadCount() const -> std::size_t { return pimpl_->getThreadCount(); }
+
+auto ThreadPool::post(std::function<void()> task) -> void { pimpl_->post(std::move(task)); }
+
+}  // namespace palantir::utils
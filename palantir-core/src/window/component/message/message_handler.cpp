@@ -1,39 +1,359 @@
 #include "window/component/message/message_handler.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <nlohmann/json.hpp>
+#include <optional>
 
 #include "exception/exceptions.hpp"
+#include "utils/payload_codec.hpp"
 #include "utils/logger.hpp"
 
 namespace palantir::window::component::message {
 
+namespace {
+
+constexpr std::string_view WILDCARD_EVENT_TYPE = "*";
+// Characters allowed after a backslash, besides the u of a unicode escape
+constexpr std::string_view SIMPLE_ESCAPES = "\"\\/bfnrt";
+constexpr int UNICODE_ESCAPE_DIGITS = 4;
+constexpr unsigned char CONTROL_CHARACTER_END = 0x20;
+constexpr unsigned char NON_ASCII_START = 0x80;
+constexpr std::size_t MAX_SCAN_DEPTH = 256;
+
+// Top-level members of a message, located without building a json document
+struct MessageEnvelope {
+    // Content of the "type" string, unset when missing or not a string
+    std::optional<std::string_view> type;
+    // Raw json text of the "event" value
+    std::optional<std::string_view> event;
+};
+
+/**
+ * Scans the top level of a JSON object, skipping nested values without parsing them.
+ *
+ * Nested values are still checked against the JSON grammar, so the text accepted here is the
+ * text nlohmann accepts. Anything unusual (escaped keys or type, malformed text, very deep
+ * nesting) makes scan() give up so the caller can fall back to the full parser, which keeps
+ * the exact nlohmann semantics.
+ */
+class EnvelopeScanner {
+public:
+    explicit EnvelopeScanner(std::string_view text) : text_(text) {}
+
+    auto scan() -> std::optional<MessageEnvelope> {
+        MessageEnvelope envelope;
+        skipWhitespace();
+        if (!consume('{')) {
+            return std::nullopt;
+        }
+        skipWhitespace();
+        if (!consume('}')) {
+            do {
+                skipWhitespace();
+                bool escaped = false;
+                auto key = scanString(escaped);
+                skipWhitespace();
+                if (!key || escaped || !consume(':')) {
+                    return std::nullopt;
+                }
+                skipWhitespace();
+                const auto valueStart = position_;
+                if (*key == "type" && peek() == '"') {
+                    envelope.type = scanString(escaped);
+                    if (!envelope.type || escaped) {
+                        return std::nullopt;
+                    }
+                } else {
+                    if (!skipValue()) {
+                        return std::nullopt;
+                    }
+                    if (*key == "type") {
+                        envelope.type.reset();
+                    } else if (*key == "event") {
+                        envelope.event = text_.substr(valueStart, position_ - valueStart);
+                    }
+                }
+                skipWhitespace();
+            } while (consume(','));
+            if (!consume('}')) {
+                return std::nullopt;
+            }
+        }
+        skipWhitespace();
+        if (position_ != text_.size()) {
+            return std::nullopt;
+        }
+        return envelope;
+    }
+
+private:
+    [[nodiscard]] auto peek() const -> char { return position_ < text_.size() ? text_[position_] : '\0'; }
+
+    auto consume(char expected) -> bool {
+        if (peek() != expected) {
+            return false;
+        }
+        ++position_;
+        return true;
+    }
+
+    auto skipWhitespace() -> void {
+        while (position_ < text_.size() && (text_[position_] == ' ' || text_[position_] == '\t' ||
+                                            text_[position_] == '\n' || text_[position_] == '\r')) {
+            ++position_;
+        }
+    }
+
+    // Return the raw content of the string at the current position, rejecting what the json parser rejects
+    auto scanString(bool& escaped) -> std::optional<std::string_view> {
+        if (!consume('"')) {
+            return std::nullopt;
+        }
+        const auto start = position_;
+        bool nonAscii = false;
+        while (position_ < text_.size()) {
+            const auto character = static_cast<unsigned char>(text_[position_]);
+            if (character == '"') {
+                const auto content = text_.substr(start, position_++ - start);
+                if (nonAscii && !utils::StringUtils::isValidUtf8(content)) {
+                    return std::nullopt;
+                }
+                return content;
+            }
+            if (character < CONTROL_CHARACTER_END) {
+                return std::nullopt;
+            }
+            nonAscii = nonAscii || character >= NON_ASCII_START;
+            if (character == '\\') {
+                escaped = true;
+                if (!skipEscape()) {
+                    return std::nullopt;
+                }
+                continue;
+            }
+            ++position_;
+        }
+        return std::nullopt;
+    }
+
+    // Skip the escape sequence starting at the backslash at the current position
+    auto skipEscape() -> bool {
+        ++position_;
+        const char kind = peek();
+        if (SIMPLE_ESCAPES.find(kind) != std::string_view::npos) {
+            ++position_;
+            return true;
+        }
+        if (kind != 'u') {
+            return false;
+        }
+        ++position_;
+        for (int digit = 0; digit < UNICODE_ESCAPE_DIGITS; ++digit) {
+            if (std::isxdigit(static_cast<unsigned char>(peek())) == 0) {
+                return false;
+            }
+            ++position_;
+        }
+        return true;
+    }
+
+    auto skipValue(std::size_t depth = 0) -> bool {
+        // Deeper documents are left to the json parser, which does not recurse
+        if (depth > MAX_SCAN_DEPTH) {
+            return false;
+        }
+        bool escaped = false;
+        switch (peek()) {
+            case '"':
+                return scanString(escaped).has_value();
+            case '{':
+                return skipObject(depth);
+            case '[':
+                return skipArray(depth);
+            case 't':
+                return consumeLiteral("true");
+            case 'f':
+                return consumeLiteral("false");
+            case 'n':
+                return consumeLiteral("null");
+            default:
+                return skipNumber();
+        }
+    }
+
+    auto skipObject(std::size_t depth) -> bool {
+        consume('{');
+        skipWhitespace();
+        if (consume('}')) {
+            return true;
+        }
+        do {
+            skipWhitespace();
+            bool escaped = false;
+            if (!scanString(escaped)) {
+                return false;
+            }
+            skipWhitespace();
+            if (!consume(':')) {
+                return false;
+            }
+            skipWhitespace();
+            if (!skipValue(depth + 1)) {
+                return false;
+            }
+            skipWhitespace();
+        } while (consume(','));
+        return consume('}');
+    }
+
+    auto skipArray(std::size_t depth) -> bool {
+        consume('[');
+        skipWhitespace();
+        if (consume(']')) {
+            return true;
+        }
+        do {
+            skipWhitespace();
+            if (!skipValue(depth + 1)) {
+                return false;
+            }
+            skipWhitespace();
+        } while (consume(','));
+        return consume(']');
+    }
+
+    auto consumeLiteral(std::string_view literal) -> bool {
+        if (text_.substr(position_, literal.size()) != literal) {
+            return false;
+        }
+        position_ += literal.size();
+        return true;
+    }
+
+    // -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+    auto skipNumber() -> bool {
+        consume('-');
+        if (!consume('0')) {
+            if (skipDigits() == 0) {
+                return false;
+            }
+        }
+        if (consume('.') && skipDigits() == 0) {
+            return false;
+        }
+        if (consume('e') || consume('E')) {
+            if (!consume('+')) {
+                consume('-');
+            }
+            if (skipDigits() == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    auto skipDigits() -> std::size_t {
+        const auto start = position_;
+        while (std::isdigit(static_cast<unsigned char>(peek())) != 0) {
+            ++position_;
+        }
+        return position_ - start;
+    }
+
+    std::string_view text_;
+    std::size_t position_{0};
+};
+
+}  // namespace
+
 auto MessageHandler::registerStrategy(std::unique_ptr<MessageStrategyBase> strategy) -> void {
     if (!strategy) {
         DebugLog("Attempted to register a null strategy");
         return;
     }
 
-    std::string eventType = strategy->getEventType();
-    strategies_.push_back(std::move(strategy));
+    const std::string& eventType = strategy->getEventType();
+    if (eventType == WILDCARD_EVENT_TYPE) {
+        wildcardStrategies_.push_back(strategy.get());
+    } else {
+        strategiesByType_[eventType].push_back(strategy.get());
+    }
     DebugLog("Registered strategy for event type: ", eventType);
+    strategies_.push_back(std::move(strategy));
+}
+
+auto MessageHandler::registerDispatcher(std::unique_ptr<MessageDispatcherBase> dispatcher) -> void {
+    if (!dispatcher) {
+        DebugLog("Attempted to register a null dispatcher");
+        return;
+    }
+
+    dispatchers_.push_back(std::move(dispatcher));
 }
 
 auto MessageHandler::handleMessage(const std::string& message) const -> void {
     try {
-        nlohmann::json jsonMessage = nlohmann::json::parse(message);
+        std::optional<nlohmann::json> jsonMessage;
+        std::string_view eventType;
+
+        auto envelope = EnvelopeScanner(message).scan();
+        if (envelope) {
+            if (!envelope->type) {
+                DebugLog("Message is missing type field or type is not a string: ", message);
+                return;
+            }
+            eventType = *envelope->type;
+        } else {
+            // Escaped or malformed text, let the json parser decide
+            jsonMessage = nlohmann::json::parse(message);
+            if (!jsonMessage->contains("type") || !(*jsonMessage)["type"].is_string()) {
+                DebugLog("Message is missing type field or type is not a string: ", message);
+                return;
+            }
+            eventType = (*jsonMessage)["type"].get_ref<const std::string&>();
+        }
+
+        if (eventType == utils::PayloadCodec::ENCODED_MESSAGE_TYPE) {
+            // Binary payload, route the message it wraps
+            if (!jsonMessage) {
+                jsonMessage = nlohmann::json::parse(message);
+            }
+            jsonMessage = utils::PayloadCodec::unwrapMessage(*jsonMessage);
+            if (!jsonMessage->contains("type") || !(*jsonMessage)["type"].is_string()) {
+                DebugLog("Encoded message is missing type field or type is not a string");
+                return;
+            }
+            eventType = (*jsonMessage)["type"].get_ref<const std::string&>();
+        }
 
-        // Check if the message has a type field
-        if (!jsonMessage.contains("type") || !jsonMessage["type"].is_string()) {
-            DebugLog("Message is missing type field or type is not a string: ", message);
+        const auto typed = strategiesByType_.find(eventType);
+        const bool dispatched = std::any_of(dispatchers_.begin(), dispatchers_.end(),
+                                            [eventType](const auto& dispatcher) { return dispatcher->handles(eventType); });
+        if (!dispatched && wildcardStrategies_.empty() && typed == strategiesByType_.end()) {
             return;
         }
 
-        std::string eventType = jsonMessage["type"];
+        // Parsed at most once, and only if a strategy needs more than the raw text
+        const auto event = [&]() {
+            if (jsonMessage) {
+                return MessageEvent(std::move((*jsonMessage)["event"]));
+            }
+            return envelope->event ? MessageEvent(*envelope->event) : MessageEvent(nlohmann::json());
+        }();
 
-        for (const auto& strategy : strategies_) {
-            if (strategy->getEventType() == "*" || strategy->getEventType() == eventType) {
-                // Call the type-erased executeJson method which will convert and forward to the typed execute
-                strategy->executeJson(jsonMessage["event"]);
+        if (dispatched) {
+            for (const auto& dispatcher : dispatchers_) {
+                dispatcher->dispatch(eventType, event);
+            }
+        }
+        for (auto* strategy : wildcardStrategies_) {
+            // Call the type-erased executeEvent method which will convert and forward to the typed execute
+            strategy->executeEvent(event);
+        }
+        if (typed != strategiesByType_.end()) {
+            for (auto* strategy : typed->second) {
+                strategy->executeEvent(event);
             }
         }
 
@@ -42,9 +362,11 @@ auto MessageHandler::handleMessage(const std::string& message) const -> void {
     } catch (const palantir::exception::TraceableBaseException& e) {
         DebugLog("Exception in handleMessage: ", e.what());
         DebugLog("Stack trace: ", e.getStackTraceString());
+    } catch (const std::exception& e) {
+        DebugLog("Exception in handleMessage: ", e.what());
     } catch (...) {
         DebugLog("Unknown exception in handleMessage");
     }
 }
 
-}  // namespace palantir::window::component::message
\ No newline at end of file
+}  // namespace palantir::window::component::message
@@ -10,7 +10,7 @@ ResizeStrategy::ResizeStrategy(std::string eventType, const std::shared_ptr<ICon
 auto ResizeStrategy::execute(const ResizeMessageVO& resizeMessage) -> void {
     DebugLog("ResizeStrategy handling event: ", eventType_, " with message: ", resizeMessage.width, "x",
              resizeMessage.height);
-    contentManager_->resize(resizeMessage.width, resizeMessage.height);
+    contentManager_->requestResize(resizeMessage.width, resizeMessage.height);
 }
 
 auto ResizeStrategy::getEventType() const -> const std::string& { return eventType_; }
@@ -0,0 +1,19 @@
+#include "window/component/message/sync/content_sync_strategy.hpp"
+
+#include "utils/logger.hpp"
+
+namespace palantir::window::component::message::sync {
+
+ContentSyncStrategy::ContentSyncStrategy(std::string eventType, const std::shared_ptr<IContentManager>& contentManager)
+    : eventType_(std::move(eventType)), contentManager_(contentManager) {}
+
+auto ContentSyncStrategy::execute(const ContentSyncMessageVO& syncMessage) -> void {
+    DebugLog("ContentSyncStrategy handling event: ", eventType_, " reason: ", syncMessage.reason);
+    // The view states what it can decode each time it asks for its state
+    contentManager_->negotiatePayloadEncoding(syncMessage.encodings);
+    contentManager_->syncContent();
+}
+
+auto ContentSyncStrategy::getEventType() const -> const std::string& { return eventType_; }
+
+}  // namespace palantir::window::component::message::sync
@@ -0,0 +1,114 @@
+#include "window/component/webview/headless_view.hpp"
+
+#include "utils/logger.hpp"
+#include "window/component/message/message_handler.hpp"
+
+namespace palantir::window::component::webview {
+
+namespace {
+
+// Busy wait so the cost shows up as CPU time, like the work it stands in for
+auto spinFor(std::chrono::nanoseconds duration) -> void {
+    if (duration.count() <= 0) {
+        return;
+    }
+    const auto end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end) {
+    }
+}
+
+}  // namespace
+
+class HeadlessView::HeadlessViewImpl {
+public:
+    bool initialized_{false};
+    bool recording_{true};
+    std::string url_;
+    HeadlessViewCosts costs_;
+    HeadlessViewStats stats_;
+    std::vector<std::string> scripts_;
+    std::vector<std::string> messages_;
+    std::vector<std::pair<int, int>> resizes_;
+    std::unique_ptr<message::MessageHandler> messageHandler_{std::make_unique<message::MessageHandler>()};
+};
+
+HeadlessView::HeadlessView() : pimpl_(std::make_unique<HeadlessViewImpl>()) {}  // NOLINT
+HeadlessView::~HeadlessView() = default;
+
+auto HeadlessView::initialize([[maybe_unused]] uintptr_t nativeWindowHandle, std::function<void()> initCallback)
+    -> void {
+    pimpl_->initialized_ = true;
+    if (initCallback) {
+        initCallback();
+    }
+}
+
+auto HeadlessView::loadURL(const std::string& url) -> void {
+    DebugLog("Headless view loading URL: ", url);
+    pimpl_->url_ = url;
+}
+
+auto HeadlessView::executeJavaScript(const std::string& script) -> void {
+    spinFor(pimpl_->costs_.script);
+    ++pimpl_->stats_.scripts;
+    if (pimpl_->recording_) {
+        pimpl_->scripts_.push_back(script);
+    }
+}
+
+auto HeadlessView::postMessage(const std::string& jsonMessage) -> void {
+    spinFor(pimpl_->costs_.post + pimpl_->costs_.perKilobyte * static_cast<int64_t>(jsonMessage.size() / 1024));
+    ++pimpl_->stats_.posts;
+    pimpl_->stats_.postedBytes += jsonMessage.size();
+    if (pimpl_->recording_) {
+        pimpl_->messages_.push_back(jsonMessage);
+    }
+}
+
+auto HeadlessView::destroy() -> void { pimpl_->initialized_ = false; }
+
+auto HeadlessView::resize(int width, int height) -> void {
+    spinFor(pimpl_->costs_.resize);
+    ++pimpl_->stats_.resizes;
+    if (pimpl_->recording_) {
+        pimpl_->resizes_.emplace_back(width, height);
+    }
+}
+
+auto HeadlessView::registerMessageStrategy(std::unique_ptr<message::MessageStrategyBase> strategy) -> void {
+    pimpl_->messageHandler_->registerStrategy(std::move(strategy));
+}
+
+auto HeadlessView::registerMessageDispatcher(std::unique_ptr<message::MessageDispatcherBase> dispatcher) -> void {
+    pimpl_->messageHandler_->registerDispatcher(std::move(dispatcher));
+}
+
+auto HeadlessView::handleMessage(const std::string& message) -> void {
+    ++pimpl_->stats_.handledMessages;
+    pimpl_->messageHandler_->handleMessage(message);
+}
+
+auto HeadlessView::setCosts(const HeadlessViewCosts& costs) -> void { pimpl_->costs_ = costs; }
+
+auto HeadlessView::setRecording(bool enabled) -> void { pimpl_->recording_ = enabled; }
+
+auto HeadlessView::clear() -> void {
+    pimpl_->stats_ = HeadlessViewStats{};
+    pimpl_->scripts_.clear();
+    pimpl_->messages_.clear();
+    pimpl_->resizes_.clear();
+}
+
+auto HeadlessView::getStats() const -> HeadlessViewStats { return pimpl_->stats_; }
+
+auto HeadlessView::getExecutedScripts() const -> const std::vector<std::string>& { return pimpl_->scripts_; }
+
+auto HeadlessView::getPostedMessages() const -> const std::vector<std::string>& { return pimpl_->messages_; }
+
+auto HeadlessView::getResizes() const -> const std::vector<std::pair<int, int>>& { return pimpl_->resizes_; }
+
+auto HeadlessView::getUrl() const -> const std::string& { return pimpl_->url_; }
+
+auto HeadlessView::isInitialized() const -> bool { return pimpl_->initialized_; }
+
+}  // namespace palantir::window::component::webview
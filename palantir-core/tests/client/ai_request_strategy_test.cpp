@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <future>
+#include <stdexcept>
+
+#include "client/ai_request_strategy.hpp"
+#include "mock/client/mock_sauron_client.hpp"
+
+using namespace palantir::client;
+using namespace palantir::test;
+using namespace std::chrono_literals;
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Property;
+using ::testing::Return;
+using ::testing::Throw;
+
+class AIRequestStrategyTestable : public AIRequestStrategy {
+public:
+    AIRequestStrategyTestable() = default;
+    explicit AIRequestStrategyTestable(const AIRequestStrategyConfig& config) : AIRequestStrategy(config) {}
+
+    using AIRequestStrategy::getMutableLatencyStats;
+};
+
+namespace {
+auto makeResponse(const std::string& text) -> sauron::dto::AIAlgorithmResponse {
+    sauron::dto::AIAlgorithmResponse response;
+    response.setResponse(text);
+    return response;
+}
+
+// Holds back a slow backend until the test is done with the race, opened at the latest on destruction
+class ResponseGate {
+public:
+    ResponseGate() : opened_(promise_.get_future().share()) {}
+    ~ResponseGate() { open(); }
+
+    ResponseGate(const ResponseGate&) = delete;
+    auto operator=(const ResponseGate&) -> ResponseGate& = delete;
+    ResponseGate(ResponseGate&&) = delete;
+    auto operator=(ResponseGate&&) -> ResponseGate& = delete;
+
+    auto open() -> void {
+        if (!isOpen_) {
+            isOpen_ = true;
+            promise_.set_value();
+        }
+    }
+
+    [[nodiscard]] auto respondWhenOpen(const std::string& text) const {
+        return [opened = opened_, text](const sauron::dto::AIQueryRequest&) {
+            opened.wait();
+            return makeResponse(text);
+        };
+    }
+
+private:
+    std::promise<void> promise_;
+    std::shared_future<void> opened_;
+    bool isOpen_{false};
+};
+
+auto twoBackendConfig(AIRequestMode mode) -> AIRequestStrategyConfig {
+    AIRequestStrategyConfig config;
+    config.mode = mode;
+    config.backends = {{"primary", sauron::dto::AIProvider::OPENAI, "gpt-4o"},
+                       {"secondary", sauron::dto::AIProvider::OPENAI, "gpt-4o-mini"}};
+    config.adaptiveHedgeDelay = false;
+    return config;
+}
+}  // namespace
+
+class AIRequestStrategyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        AIRequestStrategy::setInstance(nullptr);
+        mockClient = std::make_shared<NiceMock<MockSauronClient>>();
+    }
+
+    void TearDown() override {
+        AIRequestStrategy::setInstance(nullptr);
+        mockClient.reset();
+    }
+
+    std::shared_ptr<NiceMock<MockSauronClient>> mockClient;
+};
+
+namespace success {
+TEST_F(AIRequestStrategyTest, DefaultConfigSendsToOpenAIGpt4o) {
+    // Arrange
+    auto strategy = AIRequestStrategy::getInstance();
+    EXPECT_CALL(*mockClient, queryAlgorithm(AllOf(Property(&sauron::dto::AIQueryRequest::getModel, Eq("gpt-4o")),
+                                                  Property(&sauron::dto::AIQueryRequest::getProvider,
+                                                           Eq(sauron::dto::AIProvider::OPENAI)))))
+        .WillOnce(Return(makeResponse("single")));
+
+    // Act
+    auto response = strategy->execute(mockClient, "prompt", {"image"});
+
+    // Assert
+    EXPECT_EQ(response.getResponse(), "single");
+    EXPECT_EQ(strategy->getLatencyStats().snapshot("openai/gpt-4o").successes, 1u);
+}
+
+TEST_F(AIRequestStrategyTest, RaceReturnsFastestBackend) {
+    // Arrange
+    AIRequestStrategyTestable strategy(twoBackendConfig(AIRequestMode::RACE));
+    // Declared after the strategy so it opens before the strategy joins the slow backend
+    ResponseGate slowBackend;
+    ON_CALL(*mockClient, queryAlgorithm(Property(&sauron::dto::AIQueryRequest::getModel, Eq("gpt-4o"))))
+        .WillByDefault(Invoke(slowBackend.respondWhenOpen("slow")));
+    ON_CALL(*mockClient, queryAlgorithm(Property(&sauron::dto::AIQueryRequest::getModel, Eq("gpt-4o-mini"))))
+        .WillByDefault(Return(makeResponse("fast")));
+
+    // Act
+    auto response = strategy.execute(mockClient, "prompt", {});
+
+    // Assert
+    EXPECT_EQ(response.getResponse(), "fast");
+}
+
+TEST_F(AIRequestStrategyTest, HedgeIsNotSentWhenPrimaryAnswersBeforeDelay) {
+    // Arrange
+    auto config = twoBackendConfig(AIRequestMode::HEDGE);
+    config.hedgeDelay = 5s;
+    AIRequestStrategyTestable strategy(config);
+    EXPECT_CALL(*mockClient, queryAlgorithm(Property(&sauron::dto::AIQueryRequest::getModel, Eq("gpt-4o"))))
+        .WillOnce(Return(makeResponse("primary")));
+    EXPECT_CALL(*mockClient, queryAlgorithm(Property(&sauron::dto::AIQueryRequest::getModel, Eq("gpt-4o-mini"))))
+        .Times(0);
+
+    // Act
+    auto response = strategy.execute(mockClient, "prompt", {});
+
+    // Assert
+    EXPECT_EQ(response.getResponse(), "primary");
+}
+
+TEST_F(AIRequestStrategyTest, HedgeWinsWhenPrimaryIsSlow) {
+    // Arrange
+    auto config = twoBackendConfig(AIRequestMode::HEDGE);
+    config.hedgeDelay = 20ms;
+    AIRequestStrategyTestable strategy(config);
+    ResponseGate slowPrimary;
+    ON_CALL(*mockClient, queryAlgorithm(Property(&sauron::dto::AIQueryRequest::getModel, Eq("gpt-4o"))))
+        .WillByDefault(Invoke(slowPrimary.respondWhenOpen("primary")));
+    ON_CALL(*mockClient, queryAlgorithm(Property(&sauron::dto::AIQueryRequest::getModel, Eq("gpt-4o-mini"))))
+        .WillByDefault(Return(makeResponse("hedge")));
+
+    // Act
+    auto response = strategy.execute(mockClient, "prompt", {});
+
+    // Assert
+    EXPECT_EQ(response.getResponse(), "hedge");
+}
+
+TEST_F(AIRequestStrategyTest, HedgeIsSentImmediatelyWhenPrimaryFails) {
+    // Arrange
+    auto config = twoBackendConfig(AIRequestMode::HEDGE);
+    config.hedgeDelay = 5s;
+    AIRequestStrategyTestable strategy(config);
+    ON_CALL(*mockClient, queryAlgorithm(Property(&sauron::dto::AIQueryRequest::getModel, Eq("gpt-4o"))))
+        .WillByDefault(Throw(std::runtime_error("primary down")));
+    ON_CALL(*mockClient, queryAlgorithm(Property(&sauron::dto::AIQueryRequest::getModel, Eq("gpt-4o-mini"))))
+        .WillByDefault(Return(makeResponse("hedge")));
+
+    // Act
+    auto start = std::chrono::steady_clock::now();
+    auto response = strategy.execute(mockClient, "prompt", {});
+
+    // Assert
+    EXPECT_EQ(response.getResponse(), "hedge");
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+    EXPECT_EQ(strategy.getLatencyStats().snapshot("primary").failures, 1u);
+}
+
+TEST_F(AIRequestStrategyTest, HedgeDelayFollowsPrimaryP95OnceWarm) {
+    // Arrange
+    auto config = twoBackendConfig(AIRequestMode::HEDGE);
+    config.adaptiveHedgeDelay = true;
+    config.minSamplesForAdaptiveDelay = 3;
+    AIRequestStrategyTestable strategy(config);
+    strategy.getMutableLatencyStats().recordSuccess("primary", 100ms);
+    strategy.getMutableLatencyStats().recordSuccess("primary", 200ms);
+    EXPECT_EQ(strategy.getHedgeDelay(), config.hedgeDelay);
+
+    // Act
+    strategy.getMutableLatencyStats().recordSuccess("primary", 300ms);
+
+    // Assert
+    EXPECT_EQ(strategy.getHedgeDelay(), 300ms);
+}
+}  // namespace success
+
+namespace failure {
+TEST_F(AIRequestStrategyTest, SingleRethrowsClientError) {
+    // Arrange
+    auto strategy = AIRequestStrategy::getInstance();
+    EXPECT_CALL(*mockClient, queryAlgorithm(_)).WillOnce(Throw(std::runtime_error("down")));
+
+    // Act & Assert
+    EXPECT_THROW(strategy->execute(mockClient, "prompt", {}), std::runtime_error);
+    EXPECT_EQ(strategy->getLatencyStats().snapshot("openai/gpt-4o").failures, 1u);
+}
+
+TEST_F(AIRequestStrategyTest, RaceThrowsWhenEveryBackendFails) {
+    // Arrange
+    AIRequestStrategyTestable strategy(twoBackendConfig(AIRequestMode::RACE));
+    ON_CALL(*mockClient, queryAlgorithm(_)).WillByDefault(Throw(std::runtime_error("down")));
+
+    // Act & Assert
+    EXPECT_THROW(strategy.execute(mockClient, "prompt", {}), std::runtime_error);
+}
+
+TEST_F(AIRequestStrategyTest, SetConfigRejectsEmptyBackendList) {
+    // Arrange
+    AIRequestStrategyTestable strategy;
+    AIRequestStrategyConfig config;
+    config.backends.clear();
+
+    // Act & Assert
+    EXPECT_THROW(strategy.setConfig(config), std::invalid_argument);
+}
+}  // namespace failure
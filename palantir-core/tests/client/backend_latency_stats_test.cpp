@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include "client/backend_latency_stats.hpp"
+
+using namespace palantir::client;
+using namespace std::chrono_literals;
+
+TEST(BackendLatencyStatsTest, PercentileIsEmptyWithoutSamples) {
+    // Arrange
+    BackendLatencyStats stats;
+
+    // Act & Assert
+    EXPECT_FALSE(stats.percentile("openai/gpt-4o", 95.0).has_value());
+}
+
+TEST(BackendLatencyStatsTest, PercentileUsesNearestRank) {
+    // Arrange
+    BackendLatencyStats stats;
+    for (int latency = 1; latency <= 100; ++latency) {
+        stats.recordSuccess("openai/gpt-4o", std::chrono::milliseconds(latency));
+    }
+
+    // Act & Assert
+    EXPECT_EQ(stats.percentile("openai/gpt-4o", 50.0), 50ms);
+    EXPECT_EQ(stats.percentile("openai/gpt-4o", 95.0), 95ms);
+    EXPECT_EQ(stats.percentile("openai/gpt-4o", 100.0), 100ms);
+}
+
+TEST(BackendLatencyStatsTest, WindowKeepsMostRecentSamples) {
+    // Arrange
+    BackendLatencyStats stats(4);
+    for (int latency : {1000, 1000, 1000, 1000, 10, 20, 30, 40}) {
+        stats.recordSuccess("slow", std::chrono::milliseconds(latency));
+    }
+
+    // Act
+    auto snapshot = stats.snapshot("slow");
+
+    // Assert
+    EXPECT_EQ(snapshot.samples, 4u);
+    EXPECT_EQ(snapshot.successes, 8u);
+    EXPECT_EQ(snapshot.p99, 40ms);
+}
+
+TEST(BackendLatencyStatsTest, SnapshotCountsOutcomesPerBackend) {
+    // Arrange
+    BackendLatencyStats stats;
+    stats.recordSuccess("a", 10ms);
+    stats.recordFailure("a");
+    stats.recordCancellation("a");
+    stats.recordCancellation("a");
+    stats.recordFailure("b");
+
+    // Act
+    auto a = stats.snapshot("a");
+    auto b = stats.snapshot("b");
+
+    // Assert
+    EXPECT_EQ(a.successes, 1u);
+    EXPECT_EQ(a.failures, 1u);
+    EXPECT_EQ(a.cancellations, 2u);
+    EXPECT_EQ(b.failures, 1u);
+    EXPECT_FALSE(b.p50.has_value());
+}
+
+TEST(BackendLatencyStatsTest, ResetClearsEverything) {
+    // Arrange
+    BackendLatencyStats stats;
+    stats.recordSuccess("a", 10ms);
+
+    // Act
+    stats.reset();
+
+    // Assert
+    EXPECT_EQ(stats.snapshot("a").successes, 0u);
+    EXPECT_FALSE(stats.percentile("a", 50.0).has_value());
+}
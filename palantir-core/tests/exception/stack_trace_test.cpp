@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <string>
+
+#include "exception/exceptions.hpp"
+#include "exception/stack_trace.hpp"
+
+using namespace palantir::exception;
+using ::testing::HasSubstr;
+
+class StackTraceTest : public ::testing::Test {
+protected:
+    void SetUp() override { StackTraceResolver::getInstance().clear(); }
+};
+
+TEST_F(StackTraceTest, Current_CapturesFrames) {
+    const auto trace = StackTrace::current();
+
+    EXPECT_FALSE(trace.empty());
+    EXPECT_LE(trace.getFrames().size(), StackTrace::MAX_FRAMES);
+}
+
+TEST_F(StackTraceTest, Throw_DoesNotSymbolize) {
+    try {
+        throw TraceableShortcutConfigurationException("missing shortcut");
+    } catch (const TraceableBaseException&) {
+    }
+
+    EXPECT_EQ(StackTraceResolver::getInstance().getCachedFrameCount(), 0U);
+}
+
+TEST_F(StackTraceTest, GetStackTraceString_SymbolizesOnFirstCall) {
+#if defined(HAS_STD_STACKTRACE)
+    GTEST_SKIP() << "std::stacktrace symbolizes through the standard library";
+#endif
+    try {
+        throw TraceableContentManagerException("no content");
+    } catch (const TraceableBaseException& e) {
+        const auto text = e.getStackTraceString();
+
+        EXPECT_THAT(text, HasSubstr("Stack trace:\n"));
+        EXPECT_GT(StackTraceResolver::getInstance().getCachedFrameCount(), 0U);
+        EXPECT_EQ(e.getStackTraceString(), text);
+    }
+}
+
+TEST_F(StackTraceTest, Resolve_CachesAddress) {
+    auto& resolver = StackTraceResolver::getInstance();
+    void* frame = StackTrace::current().getFrames().front();
+
+    const auto first = resolver.resolve(frame);
+    const auto count = resolver.getCachedFrameCount();
+
+    EXPECT_EQ(resolver.resolve(frame), first);
+    EXPECT_EQ(resolver.getCachedFrameCount(), count);
+    EXPECT_FALSE(first.empty());
+}
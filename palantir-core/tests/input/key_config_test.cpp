@@ -66,6 +66,21 @@ TEST_F(KeyConfigTest, GetShortcut_NonExistentCommand_ThrowsException) {
     EXPECT_THROW(keyConfig->getShortcut("non.existent.command"), palantir::exception::TraceableShortcutConfigurationException);
 }
 
+TEST_F(KeyConfigTest, TryGetShortcut_ExistingCommand_ReturnsShortcut) {
+    const auto shortcut = keyConfig->tryGetShortcut("test.command2");
+
+    ASSERT_TRUE(shortcut.has_value());
+    EXPECT_EQ(shortcut->get().modifier, "Alt");
+    EXPECT_EQ(shortcut->get().key, "A");
+}
+
+TEST_F(KeyConfigTest, TryGetShortcut_NonExistentCommand_ReturnsError) {
+    const auto shortcut = keyConfig->tryGetShortcut("non.existent.command");
+
+    ASSERT_FALSE(shortcut.has_value());
+    EXPECT_EQ(shortcut.error(), KeyError::SHORTCUT_NOT_FOUND);
+}
+
 TEST_F(KeyConfigTest, HasShortcut_ExistingCommand_ReturnsTrue) {
     // Test checking if shortcuts exist for existing commands
     EXPECT_TRUE(keyConfig->hasShortcut("test.command1"));
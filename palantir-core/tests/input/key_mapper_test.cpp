@@ -68,4 +68,23 @@ TEST_F(KeyMapperTest, GetModifierCode_ValidModifier_ReturnsNonZeroCode) {
 TEST_F(KeyMapperTest, GetModifierCode_InvalidModifier_ThrowsException) {
     // Test that invalid modifiers throw an exception
     EXPECT_THROW(KeyMapper::getModifierCode("InvalidModifier"), std::invalid_argument);
-} 
\ No newline at end of file
+}
+
+TEST_F(KeyMapperTest, TryGetKeyCode_ValidKey_LooksUpOnce) {
+    EXPECT_CALL(*mockKeyRegister, tryGet("A")).WillOnce(Return(0x1E));
+    EXPECT_CALL(*mockKeyRegister, hasKey(_)).Times(0);
+
+    const auto keyCode = KeyMapper::tryGetKeyCode("a");
+
+    ASSERT_TRUE(keyCode.has_value());
+    EXPECT_EQ(*keyCode, 0x1E);
+}
+
+TEST_F(KeyMapperTest, TryGetModifierCode_InvalidModifier_ReturnsError) {
+    EXPECT_CALL(*mockKeyRegister, hasKey("INVALIDMODIFIER")).WillOnce(Return(false));
+
+    const auto modifierCode = KeyMapper::tryGetModifierCode("InvalidModifier");
+
+    ASSERT_FALSE(modifierCode.has_value());
+    EXPECT_EQ(modifierCode.error(), KeyError::KEY_NOT_FOUND);
+}
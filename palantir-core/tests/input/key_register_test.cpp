@@ -59,6 +59,22 @@ TEST_F(KeyRegisterTest, Get_NonExistentKey_ThrowsException) {
     EXPECT_THROW(keyRegister->get(nonExistentKey), std::invalid_argument);
 }
 
+TEST_F(KeyRegisterTest, TryGet_RegisteredKey_ReturnsValue) {
+    keyRegister->registerKey("TestKey3", 7);
+
+    const auto value = keyRegister->tryGet("testkey3");
+
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(*value, 7);
+}
+
+TEST_F(KeyRegisterTest, TryGet_NonExistentKey_ReturnsError) {
+    const auto value = keyRegister->tryGet("NonExistentKey");
+
+    ASSERT_FALSE(value.has_value());
+    EXPECT_EQ(value.error(), KeyError::KEY_NOT_FOUND);
+}
+
 TEST_F(KeyRegisterTest, Singleton_GetInstance_ReturnsSameInstance) {
     // Test that getInstance returns the same instance
     auto instance1 = KeyRegister::getInstance();
@@ -3,7 +3,7 @@
 #include <filesystem>
 #include <fstream>
 #include "input/keyboard_input_factory.hpp"
-#include "input/keyboard_Input.hpp"
+#include "input/keyboard_input.hpp"
 #include "mock/input/mock_key_register.hpp"
 #include "exception/exceptions.hpp"
 #include "config/config.hpp"
@@ -1,7 +1,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <any>
-#include "input/keyboard_Input.hpp"
+#include "input/keyboard_input.hpp"
 #include "input/key_mapper.hpp"
 #include "mock/input/mock_key_register.hpp"
 
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "logging/file_log_sink.hpp"
+
+using namespace palantir::logging;
+
+class FileLogSinkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory = std::filesystem::temp_directory_path() / "palantir_file_log_sink_test";
+        std::filesystem::remove_all(directory);
+        path = directory / "logs" / "palantir.log";
+    }
+
+    void TearDown() override { std::filesystem::remove_all(directory); }
+
+    static auto read(const std::filesystem::path& file) -> std::string {
+        std::ifstream stream(file);
+        std::stringstream content;
+        content << stream.rdbuf();
+        return content.str();
+    }
+
+    static auto entry(std::string_view message) -> LogEntry {
+        return LogEntry{LogLevel::INFO, std::chrono::system_clock::now(), 1, "test", 1, message};
+    }
+
+    std::filesystem::path directory;
+    std::filesystem::path path;
+};
+
+TEST_F(FileLogSinkTest, Write_CreatesDirectoryAndAppends) {
+    {
+        FileLogSink sink(path);
+        sink.write(entry("first"));
+        sink.flush();
+    }
+    {
+        FileLogSink sink(path);
+        sink.write(entry("second"));
+    }
+
+    const auto content = read(path);
+    EXPECT_NE(content.find("first"), std::string::npos);
+    EXPECT_NE(content.find("second"), std::string::npos);
+}
+
+TEST_F(FileLogSinkTest, Write_PastMaxBytes_RotatesAndKeepsMaxFiles) {
+    FileLogSink sink(path, 100, 2);
+    for (int i = 0; i < 10; ++i) {
+        sink.write(entry("message number " + std::to_string(i)));
+    }
+    sink.flush();
+
+    EXPECT_TRUE(std::filesystem::exists(path.string() + ".1"));
+    EXPECT_TRUE(std::filesystem::exists(path.string() + ".2"));
+    EXPECT_FALSE(std::filesystem::exists(path.string() + ".3"));
+    EXPECT_LE(std::filesystem::file_size(path), 100U);
+    EXPECT_NE(read(path).find("message number 9"), std::string::npos);
+}
+
+TEST_F(FileLogSinkTest, Write_ReopenFailsAfterRotation_DropsLinesUntilFileCanBeOpened) {
+    FileLogSink sink(path, 10, 1);
+    sink.write(entry("before the rotation"));
+    // Neither renamed nor reopened: the log path and its rotated name are non-empty directories
+    std::filesystem::remove(path);
+    std::filesystem::create_directories(path / "blocked");
+    std::filesystem::create_directories(path.string() + ".1/blocked");
+
+    EXPECT_NO_THROW(sink.write(entry("dropped")));
+    EXPECT_NO_THROW(sink.write(entry("dropped too")));
+
+    std::filesystem::remove_all(path);
+    sink.write(entry("after recovery"));
+    sink.flush();
+    EXPECT_NE(read(path).find("after recovery"), std::string::npos);
+}
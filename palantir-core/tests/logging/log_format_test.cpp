@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include "logging/log_format.hpp"
+#include "logging/log_macros.hpp"
+
+using namespace palantir::logging;
+
+TEST(LogFormatTest, FormatToString_ReplacesFieldsInOrder) {
+    EXPECT_EQ(formatToString("{} + {} = {}", 1, 2, 3), "1 + 2 = 3");
+    EXPECT_EQ(formatToString("no fields"), "no fields");
+}
+
+TEST(LogFormatTest, FormatToString_EscapedBraces_AreWrittenOnce) {
+    EXPECT_EQ(formatToString("{{{}}} }}{{", 5), "{5} }{");
+}
+
+TEST(LogFormatTest, FormatToString_IntegerSpecs_AreApplied) {
+    EXPECT_EQ(formatToString("{:#x}", 255), "0xff");
+    EXPECT_EQ(formatToString("{:X}", 255), "FF");
+    EXPECT_EQ(formatToString("{:#010x}", 0x80070005U), "0x80070005");
+    EXPECT_EQ(formatToString("{:04}", 7), "0007");
+}
+
+TEST(LogFormatTest, FormatToString_StringsAndBools) {
+    const std::string text = "value";
+    EXPECT_EQ(formatToString("{} {} {}", text, "literal", true), "value literal true");
+}
+
+TEST(LogFormatTest, FormatTo_WritesToStream) {
+    std::ostringstream stream;
+    formatTo(stream, "{}-{}", 'a', 2);
+    EXPECT_EQ(stream.str(), "a-2");
+}
+
+TEST(LogFormatTest, DisabledMacro_DoesNotEvaluateArguments) {
+    int evaluated = 0;
+    auto count = [&evaluated]() { return ++evaluated; };
+
+    PALANTIR_LOG_DISABLED(LogLevel::ERR, "value {}", count());
+
+    EXPECT_EQ(evaluated, 0);
+}
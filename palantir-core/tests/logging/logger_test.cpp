@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "logging/logger.hpp"
+#include "utils/logger.hpp"
+
+using namespace palantir::logging;
+using ::testing::ElementsAre;
+using ::testing::HasSubstr;
+
+namespace {
+
+class RecordingSink : public LogSink {
+public:
+    auto write(const LogEntry& entry) -> void override {
+        messages.emplace_back(entry.message);
+        levels.push_back(entry.level);
+        functions.emplace_back(entry.function);
+        lines.push_back(entry.line);
+    }
+
+    auto flush() -> void override { ++flushes; }
+
+    std::vector<std::string> messages;
+    std::vector<LogLevel> levels;
+    std::vector<std::string> functions;
+    std::vector<uint32_t> lines;
+    int flushes{0};
+};
+
+}  // namespace
+
+class LoggerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        logger = std::make_unique<Logger>();
+        logger->clearSinks();
+        sink = std::make_shared<RecordingSink>();
+        logger->addSink(sink);
+        logger->setLevel(LogLevel::TRACE);
+    }
+
+    std::unique_ptr<Logger> logger;
+    std::shared_ptr<RecordingSink> sink;
+};
+
+TEST_F(LoggerTest, Log_FormatsArgumentsOnFlush) {
+    logger->log(LogLevel::INFO, std::source_location::current(), "value ", 42, " ratio ", 0.5);
+    logger->flush();
+
+    EXPECT_THAT(sink->messages, ElementsAre("value 42 ratio 0.5"));
+    EXPECT_THAT(sink->levels, ElementsAre(LogLevel::INFO));
+    EXPECT_GE(sink->flushes, 1);
+}
+
+TEST_F(LoggerTest, Log_BelowLevel_IsDiscarded) {
+    logger->setLevel(LogLevel::WARN);
+
+    logger->log(LogLevel::DBG, std::source_location::current(), "hidden");
+    logger->log(LogLevel::ERR, std::source_location::current(), "shown");
+    logger->flush();
+
+    EXPECT_THAT(sink->messages, ElementsAre("shown"));
+    EXPECT_FALSE(logger->isEnabled(LogLevel::INFO));
+    EXPECT_FALSE(logger->isEnabled(LogLevel::OFF));
+}
+
+TEST_F(LoggerTest, Log_CopiesStringArguments) {
+    std::string text = "before";
+    const char* pointer = text.c_str();
+    logger->log(LogLevel::INFO, std::source_location::current(), pointer, " ", std::string_view(text));
+    text.assign("after, long enough to reallocate the buffer");
+    logger->flush();
+
+    EXPECT_THAT(sink->messages, ElementsAre("before before"));
+}
+
+TEST_F(LoggerTest, Log_SharedPointer_IsNotKeptAlive) {
+    auto value = std::make_shared<int>(1);
+    std::weak_ptr<int> weak = value;
+    logger->log(LogLevel::INFO, std::source_location::current(), "pointer ", value);
+    value.reset();
+
+    EXPECT_TRUE(weak.expired());
+    logger->flush();
+    EXPECT_EQ(sink->messages.size(), 1U);
+}
+
+TEST_F(LoggerTest, Log_LargeArguments_AreFormattedEagerly) {
+    logger->log(LogLevel::INFO, std::source_location::current(), std::string(10, 'a'), std::string(10, 'b'),
+                std::string(10, 'c'), std::string(10, 'd'), std::string(10, 'e'), std::string(10, 'f'),
+                std::string(10, 'g'), std::string(10, 'h'), std::string(10, 'i'));
+    logger->flush();
+
+    ASSERT_EQ(sink->messages.size(), 1U);
+    EXPECT_EQ(sink->messages[0].size(), 90U);
+}
+
+TEST_F(LoggerTest, Log_FullRing_DropsAndCounts) {
+    for (std::size_t i = 0; i < LogRing::DEFAULT_CAPACITY * 4; ++i) {
+        logger->log(LogLevel::INFO, std::source_location::current(), i);
+    }
+    logger->flush();
+
+    const auto stats = logger->getStats();
+    EXPECT_EQ(stats.written + stats.dropped, LogRing::DEFAULT_CAPACITY * 4);
+    EXPECT_EQ(sink->messages.size(), stats.written);
+}
+
+TEST_F(LoggerTest, Log_FromManyThreads_KeepsOrderPerThread) {
+    constexpr int COUNT = 100;
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([this, t]() {
+                for (int i = 0; i < COUNT; ++i) {
+                    logger->log(LogLevel::INFO, std::source_location::current(), t, ":", i);
+                }
+            });
+        }
+    }
+    logger->flush();
+
+    ASSERT_EQ(sink->messages.size() + logger->getStats().dropped, 4U * COUNT);
+    std::vector<int> last(4, -1);
+    for (const auto& message : sink->messages) {
+        const int thread = message[0] - '0';
+        const int index = std::stoi(message.substr(2));
+        EXPECT_GT(index, last[thread]);
+        last[thread] = index;
+    }
+}
+
+TEST_F(LoggerTest, Flush_SinkThrows_CountsFailureAndWritesOtherSinks) {
+    class ThrowingSink : public LogSink {
+    public:
+        auto write(const LogEntry&) -> void override { throw std::runtime_error("disk full"); }
+        auto flush() -> void override {}
+    };
+    logger->clearSinks();
+    logger->addSink(std::make_shared<ThrowingSink>());
+    logger->addSink(sink);
+
+    logger->log(LogLevel::INFO, std::source_location::current(), "kept");
+    logger->flush();
+
+    EXPECT_THAT(sink->messages, ElementsAre("kept"));
+    EXPECT_EQ(logger->getStats().failed, 1U);
+}
+
+TEST_F(LoggerTest, Log_Error_IsWrittenWithoutFlush) {
+    logger->log(LogLevel::ERR, std::source_location::current(), "failure");
+
+    for (int i = 0; i < 100 && logger->getStats().written == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_EQ(logger->getStats().written, 1U);
+}
+
+TEST_F(LoggerTest, LogFormat_FormatsOnFlush) {
+    const std::string name = "overlay";
+    logger->logFormat(LogLevel::INFO, std::source_location::current(), "{} is {}x{} {{px}}", name, 800, 600);
+    logger->flush();
+
+    EXPECT_THAT(sink->messages, ElementsAre("overlay is 800x600 {px}"));
+}
+
+TEST_F(LoggerTest, LogFormat_BelowLevel_IsDiscarded) {
+    logger->setLevel(LogLevel::INFO);
+
+    logger->logFormat(LogLevel::TRACE, std::source_location::current(), "hidden {}", 1);
+    logger->flush();
+
+    EXPECT_TRUE(sink->messages.empty());
+    EXPECT_EQ(logger->getStats().written, 0U);
+}
+
+TEST_F(LoggerTest, LogFormat_LargeArguments_AreFormattedByCaller) {
+    const std::string first(200, 'a');
+    const std::string second(200, 'b');
+    logger->logFormat(LogLevel::INFO, std::source_location::current(), "{}|{}", first, second);
+    logger->flush();
+
+    EXPECT_THAT(sink->messages, ElementsAre(first + "|" + second));
+}
+
+TEST_F(LoggerTest, DebugLog_RecordsLocationOfCaller) {
+    const auto previous = Logger::getInstance();
+    const std::shared_ptr<Logger> shared = std::move(logger);
+    Logger::setInstance(shared);
+
+    const auto line = std::source_location::current().line() + 1;
+    DebugLog("value ", 42);
+    shared->flush();
+    Logger::setInstance(previous);
+
+    ASSERT_THAT(sink->messages, ElementsAre("value 42"));
+    EXPECT_EQ(sink->lines.front(), line);
+    EXPECT_THAT(sink->functions.front(), HasSubstr("DebugLog_RecordsLocationOfCaller"));
+}
+
+TEST(LogSinkTest, AppendLine_ContainsLevelLocationAndMessage) {
+    const LogEntry entry{LogLevel::WARN, std::chrono::system_clock::now(), 7, "run", 12, "disk almost full"};
+    std::string line;
+
+    LogSink::appendLine(line, entry);
+
+    EXPECT_THAT(line, HasSubstr("warn"));
+    EXPECT_THAT(line, HasSubstr("[7] run:12 disk almost full\n"));
+}
+
+TEST(LogLevelTest, ParseLogLevel_RoundTripsNames) {
+    EXPECT_EQ(parseLogLevel("debug"), LogLevel::DBG);
+    EXPECT_EQ(parseLogLevel(getLogLevelName(LogLevel::ERR)), LogLevel::ERR);
+    EXPECT_FALSE(parseLogLevel("verbose").has_value());
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include <ios>
+#include <ostream>
+#include <string>
+
+#include "logging/message_stream.hpp"
+
+using namespace palantir::logging;
+
+namespace {
+
+// Logs its own message while being written, as an operator<< calling the logger would
+struct Nested {
+    int value;
+};
+
+auto operator<<(std::ostream& out, const Nested& nested) -> std::ostream& {
+    return out << formatWithThreadStream([&nested](std::ostream& inner) { inner << "inner " << nested.value; });
+}
+
+}  // namespace
+
+TEST(MessageStreamTest, Reset_EmptiesMessageAndRestoresDefaultFormatting) {
+    MessageStream message;
+    message.stream() << std::hex << std::showbase << 255;
+    EXPECT_EQ(message.view(), "0xff");
+
+    message.reset();
+    message.stream() << 255;
+
+    EXPECT_EQ(message.view(), "255");
+}
+
+TEST(MessageStreamTest, FormatWithThreadStream_NestedCall_KeepsBothMessages) {
+    const auto text =
+        formatWithThreadStream([](std::ostream& out) { out << "outer " << Nested{1} << " " << std::hex << 16; });
+    const auto next = formatWithThreadStream([](std::ostream& out) { out << 16; });
+
+    EXPECT_EQ(text, "outer inner 1 10");
+    EXPECT_EQ(next, "16");
+}
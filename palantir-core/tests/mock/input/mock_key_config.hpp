@@ -7,16 +7,27 @@ namespace palantir::test {
 
 // Mock KeyConfig class inheriting from both KeyConfig and our base with virtuals
 class MockKeyConfig : public input::KeyConfig, public PalantirMock {
-public:    
+public:
+    using ShortcutResult = utils::Expected<std::reference_wrapper<const input::ShortcutConfig>, input::KeyError>;
+
     // Constructor with config path
     explicit MockKeyConfig(const std::string& configPath) 
         : input::KeyConfig(configPath) {
+        // tryGetShortcut answers from the getShortcut and hasShortcut expectations unless a test sets its own
+        ON_CALL(*this, tryGetShortcut(::testing::_))
+            .WillByDefault([this](const std::string& commandName) -> ShortcutResult {
+                if (!hasShortcut(commandName)) {
+                    return utils::makeUnexpected(input::KeyError::SHORTCUT_NOT_FOUND);
+                }
+                return std::cref(getShortcut(commandName));
+            });
     }
 
     ~MockKeyConfig() override = default;
 
     MOCK_METHOD((const input::ShortcutConfig&), getShortcut, (const std::string& commandName), (const, override));
     MOCK_METHOD(bool, hasShortcut, (const std::string& commandName), (const, override));
+    MOCK_METHOD(ShortcutResult, tryGetShortcut, (const std::string& commandName), (const, override));
     MOCK_METHOD((std::vector<std::string>), getConfiguredCommands, (), (const, override));
 };
 
@@ -9,12 +9,22 @@ namespace palantir::test {
 class MockKeyRegister : public input::KeyRegister, public PalantirMock {
 public:    
     // Constructor with config path
-    explicit MockKeyRegister() = default;
+    // tryGet answers from the get and hasKey expectations unless a test sets its own
+    explicit MockKeyRegister() {
+        ON_CALL(*this, tryGet(::testing::_))
+            .WillByDefault([this](const std::string& key) -> utils::Expected<int, input::KeyError> {
+                if (!hasKey(key)) {
+                    return utils::makeUnexpected(input::KeyError::KEY_NOT_FOUND);
+                }
+                return get(key);
+            });
+    }
     ~MockKeyRegister() override = default;
 
     MOCK_METHOD(void, registerKey, (const std::string& key, int value), (override));
     MOCK_METHOD(int, get, (const std::string& key), (const, override));
     MOCK_METHOD(bool, hasKey, (const std::string& key), (const, override));
+    MOCK_METHOD((utils::Expected<int, input::KeyError>), tryGet, (const std::string& key), (const, override));
 };
 
 } // namespace palantir::test 
\ No newline at end of file
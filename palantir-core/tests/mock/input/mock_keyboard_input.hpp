@@ -1,7 +1,7 @@
 #pragma once
 
 #include "mock/palantir_mock.hpp"
-#include "input/keyboard_Input.hpp"
+#include "input/keyboard_input.hpp"
 #include "input/iinput.hpp"
 
 namespace palantir::test {
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "mock/palantir_mock.hpp"
-#include "Application.hpp"
+#include "application.hpp"
 
 namespace palantir::test {
 
@@ -18,6 +18,7 @@ public:
     MOCK_METHOD(void, quit, (), (override));
     MOCK_METHOD((const std::shared_ptr<signal::ISignalManager>&), getSignalManager, (), (const, override));
     MOCK_METHOD((const std::shared_ptr<window::WindowManager>&), getWindowManager, (), (const, override));
+    MOCK_METHOD(void, prepareSignals, (), (override));
     MOCK_METHOD(void, attachSignals, (), (override));
 };
 
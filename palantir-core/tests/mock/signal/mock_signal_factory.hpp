@@ -12,6 +12,7 @@ public:
     ~MockSignalFactory() override = default;
 
     MOCK_METHOD(std::vector<std::unique_ptr<signal::ISignal>>, createSignals, (), (const, override));
+    MOCK_METHOD(void, loadConfiguration, (), (const, override));
 };
 
 }  // namespace palantir::test
\ No newline at end of file
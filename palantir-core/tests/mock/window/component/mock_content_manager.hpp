@@ -13,13 +13,28 @@ public:
 
     MOCK_METHOD(void, initialize, (uintptr_t nativeWindowHandle), (override));
     MOCK_METHOD(void, setRootContent, (const std::string& content), (override));
+    MOCK_METHOD(void, setRootContentJson, (nlohmann::json&& content), (override));
+    MOCK_METHOD(void, syncContent, (), (override));
     MOCK_METHOD(void, setContent, (const std::string& elementId, const std::string& content), (override));
     MOCK_METHOD(std::string, getContent, (const std::string& elementId), (override));
+    MOCK_METHOD((utils::Expected<std::string, window::component::ContentError>), tryGetContent,
+                (const std::string& elementId), (override));
     MOCK_METHOD(void, toggleContentVisibility, (const std::string& elementId), (override));
     MOCK_METHOD(void, setContentVisibility, (const std::string& elementId, bool visible), (override));
     MOCK_METHOD(bool, getContentVisibility, (const std::string& elementId), (override));
+    MOCK_METHOD(void, flush, (), (override));
+    MOCK_METHOD(void, onFrame, (), (override));
+    MOCK_METHOD(void, setUiDispatcher, (std::shared_ptr<UiDispatcher> dispatcher), (override));
+    MOCK_METHOD(void, setUpdateBatching, (const window::component::ContentUpdateBatching& batching), (override));
+    MOCK_METHOD(window::component::ContentUpdateStats, getUpdateStats, (), (const, override));
+    MOCK_METHOD(void, setPayloadEncoding, (utils::PayloadEncoding encoding), (override));
+    MOCK_METHOD(void, negotiatePayloadEncoding, (const std::vector<std::string>& viewEncodings), (override));
+    MOCK_METHOD(utils::PayloadEncoding, getPayloadEncoding, (), (const, override));
     MOCK_METHOD(void, destroy, (), (override));
     MOCK_METHOD(void, resize, (int width, int height), (override));
+    MOCK_METHOD(void, requestResize, (int width, int height), (override));
+    MOCK_METHOD(void, setResizeCoalescing, (const window::component::ContentResizeCoalescing& coalescing), (override));
+    MOCK_METHOD(window::component::ContentResizeStats, getResizeStats, (), (const, override));
     MOCK_METHOD(void, addContentSizeObserver, (window::component::IContentSizeObserver* observer), (override));
     MOCK_METHOD(void, removeContentSizeObserver, (window::component::IContentSizeObserver* observer), (override));
     MOCK_METHOD(int, getContentWidth, (), (const, override));
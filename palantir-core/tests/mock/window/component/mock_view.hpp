@@ -13,9 +13,11 @@ public:
     MOCK_METHOD(void, initialize, (uintptr_t nativeWindowHandle, std::function<void()> onInitialized));
     MOCK_METHOD(void, loadURL, (const std::string& url));
     MOCK_METHOD(void, executeJavaScript, (const std::string& script));
+    MOCK_METHOD(void, postMessage, (const std::string& jsonMessage));
     MOCK_METHOD(void, destroy, ());
     MOCK_METHOD(void, resize, (int width, int height));
     MOCK_METHOD(void, registerMessageStrategy, (std::unique_ptr<window::component::message::MessageStrategyBase> strategy));
+    MOCK_METHOD(void, registerMessageDispatcher, (std::unique_ptr<window::component::message::MessageDispatcherBase> dispatcher));
     MOCK_METHOD(void, handleMessage, (const std::string& message));
 };
 
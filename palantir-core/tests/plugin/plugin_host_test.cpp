@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "command/command_factory.hpp"
+#include "command/icommand.hpp"
+#include "exception/exceptions.hpp"
+#include "mock/command/mock_command.hpp"
+#include "plugin/plugin_abi.hpp"
+#include "plugin/plugin_host.hpp"
+
+using namespace palantir::plugin;
+using namespace palantir::test;
+using testing::NiceMock;
+using testing::HasSubstr;
+using testing::Return;
+using testing::Test;
+using testing::Throw;
+
+namespace {
+
+class HostedPlugin : public IPlugin {
+public:
+    explicit HostedPlugin(palantir::plugin::abi::Host host) : host_(host) {}
+
+    auto initialize() -> bool override {
+        return host_.registerCommand("hosted-command", []() {
+            auto command = std::make_unique<NiceMock<MockCommand>>();
+            ON_CALL(*command, useDebounce()).WillByDefault(Return(true));
+            return command;
+        });
+    }
+    auto shutdown() -> void override { host_.unregisterCommand("hosted-command"); }
+    [[nodiscard]] auto getName() const -> std::string override { return "hosted"; }
+    [[nodiscard]] auto getVersion() const -> std::string override { return "2.1.0"; }
+    [[nodiscard]] auto getDependencies() const -> std::vector<std::string> override { return {"first", "second"}; }
+    [[nodiscard]] auto getProvidedCommands() const -> std::vector<std::string> override { return {"hosted-command"}; }
+    [[nodiscard]] auto getDebouncedCommands() const -> std::vector<std::string> override { return {"hosted-command"}; }
+
+private:
+    palantir::plugin::abi::Host host_;
+};
+
+}  // namespace
+
+class PluginHostTest : public Test {
+protected:
+    void TearDown() override {
+        if (api.destroy != nullptr) {
+            api.destroy(api.self);
+        }
+    }
+
+    PalantirPluginApi api{};
+};
+
+TEST_F(PluginHostTest, Create_FillsTableWithPluginStrings) {
+    ASSERT_EQ(palantir::plugin::abi::PluginExport<HostedPlugin>::create(PluginHost::getApi(), &api), 1);
+
+    EXPECT_EQ(api.abiVersion, PALANTIR_PLUGIN_ABI_VERSION);
+    EXPECT_EQ(api.size, sizeof(PalantirPluginApi));
+    EXPECT_EQ(palantir::plugin::abi::toStringView(api.getName(api.self)), "hosted");
+    EXPECT_EQ(palantir::plugin::abi::toStringView(api.getVersion(api.self)), "2.1.0");
+    ASSERT_EQ(api.getDependencyCount(api.self), 2U);
+    EXPECT_EQ(palantir::plugin::abi::toStringView(api.getDependency(api.self, 1)), "second");
+    EXPECT_EQ(api.getDependency(api.self, 2).data, nullptr);
+    EXPECT_EQ(api.getProvidedCommandCount(api.self), 1U);
+    ASSERT_EQ(api.getDebouncedCommandCount(api.self), 1U);
+    EXPECT_EQ(palantir::plugin::abi::toStringView(api.getDebouncedCommand(api.self, 0)), "hosted-command");
+}
+
+TEST_F(PluginHostTest, Create_OtherHostVersion_Fails) {
+    auto host = *PluginHost::getApi();
+    host.abiVersion = PALANTIR_PLUGIN_ABI_VERSION + 1;
+
+    EXPECT_EQ(palantir::plugin::abi::PluginExport<HostedPlugin>::create(&host, &api), 0);
+    EXPECT_EQ(api.self, nullptr);
+}
+
+TEST_F(PluginHostTest, Initialize_RegistersCommandThroughHost) {
+    ASSERT_EQ(palantir::plugin::abi::PluginExport<HostedPlugin>::create(PluginHost::getApi(), &api), 1);
+    auto factory = palantir::command::CommandFactory::getInstance();
+
+    ASSERT_EQ(api.initialize(api.self), 1);
+    auto command = factory->getCommand("hosted-command");
+    ASSERT_NE(command, nullptr);
+    EXPECT_TRUE(command->useDebounce());
+    EXPECT_NO_THROW(command->execute());
+    command.reset();
+
+    api.shutdown(api.self);
+    EXPECT_EQ(factory->getCommand("hosted-command"), nullptr);
+}
+
+TEST_F(PluginHostTest, UnregisterCommand_ReleasesCreator) {
+    palantir::plugin::abi::Host host(PluginHost::getApi());
+    auto state = std::make_shared<int>(0);
+
+    ASSERT_TRUE(
+        host.registerCommand("released-command", [state]() { return std::make_unique<NiceMock<MockCommand>>(); }));
+    EXPECT_EQ(state.use_count(), 2);
+
+    EXPECT_TRUE(host.unregisterCommand("released-command"));
+    EXPECT_EQ(state.use_count(), 1);
+    EXPECT_FALSE(host.unregisterCommand("released-command"));
+}
+
+TEST_F(PluginHostTest, Execute_CommandThrowsInPlugin_HostRethrowsItsMessage) {
+    palantir::plugin::abi::Host host(PluginHost::getApi());
+    ASSERT_TRUE(host.registerCommand("failing-command", []() {
+        auto command = std::make_unique<NiceMock<MockCommand>>();
+        ON_CALL(*command, execute()).WillByDefault(Throw(std::runtime_error("no window")));
+        return command;
+    }));
+    auto command = palantir::command::CommandFactory::getInstance()->getCommand("failing-command");
+    ASSERT_NE(command, nullptr);
+
+    try {
+        command->execute();
+        FAIL() << "The failure of the command was swallowed";
+    } catch (const palantir::exception::PluginCommandException& e) {
+        EXPECT_THAT(e.what(), HasSubstr("failing-command"));
+        EXPECT_THAT(e.what(), HasSubstr("no window"));
+    }
+
+    command.reset();
+    host.unregisterCommand("failing-command");
+}
@@ -6,7 +6,7 @@
 
 #include "signal/keyboard_signal_factory.hpp"
 #include "command/command_factory.hpp"
-#include "mock/input/mock_keyboard_Input.hpp"
+#include "mock/input/mock_keyboard_input.hpp"
 #include "mock/input/mock_input_factory.hpp"
 #include "mock/command/mock_command.hpp"
 #include "mock/command/mock_command_factory.hpp"
@@ -213,4 +213,41 @@ TEST_F(KeyboardSignalManagerTest, FactoryConstructorWithKeyboardApi_WorksCorrect
     EXPECT_CALL(*mockSignalPtr, start()).Times(1);
     
     customManager->startSignals();
-} 
\ No newline at end of file
+} 
+TEST_F(KeyboardSignalManagerTest, RebindSignals_ReplacesSignalsFromFactory) {
+    auto oldSignal = std::make_unique<MockSignal>();
+    auto newSignal = std::make_unique<MockSignal>();
+    EXPECT_CALL(*oldSignal, start()).Times(1);
+    EXPECT_CALL(*oldSignal, check(_)).Times(0);
+    EXPECT_CALL(*newSignal, start()).Times(1);
+    EXPECT_CALL(*newSignal, check(_)).Times(1);
+
+    std::vector<std::unique_ptr<ISignal>> oldSignals;
+    oldSignals.push_back(std::move(oldSignal));
+    std::vector<std::unique_ptr<ISignal>> newSignals;
+    newSignals.push_back(std::move(newSignal));
+    EXPECT_CALL(*mockFactory, createSignals())
+        .WillOnce(Return(ByMove(std::move(oldSignals))))
+        .WillOnce(Return(ByMove(std::move(newSignals))));
+
+    manager->startSignals();
+    manager->rebindSignals();
+    manager->checkSignals(emptyEvent);
+}
+
+TEST_F(KeyboardSignalManagerTest, PrepareSignals_NoSignals_LoadsFactoryConfiguration) {
+    auto mockSignal = std::make_unique<MockSignal>();
+    EXPECT_CALL(*mockSignal, start()).Times(1);
+    std::vector<std::unique_ptr<ISignal>> signals;
+    signals.push_back(std::move(mockSignal));
+    {
+        InSequence sequence;
+        EXPECT_CALL(*mockFactory, loadConfiguration()).Times(1);
+        EXPECT_CALL(*mockFactory, createSignals()).WillOnce(Return(ByMove(std::move(signals))));
+    }
+
+    manager->prepareSignals();
+    manager->startSignals();
+    // Signals exist, nothing left to prepare
+    manager->prepareSignals();
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <any>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "mock/signal/mock_signal.hpp"
+#include "signal/signal_table.hpp"
+
+using namespace palantir::signal;
+using namespace palantir::test;
+using namespace testing;
+
+class SignalTableTest : public Test {
+protected:
+    SignalTable table;
+    std::any emptyEvent;
+};
+
+TEST_F(SignalTableTest, Check_AddedSignals_ChecksEachOnce) {
+    auto signal1 = std::make_unique<MockSignal>();
+    auto signal2 = std::make_unique<MockSignal>();
+    EXPECT_CALL(*signal1, check(_)).Times(1);
+    EXPECT_CALL(*signal2, check(_)).Times(1);
+
+    table.add(std::move(signal1));
+    table.add(std::move(signal2));
+    table.check(emptyEvent);
+
+    EXPECT_FALSE(table.empty());
+}
+
+TEST_F(SignalTableTest, Replace_StartedTable_StartsNewSignalsAndDropsOldOnes) {
+    auto oldSignal = std::make_unique<MockSignal>();
+    EXPECT_CALL(*oldSignal, start()).Times(1);
+    EXPECT_CALL(*oldSignal, stop()).Times(1);
+    EXPECT_CALL(*oldSignal, check(_)).Times(0);
+    table.add(std::move(oldSignal));
+    table.start();
+
+    auto newSignal = std::make_unique<MockSignal>();
+    EXPECT_CALL(*newSignal, start()).Times(1);
+    EXPECT_CALL(*newSignal, check(_)).Times(1);
+    SignalTable::Signals signals;
+    signals.push_back(std::move(newSignal));
+    table.replace(std::move(signals));
+
+    table.check(emptyEvent);
+}
+
+TEST_F(SignalTableTest, Replace_CheckInFlight_WaitsForItToFinish) {
+    std::atomic<bool> checking{false};
+    std::atomic<bool> release{false};
+    std::atomic<bool> checkFinished{false};
+
+    auto slowSignal = std::make_unique<MockSignal>();
+    EXPECT_CALL(*slowSignal, check(_)).WillOnce([&](const std::any&) {
+        checking = true;
+        while (!release) {
+            std::this_thread::yield();
+        }
+        checkFinished = true;
+    });
+    table.add(std::move(slowSignal));
+
+    std::thread checker([this]() { table.check(emptyEvent); });
+    while (!checking) {
+        std::this_thread::yield();
+    }
+
+    std::atomic<bool> replaced{false};
+    std::thread replacer([this, &replaced]() {
+        table.replace({});
+        replaced = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(replaced);
+
+    release = true;
+    checker.join();
+    replacer.join();
+    EXPECT_TRUE(checkFinished);
+    EXPECT_TRUE(replaced);
+    EXPECT_TRUE(table.empty());
+}
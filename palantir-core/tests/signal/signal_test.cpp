@@ -2,9 +2,10 @@
 #include <gmock/gmock.h>
 #include <any>
 #include <memory>
+#include <stdexcept>
 
 #include "signal/signal.hpp"
-#include "mock/input/mock_keyboard_Input.hpp"
+#include "mock/input/mock_keyboard_input.hpp"
 #include "mock/command/mock_command.hpp"
 
 using namespace palantir::input;
@@ -66,6 +67,15 @@ TEST_F(SignalTest, Check_ActiveSignalWithActiveInput_ExecutesCommand) {
     signal->check(emptyEvent);
 }
 
+TEST_F(SignalTest, Check_CommandThrows_DoesNotLetItThrough) {
+    signal->start();
+
+    EXPECT_CALL(*mockInput, isActive(_)).WillOnce(Return(true));
+    EXPECT_CALL(*mockCommand, execute()).WillOnce(Throw(std::runtime_error("plugin command failed")));
+
+    EXPECT_NO_THROW(signal->check(emptyEvent));
+}
+
 TEST_F(SignalTest, Check_ActiveSignalWhileInactive_DoesNotExecuteCommand) {
     signal->start();
 
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ui_dispatcher.hpp"
+
+using namespace palantir;
+using ::testing::ElementsAre;
+
+class UiDispatcherTest : public ::testing::Test {
+protected:
+    UiDispatcher dispatcher;
+};
+
+TEST_F(UiDispatcherTest, Post_RunsOnlyWhenDrained) {
+    std::vector<int> order;
+    dispatcher.post([&order]() { order.push_back(1); });
+    dispatcher.post([&order]() { order.push_back(2); });
+
+    EXPECT_TRUE(order.empty());
+    EXPECT_EQ(dispatcher.getStats().pending, 2U);
+
+    EXPECT_EQ(dispatcher.drain(), 2U);
+    EXPECT_THAT(order, ElementsAre(1, 2));
+    EXPECT_EQ(dispatcher.getStats().executed, 2U);
+}
+
+TEST_F(UiDispatcherTest, Dispatch_OnUiThread_RunsAtOnce) {
+    bool ran = false;
+    dispatcher.dispatch([&ran]() { ran = true; });
+
+    EXPECT_TRUE(ran);
+    EXPECT_EQ(dispatcher.getStats().pending, 0U);
+}
+
+TEST_F(UiDispatcherTest, Dispatch_FromOtherThread_Queues) {
+    std::atomic<bool> ran{false};
+    std::thread([this, &ran]() { dispatcher.dispatch([&ran]() { ran = true; }); }).join();
+
+    EXPECT_FALSE(ran);
+    dispatcher.drain();
+    EXPECT_TRUE(ran);
+}
+
+TEST_F(UiDispatcherTest, Drain_TaskPostedWhileDraining_WaitsForNextDrain) {
+    int runs = 0;
+    dispatcher.post([this, &runs]() {
+        ++runs;
+        dispatcher.post([&runs]() { ++runs; });
+    });
+
+    EXPECT_EQ(dispatcher.drain(), 1U);
+    EXPECT_EQ(runs, 1);
+    EXPECT_EQ(dispatcher.drain(), 1U);
+    EXPECT_EQ(runs, 2);
+}
+
+TEST_F(UiDispatcherTest, Post_ManyTasks_WakesOncePerDrain) {
+    int wakeups = 0;
+    dispatcher.setWakeup([&wakeups]() { ++wakeups; });
+
+    dispatcher.post([]() {});
+    dispatcher.post([]() {});
+    dispatcher.post([]() {});
+    EXPECT_EQ(wakeups, 1);
+
+    dispatcher.drain();
+    dispatcher.post([]() {});
+    EXPECT_EQ(wakeups, 2);
+}
+
+TEST_F(UiDispatcherTest, SetWakeup_TasksPostedBefore_WakesAtOnceAndOnNextPosts) {
+    int wakeups = 0;
+    dispatcher.post([]() {});
+
+    dispatcher.setWakeup([&wakeups]() { ++wakeups; });
+    EXPECT_EQ(wakeups, 1);
+
+    dispatcher.drain();
+    dispatcher.post([]() {});
+    EXPECT_EQ(wakeups, 2);
+}
+
+TEST_F(UiDispatcherTest, Drain_TaskThrows_CountsFailureAndRunsTheRest) {
+    bool ran = false;
+    dispatcher.post([]() { throw std::runtime_error("boom"); });
+    dispatcher.post([&ran]() { ran = true; });
+
+    dispatcher.drain();
+
+    EXPECT_TRUE(ran);
+    const auto stats = dispatcher.getStats();
+    EXPECT_EQ(stats.failed, 1U);
+    EXPECT_EQ(stats.executed, 2U);
+}
+
+TEST_F(UiDispatcherTest, Await_FromOtherThread_ReturnsResultOfUiThread) {
+    std::thread::id ranOn;
+    std::future<int> result;
+    std::thread([this, &result, &ranOn]() {
+        result = dispatcher.await([&ranOn]() {
+            ranOn = std::this_thread::get_id();
+            return 42;
+        });
+    }).join();
+
+    dispatcher.drain();
+
+    EXPECT_EQ(result.get(), 42);
+    EXPECT_EQ(ranOn, std::this_thread::get_id());
+}
+
+TEST_F(UiDispatcherTest, Await_CallableThrows_RethrowsFromFuture) {
+    auto result = dispatcher.await([]() -> int { throw std::runtime_error("boom"); });
+
+    EXPECT_THROW(result.get(), std::runtime_error);
+    EXPECT_EQ(dispatcher.getStats().failed, 0U);
+}
+
+TEST_F(UiDispatcherTest, RunLoop_RunsPostedTasksUntilStopped) {
+    std::promise<std::thread::id> ranOn;
+    std::jthread loop([this]() { dispatcher.runLoop(); });
+
+    dispatcher.post([&ranOn]() { ranOn.set_value(std::this_thread::get_id()); });
+    EXPECT_EQ(ranOn.get_future().get(), loop.get_id());
+
+    dispatcher.stop();
+    loop.join();
+    EXPECT_EQ(dispatcher.getStats().executed, 1U);
+}
+
+TEST_F(UiDispatcherTest, PostAfter_RunsTasksInDeadlineOrderOnUiThread) {
+    std::vector<int> order;
+    std::thread::id ranOn;
+
+    dispatcher.postAfter(std::chrono::milliseconds(20), [this, &order]() {
+        order.push_back(2);
+        dispatcher.stop();
+    });
+    dispatcher.postAfter(std::chrono::milliseconds(1), [&order, &ranOn]() {
+        order.push_back(1);
+        ranOn = std::this_thread::get_id();
+    });
+    dispatcher.runLoop();
+
+    EXPECT_THAT(order, ElementsAre(1, 2));
+    EXPECT_EQ(ranOn, std::this_thread::get_id());
+}
+
+TEST_F(UiDispatcherTest, PostAfter_DispatcherDestroyed_DropsWaitingTasks) {
+    bool ran = false;
+    {
+        UiDispatcher shortLived;
+        shortLived.postAfter(std::chrono::hours(1), [&ran]() { ran = true; });
+    }
+
+    EXPECT_FALSE(ran);
+}
+
+TEST_F(UiDispatcherTest, GetStats_SlowDrain_RecordsLatencyAndStarvation) {
+    dispatcher.setStarvationThreshold(std::chrono::milliseconds(5));
+    dispatcher.post([]() {});
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    dispatcher.drain();
+
+    const auto stats = dispatcher.getStats();
+    EXPECT_EQ(stats.samples, 1U);
+    EXPECT_EQ(stats.starved, 1U);
+    ASSERT_TRUE(stats.p50.has_value());
+    EXPECT_GE(*stats.p50, std::chrono::milliseconds(10));
+    EXPECT_EQ(stats.maxLatency, *stats.p99);
+
+    dispatcher.resetStats();
+    EXPECT_EQ(dispatcher.getStats().samples, 0U);
+    EXPECT_FALSE(dispatcher.getStats().p50.has_value());
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+#include "utils/latency_window.hpp"
+
+using namespace palantir::utils;
+using std::chrono::milliseconds;
+
+class LatencyWindowTest : public ::testing::Test {
+protected:
+    LatencyWindow<milliseconds> window{4};
+};
+
+TEST_F(LatencyWindowTest, Percentile_EmptyWindow_ReturnsNullopt) {
+    EXPECT_TRUE(window.empty());
+    EXPECT_EQ(window.percentile(50.0), std::nullopt);
+    EXPECT_EQ(window.percentiles({50.0, 99.0}), (std::vector<std::optional<milliseconds>>{std::nullopt, std::nullopt}));
+}
+
+TEST_F(LatencyWindowTest, Percentiles_Samples_UseNearestRank) {
+    window.add(milliseconds(40));
+    window.add(milliseconds(10));
+    window.add(milliseconds(30));
+    window.add(milliseconds(20));
+
+    EXPECT_EQ(window.percentile(0.0), milliseconds(10));
+    EXPECT_EQ(window.percentile(50.0), milliseconds(20));
+    EXPECT_EQ(window.percentile(51.0), milliseconds(30));
+    EXPECT_EQ(window.percentile(150.0), milliseconds(40));
+}
+
+TEST_F(LatencyWindowTest, Add_FullWindow_ReplacesOldestSample) {
+    for (int latency : {100, 1, 2, 3, 4}) {
+        window.add(milliseconds(latency));
+    }
+
+    EXPECT_EQ(window.size(), 4U);
+    EXPECT_EQ(window.percentile(100.0), milliseconds(4));
+
+    window.clear();
+    window.add(milliseconds(7));
+    EXPECT_EQ(window.size(), 1U);
+    EXPECT_EQ(window.percentile(99.0), milliseconds(7));
+}
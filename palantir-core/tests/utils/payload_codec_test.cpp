@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "utils/payload_codec.hpp"
+#include "utils/string_utils.hpp"
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace palantir::utils;
+
+class PayloadCodecTest : public ::testing::Test {
+protected:
+    const nlohmann::json message = nlohmann::json::parse(
+        R"({"type": "setContent", "content": {"response": "café ✓", "count": 3, "ratio": 0.5, "items": [true, null, -7]}})");
+};
+
+TEST_F(PayloadCodecTest, ParseName_KnownNames_RoundTrip) {
+    for (const auto encoding : {PayloadEncoding::JSON, PayloadEncoding::MSGPACK, PayloadEncoding::CBOR}) {
+        EXPECT_EQ(PayloadCodec::parseName(PayloadCodec::getName(encoding)), encoding);
+    }
+}
+
+TEST_F(PayloadCodecTest, ParseName_UnknownName_ReturnsNullopt) {
+    EXPECT_FALSE(PayloadCodec::parseName("bson").has_value());
+}
+
+TEST_F(PayloadCodecTest, EncodeDecode_EveryEncoding_RoundTrips) {
+    for (const auto encoding : {PayloadEncoding::JSON, PayloadEncoding::MSGPACK, PayloadEncoding::CBOR}) {
+        std::vector<uint8_t> payload;
+        PayloadCodec::encode(message, encoding, payload);
+        EXPECT_EQ(PayloadCodec::decode(payload, encoding), message) << PayloadCodec::getName(encoding);
+    }
+}
+
+TEST_F(PayloadCodecTest, AppendMessage_Json_AppendsPlainText) {
+    std::string out = "x";
+    std::vector<uint8_t> scratch;
+
+    PayloadCodec::appendMessage(out, message, PayloadEncoding::JSON, scratch);
+
+    EXPECT_EQ(out, "x" + message.dump());
+}
+
+TEST_F(PayloadCodecTest, AppendMessage_Msgpack_WrapsBase64Payload) {
+    std::string out;
+    std::vector<uint8_t> scratch;
+
+    PayloadCodec::appendMessage(out, message, PayloadEncoding::MSGPACK, scratch);
+
+    auto envelope = nlohmann::json::parse(out);
+    EXPECT_EQ(envelope["type"], "encoded");
+    EXPECT_EQ(envelope["encoding"], "msgpack");
+    EXPECT_EQ(envelope["data"], StringUtils::base64_encode(nlohmann::json::to_msgpack(message)));
+    EXPECT_EQ(PayloadCodec::unwrapMessage(envelope), message);
+}
+
+TEST_F(PayloadCodecTest, UnwrapMessage_UnknownEncoding_Throws) {
+    nlohmann::json envelope = {{"type", "encoded"}, {"encoding", "bson"}, {"data", ""}};
+
+    EXPECT_THROW(static_cast<void>(PayloadCodec::unwrapMessage(envelope)), std::invalid_argument);
+}
+
+TEST_F(PayloadCodecTest, UnwrapMessage_InvalidBase64_Throws) {
+    nlohmann::json envelope = {{"type", "encoded"}, {"encoding", "cbor"}, {"data", "a?=="}};
+
+    EXPECT_THROW(static_cast<void>(PayloadCodec::unwrapMessage(envelope)), std::invalid_argument);
+}
+
+TEST_F(PayloadCodecTest, UnwrapMessage_TruncatedPayload_ThrowsParseError) {
+    std::vector<uint8_t> payload = nlohmann::json::to_cbor(message);
+    payload.resize(payload.size() / 2);
+    nlohmann::json envelope = {{"type", "encoded"}, {"encoding", "cbor"}, {"data", StringUtils::base64_encode(payload)}};
+
+    EXPECT_THROW(static_cast<void>(PayloadCodec::unwrapMessage(envelope)), nlohmann::json::parse_error);
+}
@@ -192,4 +192,37 @@ TEST_F(ResourceUtilsTest, ReadAllFilesFromDirectory_InvalidDirectory_ReturnsEmpt
     // Not a directory (file path instead)
     files = testableUtils->readAllFilesFromDirectory(testDir / "js" / "test1.js", ".js");
     EXPECT_TRUE(files.empty());
-} 
\ No newline at end of file
+} 
+namespace {
+auto contentOf(const std::vector<std::pair<std::string, std::string>>& files, const std::string& name)
+    -> std::string {
+    auto file = std::find_if(files.begin(), files.end(), [&name](const auto& entry) { return entry.first == name; });
+    return file != files.end() ? file->second : std::string();
+}
+}  // namespace
+
+TEST_F(ResourceUtilsTest, PreloadJavaScriptsFromDirectory_FilesUnchanged_NextLoadReturnsPreloadedContentOnce) {
+    utils->preloadJavaScriptsFromDirectory("js");
+    // Same size and modification time, only a read of the file would see the new content
+    const auto modified = std::filesystem::last_write_time(testDir / "js" / "test1.js");
+    createTestFile(testDir / "js" / "test1.js", "console.log('TEST1');");
+    std::filesystem::last_write_time(testDir / "js" / "test1.js", modified);
+
+    auto preloaded = utils->loadAllJavaScriptsFromDirectory("js");
+    auto reloaded = utils->loadAllJavaScriptsFromDirectory("js");
+
+    EXPECT_EQ(preloaded.size(), 2);
+    EXPECT_EQ(contentOf(preloaded, "test1.js"), "console.log('test1');");
+    EXPECT_EQ(contentOf(reloaded, "test1.js"), "console.log('TEST1');");
+}
+
+TEST_F(ResourceUtilsTest, PreloadJavaScriptsFromDirectory_FileEditedAfterPreload_NextLoadRereadsIt) {
+    utils->preloadJavaScriptsFromDirectory("js");
+    createTestFile(testDir / "js" / "test1.js", "console.log('edited');");
+    createTestFile(testDir / "js" / "test3.js", "console.log('test3');");
+
+    auto files = utils->loadAllJavaScriptsFromDirectory("js");
+
+    EXPECT_EQ(files.size(), 3);
+    EXPECT_EQ(contentOf(files, "test1.js"), "console.log('edited');");
+}
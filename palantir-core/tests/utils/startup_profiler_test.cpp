@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <nlohmann/json.hpp>
+
+#include "utils/startup_profiler.hpp"
+
+using namespace palantir::utils;
+
+class StartupProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        originalInstance_ = StartupProfiler::getInstance();
+        profiler = std::make_shared<StartupProfiler>();
+        StartupProfiler::setInstance(profiler);
+    }
+
+    void TearDown() override { StartupProfiler::setInstance(originalInstance_); }
+
+    std::shared_ptr<StartupProfiler> profiler;
+
+private:
+    std::shared_ptr<StartupProfiler> originalInstance_;
+};
+
+TEST_F(StartupProfilerTest, ScopedSpan_Nested_RecordsDepthAndOrder) {
+    {
+        ScopedSpan outer("startup");
+        {
+            ScopedSpan inner("plugins");
+        }
+        ScopedSpan sibling("signals");
+    }
+
+    auto spans = profiler->getSpans();
+    ASSERT_EQ(spans.size(), 3U);
+    EXPECT_EQ(spans[0].name, "startup");
+    EXPECT_EQ(spans[0].depth, 0U);
+    EXPECT_EQ(spans[1].name, "plugins");
+    EXPECT_EQ(spans[1].depth, 1U);
+    EXPECT_EQ(spans[2].name, "signals");
+    EXPECT_EQ(spans[2].depth, 1U);
+    EXPECT_LE(spans[0].start, spans[1].start);
+    EXPECT_GE(spans[0].end, spans[2].end);
+}
+
+TEST_F(StartupProfilerTest, ScopedSpan_Disabled_RecordsNothing) {
+    profiler->setEnabled(false);
+
+    {
+        ScopedSpan span("startup");
+    }
+
+    EXPECT_TRUE(profiler->getSpans().empty());
+}
+
+TEST_F(StartupProfilerTest, ScopedSpan_DisabledWithNameFunction_DoesNotBuildName) {
+    profiler->setEnabled(false);
+    int built = 0;
+
+    {
+        ScopedSpan span([&built]() {
+            ++built;
+            return std::string("plugin.load");
+        });
+    }
+
+    EXPECT_FALSE(StartupProfiler::isRecording());
+    EXPECT_EQ(built, 0);
+    EXPECT_TRUE(profiler->getSpans().empty());
+}
+
+TEST_F(StartupProfilerTest, ScopedSpan_EnabledWithNameFunction_RecordsBuiltName) {
+    const std::string path = "commands.dll";
+
+    {
+        ScopedSpan span([&path]() { return "plugin.load " + path; });
+    }
+
+    auto spans = profiler->getSpans();
+    ASSERT_EQ(spans.size(), 1U);
+    EXPECT_EQ(spans[0].name, "plugin.load commands.dll");
+}
+
+TEST_F(StartupProfilerTest, SetInstance_DisabledProfiler_StopsRecording) {
+    auto disabled = std::make_shared<StartupProfiler>();
+    disabled->setEnabled(false);
+    EXPECT_TRUE(StartupProfiler::isRecording());
+
+    StartupProfiler::setInstance(disabled);
+
+    EXPECT_FALSE(StartupProfiler::isRecording());
+    StartupProfiler::setInstance(profiler);
+    EXPECT_TRUE(StartupProfiler::isRecording());
+}
+
+TEST_F(StartupProfilerTest, Record_OtherThread_GetsItsOwnThreadIndex) {
+    {
+        ScopedSpan span("main");
+    }
+    std::thread([]() { ScopedSpan span("worker"); }).join();
+
+    auto spans = profiler->getSpans();
+    ASSERT_EQ(spans.size(), 2U);
+    EXPECT_EQ(spans[0].thread, 0U);
+    EXPECT_EQ(spans[1].thread, 1U);
+    EXPECT_EQ(spans[1].depth, 0U);
+}
+
+TEST_F(StartupProfilerTest, WriteChromeTrace_WritesCompleteEvents) {
+    const auto origin = profiler->getOrigin();
+    profiler->record("plugins", origin + std::chrono::microseconds(100), origin + std::chrono::microseconds(350));
+
+    std::ostringstream out;
+    profiler->writeChromeTrace(out);
+
+    auto trace = nlohmann::json::parse(out.str());
+    ASSERT_EQ(trace["traceEvents"].size(), 1U);
+    const auto& event = trace["traceEvents"][0];
+    EXPECT_EQ(event["name"], "plugins");
+    EXPECT_EQ(event["ph"], "X");
+    EXPECT_EQ(event["ts"], 100);
+    EXPECT_EQ(event["dur"], 250);
+}
+
+TEST_F(StartupProfilerTest, Print_WritesOneIndentedLinePerSpan) {
+    const auto origin = profiler->getOrigin();
+    profiler->record("startup", origin, origin + std::chrono::milliseconds(5));
+    profiler->record("signals", origin + std::chrono::milliseconds(1), origin + std::chrono::milliseconds(3), 1);
+
+    std::ostringstream out;
+    profiler->print(out);
+
+    EXPECT_NE(out.str().find("startup  5.000 ms\n"), std::string::npos);
+    EXPECT_NE(out.str().find("     1.000 ms    signals  2.000 ms\n"), std::string::npos);
+}
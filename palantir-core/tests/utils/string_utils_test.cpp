@@ -72,6 +72,7 @@ TEST_F(StringUtilsTest, Base64EncodePadding) {
     EXPECT_EQ(StringUtils::base64_encode(data3), "Zm9v");
 } 
 
+#ifdef _WIN32
 TEST_F(StringUtilsTest, StrToW) {
     EXPECT_EQ(StringUtils::strToW("Hello"), L"Hello");
 }
@@ -79,3 +80,113 @@ TEST_F(StringUtilsTest, StrToW) {
 TEST_F(StringUtilsTest, WToStr) {
     EXPECT_EQ(StringUtils::wToStr(L"Hello"), "Hello");
 }
+
+TEST_F(StringUtilsTest, StrToWNonAscii) {
+    EXPECT_EQ(StringUtils::strToW("caf\xC3\xA9 \xF0\x9F\x98\x80"), L"caf\u00E9 \U0001F600");
+}
+
+TEST_F(StringUtilsTest, WToStrNonAscii) {
+    EXPECT_EQ(StringUtils::wToStr(L"caf\u00E9 \U0001F600"), "caf\xC3\xA9 \xF0\x9F\x98\x80");
+}
+#endif
+
+TEST_F(StringUtilsTest, Utf8ToUtf16Empty) {
+    EXPECT_EQ(StringUtils::utf8ToUtf16(""), u"");
+}
+
+TEST_F(StringUtilsTest, Utf8ToUtf16Ascii) {
+    EXPECT_EQ(StringUtils::utf8ToUtf16("Hello"), u"Hello");
+}
+
+TEST_F(StringUtilsTest, Utf8ToUtf16AllSequenceLengths) {
+    // 1, 2, 3 and 4 byte sequences
+    EXPECT_EQ(StringUtils::utf8ToUtf16("a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80"), u"a\u00E9\u20AC\U0001F600");
+}
+
+TEST_F(StringUtilsTest, Utf8ToUtf16BoundaryCodePoints) {
+    EXPECT_EQ(StringUtils::utf8ToUtf16("\x7F\xC2\x80\xDF\xBF\xE0\xA0\x80\xEF\xBF\xBF\xF0\x90\x80\x80\xF4\x8F\xBF\xBF"),
+              u"\u007F\u0080\u07FF\u0800\uFFFF\U00010000\U0010FFFF");
+}
+
+TEST_F(StringUtilsTest, Utf8ToUtf16InvalidBytesAreReplaced) {
+    // Stray continuation byte, overlong encoding, encoded surrogate, value above U+10FFFF
+    EXPECT_EQ(StringUtils::utf8ToUtf16("a\x80" "b"), u"a\uFFFDb");
+    EXPECT_EQ(StringUtils::utf8ToUtf16("\xC0\xAF"), u"\uFFFD\uFFFD");
+    EXPECT_EQ(StringUtils::utf8ToUtf16("\xED\xA0\x80"), u"\uFFFD\uFFFD\uFFFD");
+    EXPECT_EQ(StringUtils::utf8ToUtf16("\xF4\x90\x80\x80"), u"\uFFFD\uFFFD\uFFFD\uFFFD");
+}
+
+TEST_F(StringUtilsTest, Utf8ToUtf16TruncatedSequenceIsReplacedOnce) {
+    EXPECT_EQ(StringUtils::utf8ToUtf16("\xF0\x9F\x98"), u"\uFFFD");
+    EXPECT_EQ(StringUtils::utf8ToUtf16("\xE2\x82z"), u"\uFFFDz");
+}
+
+TEST_F(StringUtilsTest, Utf16ToUtf8AllSequenceLengths) {
+    EXPECT_EQ(StringUtils::utf16ToUtf8(u"a\u00E9\u20AC\U0001F600"), "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80");
+}
+
+TEST_F(StringUtilsTest, Utf16ToUtf8LoneSurrogatesAreReplaced) {
+    const std::u16string highAtEnd{u'a', static_cast<char16_t>(0xD83D)};
+    const std::u16string lowFirst{static_cast<char16_t>(0xDE00), u'b'};
+    EXPECT_EQ(StringUtils::utf16ToUtf8(highAtEnd), "a\xEF\xBF\xBD");
+    EXPECT_EQ(StringUtils::utf16ToUtf8(lowFirst), "\xEF\xBF\xBD" "b");
+}
+
+TEST_F(StringUtilsTest, TranscodingRoundTripsAcrossSimdBlockBoundaries) {
+    // Put a multi-byte character at every offset of a long ASCII run so each SIMD and tail path is crossed
+    for (size_t offset = 0; offset < 40; ++offset) {
+        std::string utf8(48, 'x');
+        utf8.insert(offset, "\xE2\x82\xAC");
+        std::u16string utf16(48, u'x');
+        utf16.insert(offset, u"\u20AC");
+
+        EXPECT_EQ(StringUtils::utf8ToUtf16(utf8), utf16) << "offset " << offset;
+        EXPECT_EQ(StringUtils::utf16ToUtf8(utf16), utf8) << "offset " << offset;
+    }
+}
+
+TEST_F(StringUtilsTest, IsValidUtf8) {
+    EXPECT_TRUE(StringUtils::isValidUtf8(""));
+    EXPECT_TRUE(StringUtils::isValidUtf8(std::string(100, 'a') + "\xF0\x9F\x98\x80"));
+    EXPECT_FALSE(StringUtils::isValidUtf8(std::string(100, 'a') + "\xF0\x9F\x98"));
+    EXPECT_FALSE(StringUtils::isValidUtf8("\xE0\x80\x80"));
+    EXPECT_FALSE(StringUtils::isValidUtf8("\xFF"));
+}
+
+TEST_F(StringUtilsTest, IsValidUtf16) {
+    EXPECT_TRUE(StringUtils::isValidUtf16(u"a\U0001F600"));
+    EXPECT_FALSE(StringUtils::isValidUtf16(std::u16string{static_cast<char16_t>(0xD83D)}));
+    EXPECT_FALSE(StringUtils::isValidUtf16(std::u16string{static_cast<char16_t>(0xDE00), u'a'}));
+}
+
+TEST_F(StringUtilsTest, AppendBase64MatchesBase64Encode) {
+    for (std::size_t size = 0; size < 8; ++size) {
+        std::vector<unsigned char> data;
+        for (std::size_t index = 0; index < size; ++index) {
+            data.push_back(static_cast<unsigned char>(0xF0 + index * 7));
+        }
+        std::string out = "prefix:";
+        StringUtils::appendBase64(out, data);
+        EXPECT_EQ(out, "prefix:" + StringUtils::base64_encode(data)) << size;
+    }
+}
+
+TEST_F(StringUtilsTest, DecodeBase64RoundTrips) {
+    for (std::size_t size = 0; size < 8; ++size) {
+        std::vector<uint8_t> data;
+        for (std::size_t index = 0; index < size; ++index) {
+            data.push_back(static_cast<uint8_t>(0xF0 + index * 7));
+        }
+        std::vector<uint8_t> decoded;
+        EXPECT_TRUE(StringUtils::decodeBase64(StringUtils::base64_encode(data), decoded));
+        EXPECT_EQ(decoded, data) << size;
+    }
+}
+
+TEST_F(StringUtilsTest, DecodeBase64RejectsInvalidText) {
+    std::vector<uint8_t> decoded;
+    EXPECT_FALSE(StringUtils::decodeBase64("abc", decoded));
+    EXPECT_FALSE(StringUtils::decodeBase64("ab?d", decoded));
+    EXPECT_FALSE(StringUtils::decodeBase64("ab==abcd", decoded));
+    EXPECT_FALSE(StringUtils::decodeBase64("a=bc", decoded));
+}
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utils/task_graph.hpp"
+
+using namespace palantir::utils;
+
+class TaskGraphTest : public ::testing::Test {
+protected:
+    auto recorder(const std::string& name) {
+        return [this, name]() {
+            std::scoped_lock lock(mutex_);
+            order.push_back(name);
+        };
+    }
+
+    auto indexOf(const std::string& name) const -> std::ptrdiff_t {
+        return std::find(order.begin(), order.end(), name) - order.begin();
+    }
+
+    TaskGraph graph{4};
+    std::vector<std::string> order;
+
+private:
+    std::mutex mutex_;
+};
+
+TEST_F(TaskGraphTest, Run_Dependencies_RunsEachTaskAfterItsDependencies) {
+    graph.addTask("signals", recorder("signals"), {"config", "plugins"})
+        .addTask("config", recorder("config"))
+        .addTask("plugins", recorder("plugins"), {"config"});
+
+    graph.run();
+
+    ASSERT_EQ(order.size(), 3U);
+    EXPECT_LT(indexOf("config"), indexOf("plugins"));
+    EXPECT_LT(indexOf("plugins"), indexOf("signals"));
+}
+
+TEST_F(TaskGraphTest, Run_IndependentTasks_RunsThemConcurrently) {
+    // Each task waits for the other to start, which only succeeds if they overlap
+    std::promise<void> firstStarted;
+    std::promise<void> secondStarted;
+    auto firstFuture = firstStarted.get_future();
+    auto secondFuture = secondStarted.get_future();
+    std::atomic<bool> overlapped{true};
+    graph.addTask("first", [&]() {
+        firstStarted.set_value();
+        overlapped = overlapped && secondFuture.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+    });
+    graph.addTask("second", [&]() {
+        secondStarted.set_value();
+        overlapped = overlapped && firstFuture.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+    });
+
+    graph.run();
+
+    EXPECT_TRUE(overlapped);
+}
+
+TEST_F(TaskGraphTest, Run_CallerTask_RunsOnCallingThread) {
+    const auto caller = std::this_thread::get_id();
+    std::thread::id callerTaskThread;
+    std::thread::id workerTaskThread;
+    graph.addTask("window", [&]() { callerTaskThread = std::this_thread::get_id(); }, {}, TaskMode::CALLER);
+    graph.addTask("plugins", [&]() { workerTaskThread = std::this_thread::get_id(); });
+
+    graph.run();
+
+    EXPECT_EQ(callerTaskThread, caller);
+    EXPECT_NE(workerTaskThread, caller);
+}
+
+TEST_F(TaskGraphTest, Run_FailingTask_SkipsDependentsAndRethrows) {
+    graph.addTask("plugins", []() { throw std::runtime_error("plugin failed"); })
+        .addTask("signals", recorder("signals"), {"plugins"}, TaskMode::CALLER)
+        .addTask("window", recorder("window"), {}, TaskMode::CALLER);
+
+    EXPECT_THROW(graph.run(), std::runtime_error);
+
+    EXPECT_EQ(order, std::vector<std::string>{"window"});
+    EXPECT_EQ(graph.getFailedTasks(), (std::vector<std::string>{"plugins", "signals"}));
+}
+
+TEST_F(TaskGraphTest, Run_BackgroundTask_ReturnsWithoutWaitingForIt) {
+    std::promise<void> started;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::atomic<bool> backgroundDone{false};
+    {
+        // Destroyed first, it waits for the background task already running
+        TaskGraph local(2);
+        local.addTask("sauron", [&started, released, &backgroundDone]() {
+            started.set_value();
+            released.wait();
+            backgroundDone = true;
+        }, {}, TaskMode::BACKGROUND);
+        local.addTask("config", recorder("config"));
+
+        local.run();
+
+        EXPECT_EQ(order, std::vector<std::string>{"config"});
+        EXPECT_FALSE(backgroundDone);
+        started.get_future().wait();
+        release.set_value();
+    }
+    EXPECT_TRUE(backgroundDone);
+}
+
+TEST_F(TaskGraphTest, Cancel_QueuedBackgroundTasks_DropsThemAndWaitsForRunningOne) {
+    std::promise<void> started;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    TaskGraph local(1);
+    // The single worker is busy with the first task, the second one and its dependent stay queued
+    local.addTask("sauron", [&started, released]() {
+        started.set_value();
+        released.wait();
+    }, {}, TaskMode::BACKGROUND);
+    local.addTask("zresources", recorder("zresources"), {}, TaskMode::BACKGROUND);
+    local.addTask("zwarmup", recorder("zwarmup"), {"zresources"}, TaskMode::BACKGROUND);
+
+    local.run();
+    started.get_future().wait();
+    local.cancel();
+    release.set_value();
+    local.waitForBackground();
+
+    EXPECT_TRUE(order.empty());
+    EXPECT_TRUE(local.getFailedTasks().empty());
+}
+
+TEST_F(TaskGraphTest, WaitForBackground_FailingBackgroundTask_Rethrows) {
+    graph.addTask("sauron", []() { throw std::runtime_error("login failed"); }, {}, TaskMode::BACKGROUND)
+        .addTask("config", recorder("config"));
+
+    graph.run();
+
+    EXPECT_THROW(graph.waitForBackground(), std::runtime_error);
+    EXPECT_EQ(graph.getFailedTasks(), std::vector<std::string>{"sauron"});
+}
+
+TEST_F(TaskGraphTest, Run_InvalidGraph_ThrowsBeforeRunningAnything) {
+    TaskGraph cyclic;
+    cyclic.addTask("a", recorder("a"), {"b"}).addTask("b", recorder("b"), {"a"}).addTask("c", recorder("c"));
+    TaskGraph unknown;
+    unknown.addTask("a", recorder("a"), {"missing"});
+    TaskGraph waitsForBackground;
+    waitsForBackground.addTask("a", recorder("a"), {}, TaskMode::BACKGROUND).addTask("b", recorder("b"), {"a"});
+
+    EXPECT_THROW(cyclic.run(), std::invalid_argument);
+    EXPECT_THROW(unknown.run(), std::invalid_argument);
+    EXPECT_THROW(waitsForBackground.run(), std::invalid_argument);
+    EXPECT_THROW(graph.addTask("a", recorder("a")).addTask("a", recorder("a")), std::invalid_argument);
+    EXPECT_TRUE(order.empty());
+}
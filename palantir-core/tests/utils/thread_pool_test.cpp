@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include "utils/thread_pool.hpp"
+
+using namespace palantir::utils;
+
+class ThreadPoolTest : public ::testing::Test {
+protected:
+    ThreadPool pool{4};
+};
+
+TEST_F(ThreadPoolTest, Constructor_ExplicitCount_StartsThatManyThreads) {
+    EXPECT_EQ(pool.getThreadCount(), 4U);
+    EXPECT_GE(ThreadPool().getThreadCount(), 1U);
+}
+
+TEST_F(ThreadPoolTest, Submit_Task_ReturnsItsResult) {
+    auto result = pool.submit([]() { return 42; });
+
+    EXPECT_EQ(result.get(), 42);
+}
+
+TEST_F(ThreadPoolTest, Submit_ThrowingTask_RethrowsFromFuture) {
+    auto result = pool.submit([]() -> int { throw std::runtime_error("failed"); });
+
+    EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+TEST_F(ThreadPoolTest, Destructor_QueuedTasks_RunsThemAll) {
+    std::atomic<int> count{0};
+    {
+        ThreadPool local(2);
+        for (int i = 0; i < 100; ++i) {
+            local.submit([&count]() { ++count; });
+        }
+    }
+
+    EXPECT_EQ(count.load(), 100);
+}
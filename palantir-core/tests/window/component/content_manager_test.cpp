@@ -8,6 +8,7 @@
 #include "mock/window/component/mock_content_size_observer.hpp"
 #include "mock/window/component/message/mock_message_strategy.hpp"
 #include "exception/exceptions.hpp"
+#include "ui_dispatcher.hpp"
 
 using namespace palantir::window::component;
 using namespace palantir::test;
@@ -52,10 +53,11 @@ TEST_F(ContentManagerTest, Initialize_CallsViewInitializeAndLoadsURL) {
 TEST_F(ContentManagerTest, SetRootContent_ValidJson_UpdatesContentAndWebView) {
     std::string validJson = R"({"explanation": "test explanation", "response": "test response"})";
     
-    EXPECT_CALL(*mockView, executeJavaScript(::testing::_))
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
         .Times(1);
     
     contentManager->setRootContent(validJson);
+    contentManager->flush();
     
     // Verify content was updated by checking getContent
     EXPECT_EQ(contentManager->getContent("explanation"), "test explanation");
@@ -69,15 +71,164 @@ TEST_F(ContentManagerTest, SetRootContent_InvalidJson_ThrowsException) {
                  palantir::exception::TraceableContentManagerException);
 }
 
+TEST_F(ContentManagerTest, SetRootContentJson_MovesContentAndSendsSingleMessage) {
+    nlohmann::json content = {{"explanation", "typed explanation"}, {"response", "typed response"}};
+    std::string posted;
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .WillOnce(::testing::SaveArg<0>(&posted));
+
+    contentManager->setRootContentJson(std::move(content));
+    contentManager->flush();
+
+    auto message = nlohmann::json::parse(posted);
+    EXPECT_EQ(message["type"], "setContent");
+    EXPECT_EQ(message["content"]["response"], "typed response");
+    EXPECT_EQ(contentManager->getContent("explanation"), "typed explanation");
+}
+
+TEST_F(ContentManagerTest, SetContentVisibility_EscapesElementId) {
+    std::string posted;
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .WillOnce(::testing::SaveArg<0>(&posted));
+
+    contentManager->setContentVisibility("quote\"id", false);
+    contentManager->flush();
+
+    EXPECT_EQ(posted, R"({"type":"setVisibility","elementId":"quote\"id","visible":false})");
+}
+
+namespace {
+// Parse the message posted to the view
+auto parsePostedMessage(const std::string& posted) -> nlohmann::json { return nlohmann::json::parse(posted); }
+}  // namespace
+
+TEST_F(ContentManagerTest, SetContent_AfterSnapshot_SendsPatchForChangedFieldOnly) {
+    contentManager->setRootContent(R"({"explanation": "kept", "response": ""})");
+    contentManager->flush();
+    std::string posted;
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .WillOnce(::testing::SaveArg<0>(&posted));
+
+    contentManager->setContent("response", "streamed");
+    contentManager->flush();
+
+    auto message = parsePostedMessage(posted);
+    EXPECT_EQ(message["type"], "patch");
+    EXPECT_EQ(message["ops"], nlohmann::json::parse(R"([{"op": "add", "path": "/response", "value": "streamed"}])"));
+}
+
+TEST_F(ContentManagerTest, SetContent_MissingParent_PatchesFirstMissingAncestor) {
+    contentManager->setRootContent(R"({"explanation": "", "response": ""})");
+    contentManager->flush();
+    std::string posted;
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .WillOnce(::testing::SaveArg<0>(&posted));
+
+    contentManager->setContent("complexity.time.value", "O(n)");
+    contentManager->flush();
+
+    auto message = parsePostedMessage(posted);
+    auto expected = nlohmann::json::parse(
+        R"json([{"op": "add", "path": "/complexity", "value": {"time": {"value": "O(n)"}}}])json");
+    EXPECT_EQ(message["ops"], expected);
+}
+
+TEST_F(ContentManagerTest, SetContent_BeforeSnapshot_SendsSnapshot) {
+    std::string posted;
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .WillOnce(::testing::SaveArg<0>(&posted));
+
+    contentManager->setContent("response", "first");
+    contentManager->flush();
+
+    auto message = parsePostedMessage(posted);
+    EXPECT_EQ(message["type"], "setContent");
+    EXPECT_EQ(message["content"]["response"], "first");
+}
+
+TEST_F(ContentManagerTest, SetRootContent_AfterSnapshot_SendsDiff) {
+    contentManager->setRootContent(R"({"explanation": "same", "response": "old"})");
+    contentManager->flush();
+    std::string posted;
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .WillOnce(::testing::SaveArg<0>(&posted));
+
+    contentManager->setRootContent(R"({"explanation": "same", "response": "new"})");
+    contentManager->flush();
+
+    auto message = parsePostedMessage(posted);
+    EXPECT_EQ(message["type"], "patch");
+    EXPECT_EQ(message["ops"], nlohmann::json::parse(R"([{"op": "replace", "path": "/response", "value": "new"}])"));
+}
+
+TEST_F(ContentManagerTest, SetRootContent_Unchanged_SendsNothing) {
+    contentManager->setRootContent(R"({"explanation": "same", "response": "same"})");
+    contentManager->flush();
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .Times(0);
+
+    contentManager->setRootContent(R"({"explanation": "same", "response": "same"})");
+    contentManager->flush();
+}
+
+TEST_F(ContentManagerTest, SyncContent_SendsFullSnapshot) {
+    contentManager->setRootContent(R"({"explanation": "a", "response": "b"})");
+    contentManager->flush();
+    std::string posted;
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .WillOnce(::testing::SaveArg<0>(&posted));
+
+    contentManager->syncContent();
+
+    auto message = parsePostedMessage(posted);
+    EXPECT_EQ(message["type"], "setContent");
+    EXPECT_EQ(message["content"], nlohmann::json::parse(R"({"explanation": "a", "response": "b"})"));
+}
+
+TEST_F(ContentManagerTest, HandleMessage_RoutesContentReadyToSyncStrategy) {
+    std::unique_ptr<palantir::window::component::message::MessageDispatcherBase> dispatcher;
+    EXPECT_CALL(*mockView, registerMessageDispatcher(::testing::_))
+        .WillOnce(::testing::Invoke(
+            [&dispatcher](std::unique_ptr<palantir::window::component::message::MessageDispatcherBase> registered) {
+                dispatcher = std::move(registered);
+            }));
+    contentManager->initialize(0);
+
+    ASSERT_NE(dispatcher, nullptr);
+    EXPECT_TRUE(dispatcher->handles("contentReady"));
+
+    EXPECT_CALL(*mockView, postMessage(::testing::HasSubstr(R"("type":"setContent")")))
+        .Times(1);
+    dispatcher->dispatch("contentReady",
+                         palantir::window::component::message::MessageEvent(nlohmann::json{{"reason", "load"}}));
+}
+
+TEST_F(ContentManagerTest, Initialize_RegistersNoTypeErasedStrategy) {
+    EXPECT_CALL(*mockView, registerMessageDispatcher(::testing::_)).Times(1);
+    EXPECT_CALL(*mockView, registerMessageStrategy(::testing::_)).Times(0);
+
+    contentManager->initialize(0);
+}
+
 TEST_F(ContentManagerTest, SetContent_ValidElementId_UpdatesContentAndWebView) {
     // First set valid root content
     std::string validJson = R"({"explanation": "", "response": ""})";
     contentManager->setRootContent(validJson);
+    contentManager->flush();
     
-    EXPECT_CALL(*mockView, executeJavaScript(::testing::_))
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
         .Times(1);
     
     contentManager->setContent("explanation", "updated explanation");
+    contentManager->flush();
     
     EXPECT_EQ(contentManager->getContent("explanation"), "updated explanation");
 }
@@ -93,11 +244,13 @@ TEST_F(ContentManagerTest, SetContent_ComplexityField_UpdatesContentAndWebView)
         }
     })";
     contentManager->setRootContent(validJson);
+    contentManager->flush();
     
-    EXPECT_CALL(*mockView, executeJavaScript(::testing::_))
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
         .Times(1);
     
     contentManager->setContent("complexity.time.value", "O(n)");
+    contentManager->flush();
     
     EXPECT_EQ(contentManager->getContent("complexity.time.value"), "O(n)");
 }
@@ -110,18 +263,40 @@ TEST_F(ContentManagerTest, GetContent_InvalidElementId_ThrowsException) {
                  palantir::exception::TraceableContentManagerException);
 }
 
-TEST_F(ContentManagerTest, ToggleContentVisibility_CallsExecuteJavaScript) {
-    EXPECT_CALL(*mockView, executeJavaScript(::testing::_))
+TEST_F(ContentManagerTest, TryGetContent_ExistingField_ReturnsContent) {
+    contentManager->setContent("complexity.space.value", "O(1)");
+
+    const auto content = contentManager->tryGetContent("complexity.space.value");
+
+    ASSERT_TRUE(content.has_value());
+    EXPECT_EQ(*content, "O(1)");
+}
+
+TEST_F(ContentManagerTest, TryGetContent_InvalidElementId_ReturnsError) {
+    EXPECT_EQ(contentManager->tryGetContent("invalid_field").error(), ContentError::INVALID_ELEMENT_ID);
+    EXPECT_EQ(contentManager->tryGetContent("complexity.time").error(), ContentError::INVALID_ELEMENT_ID);
+}
+
+TEST_F(ContentManagerTest, TryGetContent_MissingField_ReturnsError) {
+    contentManager->setRootContent(R"({"explanation": "", "response": ""})");
+
+    EXPECT_EQ(contentManager->tryGetContent("complexity.time.value").error(), ContentError::CONTENT_NOT_FOUND);
+}
+
+TEST_F(ContentManagerTest, ToggleContentVisibility_PostsMessage) {
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
         .Times(1);
     
     contentManager->toggleContentVisibility("explanation");
+    contentManager->flush();
 }
 
-TEST_F(ContentManagerTest, SetContentVisibility_CallsExecuteJavaScript) {
-    EXPECT_CALL(*mockView, executeJavaScript(::testing::_))
+TEST_F(ContentManagerTest, SetContentVisibility_PostsMessage) {
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
         .Times(1);
     
     contentManager->setContentVisibility("explanation", true);
+    contentManager->flush();
 }
 
 TEST_F(ContentManagerTest, GetContentVisibility_ReturnsTrue) {
@@ -241,3 +416,335 @@ TEST_F(ContentManagerTest, SplitMethod_CorrectlySplitsString) {
     // If split works correctly, we should be able to get the value
     EXPECT_EQ(contentManager->getContent("complexity.time.value"), "O(n)");
 }
+
+TEST_F(ContentManagerTest, Updates_WithinFrame_AreSentAsOneBatchMessage) {
+    contentManager->setRootContent(R"({"explanation": "", "response": ""})");
+    contentManager->flush();
+    std::string posted;
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .WillOnce(::testing::SaveArg<0>(&posted));
+
+    contentManager->setContent("response", "first");
+    contentManager->setContent("explanation", "second");
+    contentManager->setContentVisibility("response", false);
+    contentManager->flush();
+
+    auto message = parsePostedMessage(posted);
+    EXPECT_EQ(message["type"], "batch");
+    ASSERT_EQ(message["messages"].size(), 2u);
+    EXPECT_EQ(message["messages"][0]["type"], "patch");
+    EXPECT_EQ(message["messages"][0]["ops"].size(), 2u);
+    EXPECT_EQ(message["messages"][1], nlohmann::json::parse(
+        R"({"type": "setVisibility", "elementId": "response", "visible": false})"));
+    auto stats = contentManager->getUpdateStats();
+    EXPECT_EQ(stats.updates, 4u);
+    EXPECT_EQ(stats.messages, 2u);
+    EXPECT_EQ(stats.coalesced, 2u);
+}
+
+TEST_F(ContentManagerTest, SetContent_SameFieldTwiceInFrame_SendsLatestValueOnly) {
+    contentManager->setRootContent(R"({"explanation": "", "response": ""})");
+    contentManager->flush();
+    std::string posted;
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .WillOnce(::testing::SaveArg<0>(&posted));
+
+    contentManager->setContent("response", "partial");
+    contentManager->setContent("response", "complete");
+    contentManager->flush();
+
+    auto message = parsePostedMessage(posted);
+    EXPECT_EQ(message["ops"], nlohmann::json::parse(R"([{"op": "add", "path": "/response", "value": "complete"}])"));
+}
+
+TEST_F(ContentManagerTest, SetRootContent_AfterPendingSetContent_KeepsOperationOrder) {
+    contentManager->setRootContent(R"({"explanation": "", "response": ""})");
+    contentManager->flush();
+    std::string posted;
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .WillOnce(::testing::SaveArg<0>(&posted));
+
+    contentManager->setContent("response", "streamed");
+    contentManager->setRootContent(R"({"explanation": "", "response": "final"})");
+    contentManager->flush();
+
+    auto message = parsePostedMessage(posted);
+    auto expected = nlohmann::json::parse(R"([
+        {"op": "add", "path": "/response", "value": "streamed"},
+        {"op": "replace", "path": "/response", "value": "final"}
+    ])");
+    EXPECT_EQ(message["ops"], expected);
+}
+
+TEST_F(ContentManagerTest, ToggleContentVisibility_TwiceInFrame_SendsNothing) {
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .Times(0);
+
+    contentManager->toggleContentVisibility("explanation");
+    contentManager->toggleContentVisibility("explanation");
+    contentManager->flush();
+
+    EXPECT_EQ(contentManager->getUpdateStats().coalesced, 2u);
+}
+
+TEST_F(ContentManagerTest, OnFrame_PendingUpdates_FlushesOnce) {
+    ContentUpdateBatching batching;
+    batching.frameInterval = std::chrono::milliseconds(0);
+    contentManager->setUpdateBatching(batching);
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .Times(1);
+
+    contentManager->setContent("response", "first");
+    contentManager->onFrame();
+    contentManager->onFrame();
+}
+
+TEST_F(ContentManagerTest, OnFrame_BeforeFrameInterval_KeepsUpdatesPending) {
+    ContentUpdateBatching batching;
+    batching.frameInterval = std::chrono::hours(1);
+    batching.maxLatency = std::chrono::hours(1);
+    contentManager->setUpdateBatching(batching);
+    contentManager->setContent("response", "first");
+    contentManager->onFrame();
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .Times(0);
+
+    contentManager->setContent("response", "second");
+    contentManager->onFrame();
+}
+
+TEST_F(ContentManagerTest, SetUpdateBatching_Disabled_SendsEveryUpdate) {
+    ContentUpdateBatching batching;
+    batching.enabled = false;
+    contentManager->setUpdateBatching(batching);
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .Times(2);
+
+    contentManager->setContent("response", "first");
+    contentManager->setContent("response", "second");
+
+    EXPECT_EQ(contentManager->getUpdateStats().coalesced, 0u);
+}
+
+TEST_F(ContentManagerTest, SetContent_OldestUpdateOverMaxLatency_FlushesWithoutFrame) {
+    ContentUpdateBatching batching;
+    batching.maxLatency = std::chrono::milliseconds(0);
+    contentManager->setUpdateBatching(batching);
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .Times(1);
+
+    contentManager->setContent("response", "first");
+
+    EXPECT_EQ(contentManager->getUpdateStats().latencyFlushes, 1u);
+}
+
+TEST_F(ContentManagerTest, SetContent_WithUiDispatcher_SentAfterMaxLatencyWithoutFrame) {
+    auto dispatcher = std::make_shared<palantir::UiDispatcher>();
+    contentManager->setUiDispatcher(dispatcher);
+    ContentUpdateBatching batching;
+    batching.maxLatency = std::chrono::milliseconds(5);
+    contentManager->setUpdateBatching(batching);
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .WillOnce([&dispatcher](const std::string&) { dispatcher->stop(); });
+
+    contentManager->setContent("response", "only");
+    // Keeps a broken flush from hanging the test
+    dispatcher->postAfter(std::chrono::seconds(5), [&dispatcher]() { dispatcher->stop(); });
+    dispatcher->runLoop();
+
+    EXPECT_EQ(contentManager->getUpdateStats().messages, 1u);
+    EXPECT_EQ(contentManager->getUpdateStats().latencyFlushes, 1u);
+}
+
+TEST_F(ContentManagerTest, SetContent_ManagerDestroyedBeforeScheduledFlush_SendsNothing) {
+    auto dispatcher = std::make_shared<palantir::UiDispatcher>();
+    contentManager->setUiDispatcher(dispatcher);
+    ContentUpdateBatching batching;
+    batching.maxLatency = std::chrono::milliseconds(1);
+    contentManager->setUpdateBatching(batching);
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .Times(0);
+
+    contentManager->setContent("response", "dropped");
+    contentManager.reset();
+    dispatcher->postAfter(std::chrono::milliseconds(20), [&dispatcher]() { dispatcher->stop(); });
+    dispatcher->runLoop();
+
+    EXPECT_EQ(dispatcher->getStats().executed, 2U);
+}
+
+TEST_F(ContentManagerTest, Destroy_DropsPendingUpdates) {
+    contentManager->setContent("response", "pending");
+
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .Times(0);
+
+    contentManager->destroy();
+    contentManager->flush();
+}
+
+TEST_F(ContentManagerTest, ContentUpdates_NeverExecuteScript) {
+    EXPECT_CALL(*mockView, executeJavaScript(::testing::_))
+        .Times(0);
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .Times(2);
+
+    contentManager->setRootContent(R"({"explanation": "", "response": ""})");
+    contentManager->flush();
+    contentManager->setContent("response", "patched");
+    contentManager->toggleContentVisibility("response");
+    contentManager->flush();
+}
+
+TEST_F(ContentManagerTest, NegotiatePayloadEncoding_DefaultPreference_StaysJson) {
+    contentManager->negotiatePayloadEncoding({"msgpack"});
+
+    EXPECT_EQ(contentManager->getPayloadEncoding(), palantir::utils::PayloadEncoding::JSON);
+}
+
+TEST_F(ContentManagerTest, NegotiatePayloadEncoding_ViewWithoutPreferred_FallsBackToJson) {
+    contentManager->setPayloadEncoding(palantir::utils::PayloadEncoding::CBOR);
+
+    contentManager->negotiatePayloadEncoding({"msgpack"});
+
+    EXPECT_EQ(contentManager->getPayloadEncoding(), palantir::utils::PayloadEncoding::JSON);
+}
+
+TEST_F(ContentManagerTest, ContentUpdates_NegotiatedMsgpack_SendEncodedMessages) {
+    contentManager->setPayloadEncoding(palantir::utils::PayloadEncoding::MSGPACK);
+    contentManager->negotiatePayloadEncoding({"msgpack"});
+    std::vector<std::string> posted;
+    EXPECT_CALL(*mockView, postMessage(::testing::_))
+        .WillRepeatedly(::testing::Invoke([&posted](const std::string& message) { posted.push_back(message); }));
+
+    contentManager->setRootContent(R"({"explanation": "", "response": ""})");
+    contentManager->flush();
+    contentManager->setContent("response", "patched");
+    contentManager->toggleContentVisibility("response");
+    contentManager->flush();
+
+    ASSERT_EQ(posted.size(), 2u);
+    auto snapshot = parsePostedMessage(posted[0]);
+    EXPECT_EQ(snapshot["type"], "encoded");
+    EXPECT_EQ(palantir::utils::PayloadCodec::unwrapMessage(snapshot),
+              nlohmann::json::parse(R"({"type": "setContent", "content": {"explanation": "", "response": ""}})"));
+    auto batch = palantir::utils::PayloadCodec::unwrapMessage(parsePostedMessage(posted[1]));
+    EXPECT_EQ(batch, nlohmann::json::parse(R"({"type": "batch", "messages": [
+        {"type": "patch", "ops": [{"op": "add", "path": "/response", "value": "patched"}]},
+        {"type": "toggleVisibility", "elementId": "response"}]})"));
+}
+
+TEST_F(ContentManagerTest, Destroy_ResetsPayloadEncoding) {
+    contentManager->setPayloadEncoding(palantir::utils::PayloadEncoding::MSGPACK);
+    contentManager->negotiatePayloadEncoding({"msgpack"});
+
+    contentManager->destroy();
+
+    EXPECT_EQ(contentManager->getPayloadEncoding(), palantir::utils::PayloadEncoding::JSON);
+}
+
+TEST_F(ContentManagerTest, RequestResize_FirstReport_AppliesImmediately) {
+    EXPECT_CALL(*mockView, resize(800, 600))
+        .Times(1);
+
+    contentManager->requestResize(800, 600);
+
+    EXPECT_EQ(contentManager->getContentHeight(), 600);
+    EXPECT_EQ(contentManager->getResizeStats().applied, 1u);
+}
+
+TEST_F(ContentManagerTest, RequestResize_UnchangedSize_Skipped) {
+    contentManager->requestResize(800, 600);
+
+    EXPECT_CALL(*mockView, resize(::testing::_, ::testing::_))
+        .Times(0);
+
+    contentManager->requestResize(800, 600);
+
+    EXPECT_EQ(contentManager->getResizeStats().skipped, 1u);
+}
+
+TEST_F(ContentManagerTest, RequestResize_ShrinkWithinThreshold_Skipped) {
+    contentManager->setResizeCoalescing(ContentResizeCoalescing{true, 1, 8, std::chrono::milliseconds(0)});
+    contentManager->requestResize(800, 600);
+
+    EXPECT_CALL(*mockView, resize(::testing::_, ::testing::_))
+        .Times(0);
+
+    contentManager->requestResize(800, 595);
+    contentManager->onFrame();
+
+    EXPECT_EQ(contentManager->getContentHeight(), 600);
+}
+
+TEST_F(ContentManagerTest, RequestResize_WithinInterval_AppliesLatestOnFrame) {
+    contentManager->requestResize(800, 600);
+    contentManager->setResizeCoalescing(ContentResizeCoalescing{true, 1, 8, std::chrono::hours(1)});
+
+    EXPECT_CALL(*mockView, resize(::testing::_, ::testing::_))
+        .Times(0);
+    contentManager->requestResize(800, 620);
+    contentManager->requestResize(800, 640);
+    contentManager->onFrame();
+    ::testing::Mock::VerifyAndClearExpectations(mockView.get());
+
+    EXPECT_CALL(*mockView, resize(800, 640))
+        .Times(1);
+    contentManager->setResizeCoalescing(ContentResizeCoalescing{true, 1, 8, std::chrono::milliseconds(0)});
+
+    const auto stats = contentManager->getResizeStats();
+    EXPECT_EQ(stats.requests, 3u);
+    EXPECT_EQ(stats.applied, 2u);
+    EXPECT_EQ(stats.coalesced, 1u);
+}
+
+TEST_F(ContentManagerTest, RequestResize_WithUiDispatcher_AppliesLatestWithoutFrame) {
+    auto dispatcher = std::make_shared<palantir::UiDispatcher>();
+    contentManager->setUiDispatcher(dispatcher);
+    contentManager->requestResize(800, 600);
+    contentManager->setResizeCoalescing(ContentResizeCoalescing{true, 1, 8, std::chrono::milliseconds(50)});
+
+    EXPECT_CALL(*mockView, resize(800, 640))
+        .WillOnce([&dispatcher](int, int) { dispatcher->stop(); });
+
+    contentManager->requestResize(800, 620);
+    contentManager->requestResize(800, 640);
+    // Keeps a broken resize from hanging the test
+    dispatcher->postAfter(std::chrono::seconds(5), [&dispatcher]() { dispatcher->stop(); });
+    dispatcher->runLoop();
+
+    EXPECT_EQ(contentManager->getContentHeight(), 640);
+    EXPECT_EQ(contentManager->getResizeStats().applied, 2u);
+}
+
+TEST_F(ContentManagerTest, RequestResize_InsignificantReport_CancelsPendingResize) {
+    contentManager->requestResize(800, 600);
+    contentManager->setResizeCoalescing(ContentResizeCoalescing{true, 1, 8, std::chrono::hours(1)});
+    contentManager->requestResize(800, 700);
+
+    EXPECT_CALL(*mockView, resize(::testing::_, ::testing::_))
+        .Times(0);
+
+    contentManager->requestResize(800, 597);
+    contentManager->setResizeCoalescing(ContentResizeCoalescing{true, 1, 8, std::chrono::milliseconds(0)});
+}
+
+TEST_F(ContentManagerTest, RequestResize_CoalescingDisabled_AppliesEveryChange) {
+    contentManager->setResizeCoalescing(ContentResizeCoalescing{false, 1, 8, std::chrono::hours(1)});
+
+    EXPECT_CALL(*mockView, resize(::testing::_, ::testing::_))
+        .Times(3);
+
+    contentManager->requestResize(800, 600);
+    contentManager->requestResize(800, 599);
+    contentManager->requestResize(801, 599);
+}
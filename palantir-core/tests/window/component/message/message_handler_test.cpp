@@ -3,6 +3,7 @@
 #include <memory>
 #include <nlohmann/json.hpp>
 
+#include "utils/payload_codec.hpp"
 #include "window/component/message/message_handler.hpp"
 #include "window/component/message/resize/resize_strategy.hpp"
 #include "window/component/message/resize/resize_message_vo.hpp"
@@ -139,4 +140,112 @@ TEST_F(MessageHandlerTest, RegisterStrategy_NullStrategy_NoRegistration) {
         {"event", {}}
     };
     handler->handleMessage(message.dump());
-} 
\ No newline at end of file
+} 
+TEST_F(MessageHandlerTest, HandleMessage_MatchingType_PassesEventSubtree) {
+    EXPECT_CALL(*mockStrategy, getEventType())
+        .WillOnce(ReturnRef(eventType));
+    EXPECT_CALL(*mockStrategy, executeJson(nlohmann::json::parse(R"({"width": 10, "nested": {"type": "other"}})")))
+        .Times(1);
+
+    handler->registerStrategy(std::move(mockStrategy));
+    handler->handleMessage(R"({ "event" : {"width": 10, "nested": {"type": "other"}}, "type" : "test", "extra": [1, "]"] })");
+}
+
+TEST_F(MessageHandlerTest, HandleMessage_MissingEvent_PassesNull) {
+    EXPECT_CALL(*mockStrategy, getEventType())
+        .WillOnce(ReturnRef(eventType));
+    EXPECT_CALL(*mockStrategy, executeJson(nlohmann::json()))
+        .Times(1);
+
+    handler->registerStrategy(std::move(mockStrategy));
+    handler->handleMessage(R"({"type": "test"})");
+}
+
+TEST_F(MessageHandlerTest, HandleMessage_TypeOnlyInNestedObject_NoStrategyExecuted) {
+    EXPECT_CALL(*mockStrategy, getEventType())
+        .WillOnce(ReturnRef(eventType));
+    EXPECT_CALL(*mockStrategy, executeJson(_))
+        .Times(0);
+
+    handler->registerStrategy(std::move(mockStrategy));
+    handler->handleMessage(R"({"event": {"type": "test"}})");
+}
+
+TEST_F(MessageHandlerTest, HandleMessage_EscapedType_FallsBackToFullParse) {
+    EXPECT_CALL(*mockStrategy, getEventType())
+        .WillOnce(ReturnRef(eventType));
+    EXPECT_CALL(*mockStrategy, executeJson(nlohmann::json{{"key", "value"}}))
+        .Times(1);
+
+    handler->registerStrategy(std::move(mockStrategy));
+    handler->handleMessage(R"({"type": "te\u0073t", "event": {"key": "value"}})");
+}
+
+TEST_F(MessageHandlerTest, HandleMessage_MalformedNestedValue_NoStrategyExecuted) {
+    const std::string wildcard = "*";
+    EXPECT_CALL(*mockStrategy, getEventType())
+        .WillOnce(ReturnRef(wildcard));
+    EXPECT_CALL(*mockStrategy, executeJson(_))
+        .Times(0);
+
+    handler->registerStrategy(std::move(mockStrategy));
+    // Each one is rejected by the json parser, so the scanner must not accept it either
+    handler->handleMessage(R"({"type": "test", "event": {"value": 1e}})");
+    handler->handleMessage(R"({"type": "test", "event": {"value": tru}})");
+    handler->handleMessage(R"({"type": "test", "event": {"value": nulll}})");
+    handler->handleMessage(R"({"type": "test", "event": {"value": [1, 2}]})");
+    handler->handleMessage(R"({"type": "test", "event": {"value" 1}})");
+    handler->handleMessage(R"({"type": "test", "event": {"value": 01}})");
+    handler->handleMessage(R"({"type": "test", "event": {"value": "\q"}})");
+    handler->handleMessage("{\"type\": \"test\", \"event\": \"\xff\"}");
+}
+
+TEST_F(MessageHandlerTest, HandleMessage_SeveralStrategiesForType_AllExecutedAfterWildcards) {
+    auto typedStrategy = std::make_unique<MockMessageStrategy>();
+    const std::string wildcard = "*";
+    EXPECT_CALL(*mockStrategy, getEventType())
+        .WillOnce(ReturnRef(eventType));
+    EXPECT_CALL(*typedStrategy, getEventType())
+        .WillOnce(ReturnRef(eventType));
+    auto wildcardStrategy = std::make_unique<MockMessageStrategy>();
+    EXPECT_CALL(*wildcardStrategy, getEventType())
+        .WillOnce(ReturnRef(wildcard));
+
+    Sequence order;
+    EXPECT_CALL(*wildcardStrategy, executeJson(_))
+        .InSequence(order);
+    EXPECT_CALL(*mockStrategy, executeJson(_))
+        .InSequence(order);
+    EXPECT_CALL(*typedStrategy, executeJson(_))
+        .InSequence(order);
+
+    handler->registerStrategy(std::move(mockStrategy));
+    handler->registerStrategy(std::move(typedStrategy));
+    handler->registerStrategy(std::move(wildcardStrategy));
+    handler->handleMessage(R"({"type": "test", "event": {}})");
+}
+
+TEST_F(MessageHandlerTest, HandleMessage_EncodedEnvelope_RoutesWrappedMessage) {
+    const nlohmann::json wrapped = {{"type", "test"}, {"event", {{"key", "value"}}}};
+    std::string envelope;
+    std::vector<uint8_t> scratch;
+    palantir::utils::PayloadCodec::appendMessage(envelope, wrapped, palantir::utils::PayloadEncoding::MSGPACK, scratch);
+
+    EXPECT_CALL(*mockStrategy, getEventType())
+        .WillOnce(ReturnRef(eventType));
+    EXPECT_CALL(*mockStrategy, executeJson(nlohmann::json{{"key", "value"}}))
+        .Times(1);
+
+    handler->registerStrategy(std::move(mockStrategy));
+    handler->handleMessage(envelope);
+}
+
+TEST_F(MessageHandlerTest, HandleMessage_MalformedEnvelope_Ignored) {
+    EXPECT_CALL(*mockStrategy, getEventType())
+        .WillOnce(ReturnRef(eventType));
+    EXPECT_CALL(*mockStrategy, executeJson(_))
+        .Times(0);
+
+    handler->registerStrategy(std::move(mockStrategy));
+    EXPECT_NO_THROW(handler->handleMessage(R"({"type": "encoded", "encoding": "msgpack", "data": "!!"})"));
+}
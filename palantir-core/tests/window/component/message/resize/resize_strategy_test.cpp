@@ -30,28 +30,28 @@ TEST_F(ResizeStrategyTest, Constructor_SetsEventType) {
     EXPECT_EQ(strategy->getEventType(), "resize");
 }
 
-TEST_F(ResizeStrategyTest, Execute_CallsContentManagerResize) {
+TEST_F(ResizeStrategyTest, Execute_CallsContentManagerRequestResize) {
     ResizeMessageVO message{800, 600};
     
-    EXPECT_CALL(*mockContentManager, resize(800, 600))
+    EXPECT_CALL(*mockContentManager, requestResize(800, 600))
         .Times(1);
     
     strategy->execute(message);
 }
 
-TEST_F(ResizeStrategyTest, Execute_ZeroValues_CallsContentManagerResize) {
+TEST_F(ResizeStrategyTest, Execute_ZeroValues_CallsContentManagerRequestResize) {
     ResizeMessageVO message{0, 0};
     
-    EXPECT_CALL(*mockContentManager, resize(0, 0))
+    EXPECT_CALL(*mockContentManager, requestResize(0, 0))
         .Times(1);
     
     strategy->execute(message);
 }
 
-TEST_F(ResizeStrategyTest, Execute_NegativeValues_CallsContentManagerResize) {
+TEST_F(ResizeStrategyTest, Execute_NegativeValues_CallsContentManagerRequestResize) {
     ResizeMessageVO message{-100, -200};
     
-    EXPECT_CALL(*mockContentManager, resize(-100, -200))
+    EXPECT_CALL(*mockContentManager, requestResize(-100, -200))
         .Times(1);
     
     strategy->execute(message);
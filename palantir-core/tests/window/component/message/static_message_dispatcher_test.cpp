@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#include "window/component/message/message_handler.hpp"
+#include "window/component/message/static_message_dispatcher.hpp"
+
+using namespace palantir::window::component::message;
+using namespace testing;
+
+namespace {
+
+struct RecordedVO {
+    std::string value;
+};
+
+struct RecordedMapper {
+    static auto fromJson(const nlohmann::json& json) -> RecordedVO {
+        return RecordedVO{json.is_object() && json.contains("value") ? json["value"].get<std::string>() : ""};
+    }
+};
+
+// Records each execution as "<name>:<value>" in a shared journal
+class RecordingStrategy {
+public:
+    using VOType = RecordedVO;
+    using Mapper = RecordedMapper;
+
+    RecordingStrategy(std::string eventType, std::vector<std::string>& journal)
+        : eventType_(std::move(eventType)), journal_(journal) {}
+
+    RecordingStrategy(const RecordingStrategy&) = delete;
+    auto operator=(const RecordingStrategy&) -> RecordingStrategy& = delete;
+    RecordingStrategy(RecordingStrategy&&) = delete;
+    auto operator=(RecordingStrategy&&) -> RecordingStrategy& = delete;
+    ~RecordingStrategy() = default;
+
+    auto execute(const RecordedVO& message) -> void { journal_.push_back(eventType_ + ":" + message.value); }
+
+    [[nodiscard]] auto getEventType() const -> const std::string& { return eventType_; }
+
+private:
+    std::string eventType_;
+    std::vector<std::string>& journal_;
+};
+
+// Records the event text it is given, without parsing it
+struct RawRecordedMapper {
+    static auto fromJson(const nlohmann::json& json) -> RecordedVO { return RecordedVO{"parsed " + json.dump()}; }
+    static auto fromRawJson(std::string_view raw) -> RecordedVO { return RecordedVO{std::string(raw)}; }
+};
+
+class RawRecordingStrategy : public RecordingStrategy {
+public:
+    using Mapper = RawRecordedMapper;
+    using RecordingStrategy::RecordingStrategy;
+};
+
+// Distinct type so a set can hold two recording strategies
+class OtherRecordingStrategy : public RecordingStrategy {
+public:
+    using RecordingStrategy::RecordingStrategy;
+};
+
+using Dispatcher = StaticMessageDispatcher<RecordingStrategy, OtherRecordingStrategy>;
+
+}  // namespace
+
+class StaticMessageDispatcherTest : public Test {
+protected:
+    std::vector<std::string> journal;
+};
+
+TEST_F(StaticMessageDispatcherTest, Handles_RegisteredType_ReturnsTrue) {
+    Dispatcher dispatcher(std::forward_as_tuple("first", journal), std::forward_as_tuple("second", journal));
+
+    EXPECT_TRUE(dispatcher.handles("first"));
+    EXPECT_TRUE(dispatcher.handles("second"));
+    EXPECT_FALSE(dispatcher.handles("third"));
+}
+
+TEST_F(StaticMessageDispatcherTest, Handles_Wildcard_ReturnsTrueForAnyType) {
+    Dispatcher dispatcher(std::forward_as_tuple("*", journal), std::forward_as_tuple("second", journal));
+
+    EXPECT_TRUE(dispatcher.handles("anything"));
+}
+
+TEST_F(StaticMessageDispatcherTest, Dispatch_MatchingType_ExecutesOnlyMatchingStrategy) {
+    Dispatcher dispatcher(std::forward_as_tuple("first", journal), std::forward_as_tuple("second", journal));
+
+    dispatcher.dispatch("second", MessageEvent(nlohmann::json{{"value", "a"}}));
+
+    EXPECT_THAT(journal, ElementsAre("second:a"));
+}
+
+TEST_F(StaticMessageDispatcherTest, Dispatch_Wildcard_RunsBeforeTypedStrategies) {
+    Dispatcher dispatcher(std::forward_as_tuple("typed", journal), std::forward_as_tuple("*", journal));
+
+    dispatcher.dispatch("typed", MessageEvent(nlohmann::json{{"value", "a"}}));
+    dispatcher.dispatch("other", MessageEvent(nlohmann::json{{"value", "b"}}));
+
+    EXPECT_THAT(journal, ElementsAre("*:a", "typed:a", "*:b"));
+}
+
+TEST_F(StaticMessageDispatcherTest, Get_ReturnsStrategyOfType) {
+    Dispatcher dispatcher(std::forward_as_tuple("first", journal), std::forward_as_tuple("second", journal));
+
+    EXPECT_EQ(dispatcher.get<OtherRecordingStrategy>().getEventType(), "second");
+}
+
+TEST_F(StaticMessageDispatcherTest, MessageHandler_RunsDispatcherBeforeTypeErasedStrategies) {
+    MessageHandler handler;
+    handler.registerStrategy(makeStrategy(std::make_unique<RecordingStrategy>("typed", journal)));
+    handler.registerDispatcher(std::make_unique<Dispatcher>(std::forward_as_tuple("typed", journal),
+                                                            std::forward_as_tuple("*", journal)));
+
+    handler.handleMessage(R"({"type": "typed", "event": {"value": "a"}})");
+
+    EXPECT_THAT(journal, ElementsAre("*:a", "typed:a", "typed:a"));
+}
+
+TEST_F(StaticMessageDispatcherTest, MessageHandler_RawMapper_ReceivesEventTextUnparsed) {
+    MessageHandler handler;
+    handler.registerDispatcher(std::make_unique<StaticMessageDispatcher<RawRecordingStrategy>>(
+        std::forward_as_tuple("*", journal)));
+
+    handler.handleMessage(R"({"type": "typed", "event": {"value" : "a"}})");
+    handler.handleMessage(R"({"type": "te\u0073t", "event": {"value" : "b"}})");
+
+    // The escaped type goes through the full parse, only then is the event serialized again
+    EXPECT_THAT(journal, ElementsAre(R"(*:{"value" : "a"})", R"(*:parsed {"value":"b"})"));
+}
+
+TEST_F(StaticMessageDispatcherTest, MessageHandler_MalformedEvent_NothingDispatchedToRawMapper) {
+    MessageHandler handler;
+    handler.registerDispatcher(std::make_unique<StaticMessageDispatcher<RawRecordingStrategy>>(
+        std::forward_as_tuple("*", journal)));
+
+    // The raw text would reach the strategy as is if the scanner accepted it
+    handler.handleMessage(R"({"type": "typed", "event": {"value": tru}})");
+    handler.handleMessage(R"({"type": "typed", "event": {"value": [1, 2}]})");
+    handler.handleMessage(R"({"type": "typed", "event": {"value": "\q"}})");
+    handler.handleMessage(R"({"type": "typed", "event": {"value": -}})");
+
+    EXPECT_TRUE(journal.empty());
+}
+
+TEST_F(StaticMessageDispatcherTest, MessageHandler_NullDispatcher_Ignored) {
+    MessageHandler handler;
+
+    handler.registerDispatcher(nullptr);
+    handler.handleMessage(R"({"type": "typed", "event": {}})");
+
+    EXPECT_TRUE(journal.empty());
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+
+#include "window/component/message/sync/content_sync_strategy.hpp"
+#include "window/component/message/sync/content_sync_message_mapper.hpp"
+#include "mock/window/component/mock_content_manager.hpp"
+
+using namespace palantir::window::component::message::sync;
+using namespace palantir::test;
+using namespace testing;
+
+class ContentSyncStrategyTest : public Test {
+protected:
+    void SetUp() override {
+        mockContentManager = std::make_shared<MockContentManager>();
+        strategy = std::make_unique<ContentSyncStrategy>("contentReady", mockContentManager);
+    }
+
+    void TearDown() override {
+        mockContentManager.reset();
+        strategy.reset();
+    }
+
+    std::shared_ptr<MockContentManager> mockContentManager;
+    std::unique_ptr<ContentSyncStrategy> strategy;
+};
+
+TEST_F(ContentSyncStrategyTest, Constructor_SetsEventType) {
+    EXPECT_EQ(strategy->getEventType(), "contentReady");
+}
+
+TEST_F(ContentSyncStrategyTest, Execute_CallsContentManagerSyncContent) {
+    EXPECT_CALL(*mockContentManager, negotiatePayloadEncoding(_));
+    EXPECT_CALL(*mockContentManager, syncContent())
+        .Times(1);
+
+    strategy->execute(ContentSyncMessageVO{"load"});
+}
+
+TEST_F(ContentSyncStrategyTest, Execute_NegotiatesEncodingBeforeSync) {
+    InSequence sequence;
+    EXPECT_CALL(*mockContentManager, negotiatePayloadEncoding(ElementsAre("msgpack")));
+    EXPECT_CALL(*mockContentManager, syncContent());
+
+    strategy->execute(ContentSyncMessageVO{"load", {"msgpack"}});
+}
+
+TEST_F(ContentSyncStrategyTest, Mapper_ReadsOptionalReason) {
+    EXPECT_EQ(ContentSyncMessageMapper::fromJson(nlohmann::json{{"reason", "reload"}}).reason, "reload");
+    EXPECT_EQ(ContentSyncMessageMapper::fromJson(nlohmann::json()).reason, "");
+}
+
+TEST_F(ContentSyncStrategyTest, Mapper_ReadsStringEncodings) {
+    auto syncMessage = ContentSyncMessageMapper::fromJson(
+        nlohmann::json::parse(R"({"reason": "load", "encodings": ["msgpack", 3, "cbor"]})"));
+
+    EXPECT_THAT(syncMessage.encodings, ElementsAre("msgpack", "cbor"));
+    EXPECT_TRUE(ContentSyncMessageMapper::fromJson(nlohmann::json{{"reason", "load"}}).encodings.empty());
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <memory>
+#include <nlohmann/json.hpp>
+
+#include "window/component/content_manager_impl.hpp"
+#include "window/component/webview/headless_view.hpp"
+
+using namespace palantir::window::component;
+using namespace palantir::window::component::webview;
+using namespace testing;
+
+template class palantir::window::component::ContentManager<HeadlessView>;
+
+class HeadlessViewTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        view = std::make_shared<HeadlessView>();
+        contentManager = std::make_shared<ContentManager<HeadlessView>>(view);
+    }
+
+    void TearDown() override {
+        contentManager.reset();
+        view.reset();
+    }
+
+    std::shared_ptr<HeadlessView> view;
+    std::shared_ptr<ContentManager<HeadlessView>> contentManager;
+};
+
+TEST_F(HeadlessViewTest, Initialize_CallsCallbackAndLoadsUrl) {
+    contentManager->initialize(0);
+
+    EXPECT_TRUE(view->isInitialized());
+    EXPECT_FALSE(view->getUrl().empty());
+}
+
+TEST_F(HeadlessViewTest, PostMessage_RecordsMessagesAndBytes) {
+    contentManager->setRootContent(R"({"explanation": "a", "response": "b"})");
+    contentManager->flush();
+
+    ASSERT_EQ(view->getPostedMessages().size(), 1u);
+    EXPECT_EQ(nlohmann::json::parse(view->getPostedMessages()[0])["type"], "setContent");
+    EXPECT_EQ(view->getStats().postedBytes, view->getPostedMessages()[0].size());
+}
+
+TEST_F(HeadlessViewTest, SetRecording_Disabled_OnlyCounts) {
+    view->setRecording(false);
+
+    view->postMessage("{}");
+    view->executeJavaScript("1");
+    view->resize(1, 2);
+
+    EXPECT_TRUE(view->getPostedMessages().empty());
+    EXPECT_TRUE(view->getExecutedScripts().empty());
+    EXPECT_TRUE(view->getResizes().empty());
+    EXPECT_EQ(view->getStats().posts, 1u);
+    EXPECT_EQ(view->getStats().scripts, 1u);
+    EXPECT_EQ(view->getStats().resizes, 1u);
+}
+
+TEST_F(HeadlessViewTest, HandleMessage_ContentSize_ResizesThroughContentManager) {
+    contentManager->initialize(0);
+
+    view->handleMessage(R"({"type": "contentSize", "event": {"width": 640, "height": 480}})");
+
+    ASSERT_EQ(view->getResizes().size(), 1u);
+    EXPECT_EQ(view->getResizes()[0], std::make_pair(640, 480));
+    EXPECT_EQ(contentManager->getContentWidth(), 640);
+    EXPECT_EQ(view->getStats().handledMessages, 1u);
+}
+
+TEST_F(HeadlessViewTest, HandleMessage_ContentReady_SendsSnapshot) {
+    contentManager->initialize(0);
+    contentManager->setRootContent(R"({"explanation": "a", "response": "b"})");
+    contentManager->flush();
+    view->clear();
+
+    view->handleMessage(R"({"type": "contentReady", "event": {"reason": "load"}})");
+
+    ASSERT_EQ(view->getPostedMessages().size(), 1u);
+    EXPECT_EQ(nlohmann::json::parse(view->getPostedMessages()[0])["type"], "setContent");
+}
+
+TEST_F(HeadlessViewTest, SetCosts_PostCost_DelaysCall) {
+    HeadlessViewCosts costs;
+    costs.post = std::chrono::milliseconds(2);
+    view->setCosts(costs);
+
+    const auto start = std::chrono::steady_clock::now();
+    view->postMessage("{}");
+
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(2));
+}
+
+TEST_F(HeadlessViewTest, Clear_ResetsRecordingsAndStats) {
+    view->postMessage("{}");
+    view->executeJavaScript("1");
+
+    view->clear();
+
+    EXPECT_TRUE(view->getPostedMessages().empty());
+    EXPECT_TRUE(view->getExecutedScripts().empty());
+    EXPECT_EQ(view->getStats().posts, 0u);
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "plugin/iplugin.hpp"
+#include "plugin/plugin_abi.h"
+
+namespace palantir::plugin {
+
+/**
+ * @brief IPlugin calling a plugin through the table filled by its palantirCreatePlugin()
+ *
+ * Destroying it destroys the plugin, so it must be destroyed before the library is unloaded.
+ */
+class AbiPlugin final : public IPlugin {
+public:
+    explicit AbiPlugin(const PalantirPluginApi& api);
+    ~AbiPlugin() override;
+
+    AbiPlugin(const AbiPlugin&) = delete;
+    auto operator=(const AbiPlugin&) -> AbiPlugin& = delete;
+    AbiPlugin(AbiPlugin&&) = delete;
+    auto operator=(AbiPlugin&&) -> AbiPlugin& = delete;
+
+    /**
+     * @brief Check that a table filled by a plugin can be used by this host
+     * @return Why it cannot, empty if it can
+     */
+    [[nodiscard]] static auto validate(const PalantirPluginApi& api) -> std::string;
+
+    auto initialize() -> bool override;
+    auto shutdown() -> void override;
+    [[nodiscard]] auto getName() const -> std::string override;
+    [[nodiscard]] auto getVersion() const -> std::string override;
+    [[nodiscard]] auto getDependencies() const -> std::vector<std::string> override;
+    [[nodiscard]] auto getProvidedCommands() const -> std::vector<std::string> override;
+    [[nodiscard]] auto getDebouncedCommands() const -> std::vector<std::string> override;
+
+private:
+    PalantirPluginApi api_;
+};
+
+} // namespace palantir::plugin
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "command/icommand.hpp"
+
+namespace palantir::plugin {
+
+/**
+ * @brief Stands for a command of a plugin whose library is not loaded yet
+ *
+ * Registered in CommandFactory from the plugin manifest. An execution before the plugin is loaded
+ * returns at once: the plugin is loaded off the calling thread, which may be a keyboard hook, and
+ * registers the real command in place of the stub, which is then created and run. Later executions
+ * run the real command directly.
+ */
+class DeferredCommand : public command::ICommand {
+public:
+    // Called with whether the plugin is loaded, once the load ends
+    using LoadedFunc = std::function<void(bool)>;
+    using PluginLoadFunc = std::function<void(LoadedFunc)>;
+
+    /**
+     * @param name Name of the command in CommandFactory
+     * @param debounce Whether the real command uses debounce, as recorded in the manifest
+     * @param loadPlugin Starts loading and initializing the plugin providing the command without
+     *        waiting for it, then calls its argument
+     */
+    DeferredCommand(std::string name, bool debounce, PluginLoadFunc loadPlugin);
+    ~DeferredCommand() override = default;
+
+    DeferredCommand(const DeferredCommand&) = delete;
+    auto operator=(const DeferredCommand&) -> DeferredCommand& = delete;
+    DeferredCommand(DeferredCommand&&) = delete;
+    auto operator=(DeferredCommand&&) -> DeferredCommand& = delete;
+
+    auto execute() const -> void override;
+    [[nodiscard]] auto useDebounce() const -> bool override;
+
+private:
+    // Shared with the pending loads, which may end after the stub is destroyed
+    struct RealCommand {
+        std::mutex mutex;
+        std::unique_ptr<command::ICommand> command;
+    };
+
+    std::string name_;
+    bool debounce_;
+    PluginLoadFunc loadPlugin_;
+    std::shared_ptr<RealCommand> real_;
+};
+
+} // namespace palantir::plugin
@@ -2,7 +2,10 @@
 
 #include <string>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include "plugin/iplugin.hpp"
+#include "plugin/plugin_abi.h"
 
 #ifdef _WIN32
     #include <Windows.h>
@@ -13,6 +16,31 @@
 
 namespace palantir::plugin {
 
+class PluginLoader;
+
+/**
+ * @brief Destroys a plugin through the destroy function of the library that created it
+ */
+struct PluginDeleter {
+    PluginLoader* loader{nullptr};
+
+    auto operator()(IPlugin* plugin) const -> void;
+};
+
+using PluginPtr = std::unique_ptr<IPlugin, PluginDeleter>;
+
+/**
+ * @brief Loads plugin libraries and creates plugins from them
+ *
+ * Plugins are created through the palantirCreatePlugin() entry point of their library, see
+ * plugin_abi.h, which receives the capability table of PluginHost. A library whose interface
+ * version differs from the host's is rejected.
+ *
+ * Every library stays loaded as long as one of its plugins is alive. Loading the same library again
+ * reuses the loaded handle. Plugins must be released before the loader.
+ *
+ * Plugins can be loaded and unloaded from several threads at once.
+ */
 class PluginLoader {
 public:
     PluginLoader() = default;
@@ -26,24 +54,58 @@ public:
     /**
      * @brief Load a plugin from the specified path
      * @param path Path to the plugin shared library
-     * @return Pointer to the loaded plugin, nullptr if loading failed
+     * @return The loaded plugin, nullptr if loading failed, see getLastError()
      */
-    [[nodiscard]] auto loadPlugin(const std::string& path) -> std::unique_ptr<IPlugin>;
+    [[nodiscard]] auto loadPlugin(const std::string& path) -> PluginPtr;
 
     /**
-     * @brief Unload a plugin
+     * @brief Destroy a plugin and unload its library if it was the last plugin created from it
      * @param plugin Plugin to unload
      */
     auto unloadPlugin(IPlugin* plugin) -> void;
 
+    /**
+     * @brief Check whether a library is loaded
+     * @param path Path to the plugin shared library
+     */
+    [[nodiscard]] auto isLoaded(const std::string& path) const -> bool;
+
+    /**
+     * @brief Get the number of libraries currently loaded
+     */
+    [[nodiscard]] auto getLoadedLibraryCount() const -> size_t;
+
+    /**
+     * @brief Get why the last loadPlugin call made by the calling thread failed
+     *
+     * The error is kept per thread, not per loader, empty if that call succeeded.
+     */
+    [[nodiscard]] auto getLastError() const -> std::string;
+
 private:
+    struct LoadedLibrary {
+        LibraryHandle handle;
+        PalantirCreatePluginFunc createFunc;
+        // Plugins created from the library and not destroyed yet, or being created
+        size_t instances;
+    };
+
+    auto openLibrary(const std::string& key, const std::string& path) -> LoadedLibrary*;
+    auto releaseInstance(const std::string& key) -> void;
+    auto setLastError(std::string error) -> void;
+
+    // Platform backend
     auto loadLibrary(const std::string& path) -> LibraryHandle;
     auto unloadLibrary(LibraryHandle handle) -> void;
     auto getSymbol(LibraryHandle handle, const std::string& symbol) -> void*;
+    auto getLibraryError() -> std::string;
 
-    LibraryHandle currentHandle_;
-    CreatePluginFunc createFunc_;
-    DestroyPluginFunc destroyFunc_;
+    // Keyed by the canonical path of the library
+    std::unordered_map<std::string, LoadedLibrary> libraries_;
+    // Key of the library each live plugin was created from
+    std::unordered_map<const IPlugin*, std::string> owners_;
+    // Guards the maps above, never held while a library is loaded or a plugin created
+    mutable std::mutex mutex_;
 };
 
 } // namespace palantir::plugin
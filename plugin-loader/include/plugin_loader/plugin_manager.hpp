@@ -1,21 +1,63 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <string>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
+#include "deferred_command.hpp"
 #include "plugin/iplugin.hpp"
 #include "plugin_loader.hpp"
+#include "plugin_manifest.hpp"
+#include "plugin_watcher.hpp"
+#include "ui_dispatcher.hpp"
+#include "utils/thread_pool.hpp"
 #include <filesystem>
 
 namespace palantir::plugin {
 
+/**
+ * @brief Time spent loading and initializing one plugin
+ */
+struct PluginTiming {
+    std::string name;
+    std::chrono::microseconds load{0};
+    std::chrono::microseconds initialize{0};
+    std::chrono::steady_clock::time_point initializeStart;
+    std::chrono::steady_clock::time_point initializeEnd;
+    bool initialized{false};
+};
+
+/**
+ * @brief Loads, initializes and owns the plugins of the application
+ *
+ * Libraries of a directory are loaded in parallel. Plugins are initialized in parallel too, each
+ * one once the plugins named by its getDependencies() are initialized.
+ *
+ * setupFromDirectory() leaves the plugins described by a manifest listing commands unloaded, see
+ * PluginManifest: their commands are registered as DeferredCommand stubs and the first one to run
+ * loads the plugin on a worker of the manager, never on the thread running the stub. The manager
+ * must outlive the commands created from the stubs.
+ *
+ * With hot reload enabled, libraries are loaded from shadow copies and a plugin is reloaded when
+ * its library in the watched directory is rebuilt, see enableHotReload().
+ */
 class PluginManager {
 public:
     const static std::vector<std::string> PLUGIN_EXTENSIONS;
 
-    PluginManager() = default;
-    ~PluginManager() = default;
+    // Recreates every command held outside the factory, returning once the previous ones are released
+    using RebindFunc = std::function<void()>;
+
+    /**
+     * @param threadCount Threads used to load and initialize plugins, 0 for one per hardware thread
+     */
+    explicit PluginManager(size_t threadCount = 0);
+    ~PluginManager();
 
     PluginManager(const PluginManager&) = delete;
     auto operator=(const PluginManager&) -> PluginManager& = delete;
@@ -31,6 +73,10 @@ public:
 
     /**
      * @brief Load all plugins from a directory
+     *
+     * Libraries are loaded in parallel and registered in path order, so the first of two plugins
+     * with the same name wins regardless of thread timing.
+     *
      * @param directory Directory containing plugin shared libraries
      * @return Number of plugins successfully loaded
      */
@@ -58,25 +104,156 @@ public:
 
     /**
      * @brief Initialize all loaded plugins
+     *
+     * A plugin is not initialized when one of its dependencies is missing, is part of a cycle or
+     * failed to initialize.
+     *
+     * Plugins without a dependency between them initialize at the same time, on worker threads of
+     * the manager and while its lock is held. IPlugin::initialize() must therefore not call back
+     * into the manager, must not expect to run on the UI thread, and must only touch shared state
+     * through thread-safe APIs such as CommandFactory.
+     *
      * @return true if all plugins initialized successfully
      */
     auto initializeAll() -> bool;
 
+    /**
+     * @brief Get the load and initialization times of the loaded plugins
+     * @return One entry per plugin, sorted by name
+     */
+    [[nodiscard]] auto getTimings() const -> std::vector<PluginTiming>;
+
+    /**
+     * @brief Get the names of the plugins waiting for one of their commands to run
+     */
+    [[nodiscard]] auto getDeferredPlugins() const -> std::vector<std::string>;
+
     /**
      * @brief Setup all plugins from a directory
+     *
+     * Plugins with a current manifest listing commands are deferred, unless a plugin loaded now
+     * depends on them. The others are loaded and initialized, then a manifest is written for those
+     * which had none or an outdated one and provide commands.
+     *
      * @param directory Directory containing plugin shared libraries
      * @return true if all plugins setup successfully
      */
     auto setupFromDirectory(const std::filesystem::path& pluginsDir) -> bool;
 
     /**
-     * @brief Shutdown all loaded plugins
+     * @brief Load and initialize a deferred plugin, after its deferred dependencies
+     *
+     * A plugin failing to load stays deferred, with the stubs of its commands registered again.
+     *
+     * @param name Name of the plugin, as written in its manifest
+     * @return true if the plugin is loaded, now or before
+     */
+    auto loadDeferredPlugin(const std::string& name) -> bool;
+
+    /**
+     * @brief Load a deferred plugin on a worker of the manager, see loadDeferredPlugin()
+     *
+     * Returns at once. Loads run one after the other, in the order they were asked for.
+     *
+     * @param name Name of the plugin, as written in its manifest
+     * @param onLoaded Called with the result of the load, through the UI dispatcher when one is set,
+     *        on the worker otherwise
+     */
+    auto loadDeferredPluginAsync(const std::string& name, DeferredCommand::LoadedFunc onLoaded) -> void;
+
+    /**
+     * @brief Wait for the loads started by loadDeferredPluginAsync()
+     *
+     * Callbacks run on the worker are done too, those handed to the UI dispatcher are queued there.
+     */
+    auto waitForDeferredLoads() -> void;
+
+    /**
+     * @brief Run the commands of deferred plugins on the UI thread once their plugin is loaded
+     *
+     * Without a dispatcher, they run on the worker which loaded the plugin.
+     */
+    auto setUiDispatcher(std::shared_ptr<UiDispatcher> dispatcher) -> void;
+
+    /**
+     * @brief Reload plugins when their library changes
+     *
+     * Must be called before setupFromDirectory(), which then loads libraries from shadow copies,
+     * leaving the originals free to be rebuilt, and watches the directory.
+     *
+     * @param rebind Rebinds the signals, see ISignalManager::rebindSignals()
+     */
+    auto enableHotReload(RebindFunc rebind) -> void;
+
+    /**
+     * @brief Replace a plugin by a fresh copy of its library
+     *
+     * Loads on first use still running are waited for first. The plugin is shut down and its commands
+     * are parked on DeferredCommand stubs, then signals are rebound, which drains the commands in
+     * flight. The previous library is unloaded, cached stack frames are dropped, the new one
+     * loaded and initialized, and signals are rebound again to its commands. If the new build fails
+     * to load, the plugin stays deferred and its commands on stubs. Only plugins listing
+     * their commands, see IPlugin::getProvidedCommands(), can be reloaded.
+     *
+     * @param name Name of the plugin to reload
+     * @return true if the new build is loaded and initialized
+     */
+    auto reloadPlugin(const std::string& name) -> bool;
+
+    /**
+     * @brief Shutdown and unload all loaded plugins
      */
     auto shutdownAll() -> void;
 
 private:
+    struct DeferredPlugin {
+        std::filesystem::path library;
+        PluginManifest manifest;
+    };
+
+    // Lock mutex_ themselves
+    auto loadLibraries(const std::vector<std::filesystem::path>& paths) -> size_t;
+    auto deferPlugin(const std::filesystem::path& library, PluginManifest manifest) -> void;
+    auto loadDeferredDependencies() -> void;
+    auto writeManifests(const std::vector<std::filesystem::path>& libraries) -> void;
+    auto onLibraryChanged(const std::filesystem::path& library) -> void;
+
+    // Called with mutex_ held
+    auto registerPlugin(PluginPtr plugin, const std::filesystem::path& library, const std::filesystem::path& loadedFrom,
+                        std::chrono::microseconds loadTime) -> bool;
+    auto loadDeferred(const std::string& name) -> bool;
+    auto restoreDeferred(std::string name, DeferredPlugin deferred) -> void;
+    auto registerStubs(const PluginManifest& manifest) -> void;
+    auto unregisterStubs(const PluginManifest& manifest) -> void;
+    auto removeShadow(const std::string& name) -> void;
+    auto sortedTimings() const -> std::vector<PluginTiming>;
+    auto logTimings() const -> void;
+
+    // Path to load a library from, a new shadow copy when hot reload is enabled
+    auto resolveLibrary(const std::filesystem::path& library) -> std::filesystem::path;
+
+    size_t threadCount_;
     PluginLoader loader_;
-    std::unordered_map<std::string, std::unique_ptr<IPlugin>> plugins_;
+    // Declared after the loader so plugins are destroyed while their libraries are still loaded
+    std::unordered_map<std::string, PluginPtr> plugins_;
+    std::unordered_map<std::string, PluginTiming> timings_;
+    std::unordered_map<std::string, std::filesystem::path> libraries_;
+    // Copy each plugin was loaded from, when it is not its library
+    std::unordered_map<std::string, std::filesystem::path> shadows_;
+    std::unordered_map<std::string, DeferredPlugin> deferred_;
+    // Deferred plugins are loaded on loadPool_, or by the thread calling loadDeferredPlugin()
+    mutable std::mutex mutex_;
+    RebindFunc rebind_;
+    std::filesystem::path shadowDirectory_;
+    std::atomic<size_t> shadowGeneration_{0};
+    std::unique_ptr<PluginWatcher> watcher_;
+    // Guards the deferred loads in flight, apart from mutex_ so stubs never wait for a load
+    std::mutex loadsMutex_;
+    std::condition_variable loadsDone_;
+    size_t pendingLoads_{0};
+    std::shared_ptr<UiDispatcher> uiDispatcher_;
+    // Started on the first deferred load, joined before anything its tasks use is destroyed
+    std::unique_ptr<utils::ThreadPool> loadPool_;
 };
 
 } // namespace palantir::plugin
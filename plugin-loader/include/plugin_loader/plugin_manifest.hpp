@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+#include "plugin/iplugin.hpp"
+
+namespace palantir::plugin {
+
+/**
+ * @brief Command a plugin registers, as recorded in its manifest
+ */
+struct ManifestCommand {
+    std::string name;
+    bool debounce{false};
+};
+
+/**
+ * @brief What the manager needs to know about a plugin without loading its library
+ *
+ * Stored as JSON next to the library, see getPath(). A shipped manifest without a library stamp
+ * is trusted as is, a generated one is only used while the library keeps its size and write time.
+ */
+struct PluginManifest {
+    std::string name;
+    std::string version;
+    std::vector<std::string> dependencies;
+    std::vector<ManifestCommand> commands;
+    std::optional<std::uintmax_t> librarySize;
+    std::optional<std::int64_t> libraryWriteTime;
+
+    /**
+     * @brief Get the manifest path of a plugin library, `<stem>.plugin.json` in its directory
+     */
+    [[nodiscard]] static auto getPath(const std::filesystem::path& library) -> std::filesystem::path;
+
+    /**
+     * @brief Read the manifest of a plugin library
+     * @return The manifest, std::nullopt if it is missing or malformed
+     */
+    [[nodiscard]] static auto load(const std::filesystem::path& library) -> std::optional<PluginManifest>;
+
+    /**
+     * @brief Describe a loaded and initialized plugin, stamped with its library
+     *
+     * Whether a command uses debounce comes from IPlugin::getDebouncedCommands(), no command is
+     * created.
+     */
+    [[nodiscard]] static auto describe(const IPlugin& plugin, const std::filesystem::path& library) -> PluginManifest;
+
+    /**
+     * @brief Write the manifest next to a plugin library
+     * @return false if the file could not be written
+     */
+    auto save(const std::filesystem::path& library) const -> bool;
+
+    /**
+     * @brief Check whether the manifest still describes a plugin library
+     */
+    [[nodiscard]] auto matches(const std::filesystem::path& library) const -> bool;
+};
+
+} // namespace palantir::plugin
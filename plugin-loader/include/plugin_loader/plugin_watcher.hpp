@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace palantir::plugin {
+
+/**
+ * @brief Watches a plugin directory and reports libraries once they are done being written
+ *
+ * A library is reported when it has not changed for SETTLE_TIME, so a build writing it in several
+ * steps triggers a single report. Reports run on the watcher thread.
+ */
+class PluginWatcher {
+public:
+    using ChangeCallback = std::function<void(const std::filesystem::path& library)>;
+
+    static constexpr std::chrono::milliseconds SETTLE_TIME{300};
+    static constexpr std::chrono::milliseconds POLL_INTERVAL{100};
+
+    /**
+     * @param directory Directory to watch
+     * @param extensions Extensions of the files to report
+     * @param onChange Called with the path of each changed library
+     */
+    PluginWatcher(std::filesystem::path directory, std::vector<std::string> extensions, ChangeCallback onChange);
+    ~PluginWatcher();
+
+    PluginWatcher(const PluginWatcher&) = delete;
+    auto operator=(const PluginWatcher&) -> PluginWatcher& = delete;
+    PluginWatcher(PluginWatcher&&) = delete;
+    auto operator=(PluginWatcher&&) -> PluginWatcher& = delete;
+
+    /**
+     * @brief Start watching on a thread of its own
+     * @return false if the directory cannot be watched
+     */
+    auto start() -> bool;
+
+    /**
+     * @brief Stop watching, waiting for a report in progress to finish
+     */
+    auto stop() -> void;
+
+    [[nodiscard]] auto isRunning() const -> bool;
+
+private:
+    auto run() -> void;
+
+    // Platform backend
+    auto openWatch() -> bool;
+    auto waitForChanges(std::chrono::milliseconds timeout) -> std::vector<std::filesystem::path>;
+    auto closeWatch() -> void;
+
+    std::filesystem::path directory_;
+    std::vector<std::string> extensions_;
+    ChangeCallback onChange_;
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+
+    // Backend state, a notification handle or the last seen write times when polling
+    std::intptr_t watchHandle_{-1};
+    std::unordered_map<std::string, std::filesystem::file_time_type> writeTimes_;
+};
+
+} // namespace palantir::plugin
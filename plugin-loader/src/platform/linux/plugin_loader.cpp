@@ -0,0 +1,24 @@
+#include "plugin_loader/plugin_loader.hpp"
+#include <dlfcn.h>
+
+namespace palantir::plugin {
+
+// Local binding keeps the symbols of one plugin from resolving against another's
+auto PluginLoader::loadLibrary(const std::string& path) -> LibraryHandle {
+    return dlopen(path.c_str(), RTLD_LAZY | RTLD_LOCAL);
+}
+
+auto PluginLoader::unloadLibrary(LibraryHandle handle) -> void {
+    dlclose(handle);
+}
+
+auto PluginLoader::getSymbol(LibraryHandle handle, const std::string& symbol) -> void* {
+    return dlsym(handle, symbol.c_str());
+}
+
+auto PluginLoader::getLibraryError() -> std::string {
+    const char* error = dlerror();
+    return error ? error : "unknown error";
+}
+
+} // namespace palantir::plugin
@@ -0,0 +1,7 @@
+#include "plugin_loader/plugin_manager.hpp"
+
+namespace palantir::plugin {
+
+    const std::vector<std::string> PluginManager::PLUGIN_EXTENSIONS = {".so"};
+
+} // namespace palantir::plugin
@@ -0,0 +1,51 @@
+#include "plugin_loader/plugin_watcher.hpp"
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <array>
+
+namespace palantir::plugin {
+
+// A linker may write the library in place or rename a temporary file over it
+auto PluginWatcher::openWatch() -> bool {
+    const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    if (inotify_add_watch(fd, directory_.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0) {
+        close(fd);
+        return false;
+    }
+    watchHandle_ = fd;
+    return true;
+}
+
+auto PluginWatcher::waitForChanges(std::chrono::milliseconds timeout) -> std::vector<std::filesystem::path> {
+    std::vector<std::filesystem::path> changes;
+    pollfd descriptor{static_cast<int>(watchHandle_), POLLIN, 0};
+    if (poll(&descriptor, 1, static_cast<int>(timeout.count())) <= 0) {
+        return changes;
+    }
+
+    alignas(inotify_event) std::array<char, 4096> buffer{};
+    ssize_t length = 0;
+    while ((length = read(static_cast<int>(watchHandle_), buffer.data(), buffer.size())) > 0) {
+        for (ssize_t offset = 0; offset < length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+            if (event->len > 0) {
+                changes.push_back(directory_ / event->name);
+            }
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+        }
+    }
+    return changes;
+}
+
+auto PluginWatcher::closeWatch() -> void {
+    if (watchHandle_ >= 0) {
+        close(static_cast<int>(watchHandle_));
+        watchHandle_ = -1;
+    }
+}
+
+} // namespace palantir::plugin
@@ -15,4 +15,9 @@ void* PluginLoader::getSymbol(LibraryHandle handle, const std::string& symbol) {
     return dlsym(handle, symbol.c_str());
 }
 
+std::string PluginLoader::getLibraryError() {
+    const char* error = dlerror();
+    return error ? error : "unknown error";
+}
+
 } // namespace palantir::plugin 
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "plugin_loader/plugin_watcher.hpp"
+#include <system_error>
+
+namespace palantir::plugin {
+
+namespace {
+
+auto readWriteTimes(const std::filesystem::path& directory)
+    -> std::unordered_map<std::string, std::filesystem::file_time_type> {
+    std::unordered_map<std::string, std::filesystem::file_time_type> writeTimes;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+        if (entry.is_regular_file(error)) {
+            writeTimes[entry.path().string()] = entry.last_write_time(error);
+        }
+    }
+    return writeTimes;
+}
+
+} // namespace
+
+// Scans the directory, the libraries are few and a scan costs next to nothing
+auto PluginWatcher::openWatch() -> bool {
+    if (!std::filesystem::is_directory(directory_)) {
+        return false;
+    }
+    writeTimes_ = readWriteTimes(directory_);
+    return true;
+}
+
+auto PluginWatcher::waitForChanges(std::chrono::milliseconds timeout) -> std::vector<std::filesystem::path> {
+    std::this_thread::sleep_for(timeout);
+
+    std::vector<std::filesystem::path> changes;
+    auto writeTimes = readWriteTimes(directory_);
+    for (const auto& [path, writeTime] : writeTimes) {
+        auto previous = writeTimes_.find(path);
+        if (previous == writeTimes_.end() || previous->second != writeTime) {
+            changes.emplace_back(path);
+        }
+    }
+    writeTimes_ = std::move(writeTimes);
+    return changes;
+}
+
+auto PluginWatcher::closeWatch() -> void { writeTimes_.clear(); }
+
+} // namespace palantir::plugin
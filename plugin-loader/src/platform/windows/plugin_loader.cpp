@@ -15,4 +15,8 @@ void* PluginLoader::getSymbol(LibraryHandle handle, const std::string& symbol) {
     return reinterpret_cast<void*>(GetProcAddress(handle, symbol.c_str()));
 }
 
+std::string PluginLoader::getLibraryError() {
+    return "error " + std::to_string(GetLastError());
+}
+
 } // namespace palantir::plugin 
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "plugin_loader/abi_plugin.hpp"
+
+namespace palantir::plugin {
+
+namespace {
+
+auto toString(PalantirStringView view) -> std::string {
+    return view.data != nullptr ? std::string(view.data, view.size) : std::string();
+}
+
+auto toStrings(const PalantirPluginApi& api, size_t (*count)(const void*),
+               PalantirStringView (*get)(const void*, size_t)) -> std::vector<std::string> {
+    std::vector<std::string> strings;
+    const size_t size = count(api.self);
+    strings.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        strings.push_back(toString(get(api.self, i)));
+    }
+    return strings;
+}
+
+} // namespace
+
+AbiPlugin::AbiPlugin(const PalantirPluginApi& api) : api_(api) {}
+
+AbiPlugin::~AbiPlugin() { api_.destroy(api_.self); }
+
+auto AbiPlugin::validate(const PalantirPluginApi& api) -> std::string {
+    if (api.abiVersion != PALANTIR_PLUGIN_ABI_VERSION) {
+        return "plugin interface version " + std::to_string(api.abiVersion) + ", expected " +
+               std::to_string(PALANTIR_PLUGIN_ABI_VERSION);
+    }
+    if (api.size < sizeof(PalantirPluginApi)) {
+        return "plugin table too small";
+    }
+    if (api.initialize == nullptr || api.shutdown == nullptr || api.getName == nullptr || api.getVersion == nullptr ||
+        api.getDependencyCount == nullptr || api.getDependency == nullptr || api.getProvidedCommandCount == nullptr ||
+        api.getProvidedCommand == nullptr || api.destroy == nullptr || api.getDebouncedCommandCount == nullptr ||
+        api.getDebouncedCommand == nullptr) {
+        return "plugin table incomplete";
+    }
+    return {};
+}
+
+auto AbiPlugin::initialize() -> bool { return api_.initialize(api_.self) != 0; }
+
+auto AbiPlugin::shutdown() -> void { api_.shutdown(api_.self); }
+
+auto AbiPlugin::getName() const -> std::string { return toString(api_.getName(api_.self)); }
+
+auto AbiPlugin::getVersion() const -> std::string { return toString(api_.getVersion(api_.self)); }
+
+auto AbiPlugin::getDependencies() const -> std::vector<std::string> {
+    return toStrings(api_, api_.getDependencyCount, api_.getDependency);
+}
+
+auto AbiPlugin::getProvidedCommands() const -> std::vector<std::string> {
+    return toStrings(api_, api_.getProvidedCommandCount, api_.getProvidedCommand);
+}
+
+auto AbiPlugin::getDebouncedCommands() const -> std::vector<std::string> {
+    return toStrings(api_, api_.getDebouncedCommandCount, api_.getDebouncedCommand);
+}
+
+} // namespace palantir::plugin
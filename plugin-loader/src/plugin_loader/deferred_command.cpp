@@ -0,0 +1,46 @@
+#include "plugin_loader/deferred_command.hpp"
+
+#include "command/command_factory.hpp"
+#include "utils/logger.hpp"
+
+namespace palantir::plugin {
+
+DeferredCommand::DeferredCommand(std::string name, bool debounce, PluginLoadFunc loadPlugin)
+    : name_(std::move(name)),
+      debounce_(debounce),
+      loadPlugin_(std::move(loadPlugin)),
+      real_(std::make_shared<RealCommand>()) {}
+
+auto DeferredCommand::execute() const -> void {
+    {
+        std::unique_lock lock(real_->mutex);
+        if (real_->command) {
+            auto* command = real_->command.get();
+            lock.unlock();
+            command->execute();
+            return;
+        }
+    }
+
+    loadPlugin_([real = real_, name = name_](bool loaded) {
+        if (!loaded) {
+            PALANTIR_LOG_ERROR("Could not load the plugin providing command {}", name);
+            return;
+        }
+        std::unique_lock lock(real->mutex);
+        if (!real->command) {
+            real->command = command::CommandFactory::getInstance()->getCommand(name);
+            if (!real->command) {
+                PALANTIR_LOG_ERROR("Plugin did not register command {} listed in its manifest", name);
+                return;
+            }
+        }
+        auto* command = real->command.get();
+        lock.unlock();
+        command->execute();
+    });
+}
+
+auto DeferredCommand::useDebounce() const -> bool { return debounce_; }
+
+} // namespace palantir::plugin
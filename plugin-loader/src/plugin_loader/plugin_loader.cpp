@@ -1,53 +1,155 @@
 #include "plugin_loader/plugin_loader.hpp"
 
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+#include "plugin/plugin_host.hpp"
+#include "plugin_loader/abi_plugin.hpp"
+
 namespace palantir::plugin {
 
+namespace {
+
+// Per thread, so concurrent loads each report their own failure, and gone with the thread
+thread_local std::string lastError;
+
+// The same library reached through different paths must map to a single handle
+auto libraryKey(const std::string& path) -> std::string {
+    std::error_code error;
+    auto canonical = std::filesystem::weakly_canonical(std::filesystem::path(path), error);
+    return error ? path : canonical.string();
+}
+
+} // namespace
+
+auto PluginDeleter::operator()(IPlugin* plugin) const -> void {
+    if (loader) {
+        loader->unloadPlugin(plugin);
+    }
+}
+
 PluginLoader::~PluginLoader() {
-    if (currentHandle_) {
-        unloadLibrary(currentHandle_);
+    for (auto& [key, library] : libraries_) {
+        unloadLibrary(library.handle);
     }
 }
 
-auto PluginLoader::loadPlugin(const std::string& path) -> std::unique_ptr<IPlugin> {
-    // Unload any previously loaded library
-    if (currentHandle_) {
-        unloadLibrary(currentHandle_);
-        currentHandle_ = nullptr;
-        createFunc_ = nullptr;
-        destroyFunc_ = nullptr;
+auto PluginLoader::loadPlugin(const std::string& path) -> PluginPtr {
+    setLastError({});
+    const auto key = libraryKey(path);
+
+    // The library holds one instance for us from here, so it cannot be unloaded under createFunc
+    auto* library = openLibrary(key, path);
+    if (!library) {
+        return PluginPtr(nullptr, PluginDeleter{this});
     }
 
-    // Load the new library
-    currentHandle_ = loadLibrary(path);
-    if (!currentHandle_) {
-        return nullptr;
+    // Create the plugin instance
+    PalantirPluginApi api{};
+    if (library->createFunc(PluginHost::getApi(), &api) == 0) {
+        setLastError("palantirCreatePlugin failed, the plugin may target another interface version: " + path);
+        releaseInstance(key);
+        return PluginPtr(nullptr, PluginDeleter{this});
+    }
+    if (auto invalid = AbiPlugin::validate(api); !invalid.empty()) {
+        // The layout of a table of another version is unknown, leak it rather than guess
+        if (api.abiVersion == PALANTIR_PLUGIN_ABI_VERSION && api.destroy != nullptr) {
+            api.destroy(api.self);
+        }
+        setLastError("Incompatible plugin " + path + ": " + invalid);
+        releaseInstance(key);
+        return PluginPtr(nullptr, PluginDeleter{this});
+    }
+    IPlugin* plugin = new AbiPlugin(api);
+
+    std::scoped_lock lock(mutex_);
+    owners_[plugin] = key;
+    return PluginPtr(plugin, PluginDeleter{this});
+}
+
+auto PluginLoader::unloadPlugin(IPlugin* plugin) -> void {
+    if (!plugin) {
+        return;
     }
 
-    // Get the creation and destruction functions
-    createFunc_ = reinterpret_cast<CreatePluginFunc>(getSymbol(currentHandle_, "createPlugin"));
-    destroyFunc_ = reinterpret_cast<DestroyPluginFunc>(getSymbol(currentHandle_, "destroyPlugin"));
+    std::string key;
+    {
+        std::scoped_lock lock(mutex_);
+        auto owner = owners_.find(plugin);
+        if (owner == owners_.end()) {
+            return;
+        }
+        key = std::move(owner->second);
+        owners_.erase(owner);
+    }
+
+    // Destroys the plugin in its library, which stays loaded until the instance is released
+    delete plugin;
+    releaseInstance(key);
+}
+
+auto PluginLoader::isLoaded(const std::string& path) const -> bool {
+    const auto key = libraryKey(path);
+    std::scoped_lock lock(mutex_);
+    return libraries_.contains(key);
+}
+
+auto PluginLoader::getLoadedLibraryCount() const -> size_t {
+    std::scoped_lock lock(mutex_);
+    return libraries_.size();
+}
+
+auto PluginLoader::getLastError() const -> std::string { return lastError; }
+
+auto PluginLoader::openLibrary(const std::string& key, const std::string& path) -> LoadedLibrary* {
+    {
+        std::scoped_lock lock(mutex_);
+        if (auto loaded = libraries_.find(key); loaded != libraries_.end()) {
+            ++loaded->second.instances;
+            return &loaded->second;
+        }
+    }
 
-    if (!createFunc_ || !destroyFunc_) {
-        unloadLibrary(currentHandle_);
-        currentHandle_ = nullptr;
+    LibraryHandle handle = loadLibrary(path);
+    if (!handle) {
+        setLastError("Failed to load " + path + ": " + getLibraryError());
         return nullptr;
     }
 
-    // Create the plugin instance
-    IPlugin* plugin = createFunc_();
-    if (!plugin) {
-        unloadLibrary(currentHandle_);
-        currentHandle_ = nullptr;
+    auto createFunc = reinterpret_cast<PalantirCreatePluginFunc>(getSymbol(handle, PALANTIR_CREATE_PLUGIN_SYMBOL));
+    if (!createFunc) {
+        setLastError(std::string("Missing ") + PALANTIR_CREATE_PLUGIN_SYMBOL + " in " + path);
+        unloadLibrary(handle);
         return nullptr;
     }
 
-    return std::unique_ptr<IPlugin>(plugin);
+    std::unique_lock lock(mutex_);
+    auto [library, inserted] = libraries_.try_emplace(key, LoadedLibrary{handle, createFunc, 0});
+    ++library->second.instances;
+    lock.unlock();
+
+    // Another thread loaded the same library meanwhile, drop the reference we just took
+    if (!inserted) {
+        unloadLibrary(handle);
+    }
+    return &library->second;
 }
 
-auto PluginLoader::unloadPlugin(IPlugin* plugin) -> void {
-    if (plugin && destroyFunc_) {
-        destroyFunc_(plugin);
+auto PluginLoader::releaseInstance(const std::string& key) -> void {
+    LibraryHandle handle = nullptr;
+    {
+        std::scoped_lock lock(mutex_);
+        auto library = libraries_.find(key);
+        if (library == libraries_.end() || --library->second.instances > 0) {
+            return;
+        }
+        handle = library->second.handle;
+        libraries_.erase(library);
     }
+    unloadLibrary(handle);
 }
 
-} // namespace palantir::plugin 
\ No newline at end of file
+auto PluginLoader::setLastError(std::string error) -> void { lastError = std::move(error); }
+
+} // namespace palantir::plugin
@@ -1,45 +1,176 @@
 #include "plugin_loader/plugin_manager.hpp"
 #include <filesystem>
 #include <algorithm>
+#include <condition_variable>
+#include <future>
+#include <iterator>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <unordered_set>
+#include "command/command_factory.hpp"
 #include "exception/exceptions.hpp"
+#include "exception/stack_trace.hpp"
+#include "plugin_loader/deferred_command.hpp"
+#include "utils/logger.hpp"
+#include "utils/startup_profiler.hpp"
+#include "utils/task_graph.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace palantir::plugin {
 
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+auto elapsedSince(Clock::time_point start) -> std::chrono::microseconds {
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+}
+
+// Plugin libraries of a directory, in path order
+auto findLibraries(const std::filesystem::path& directory, const std::vector<std::string>& extensions)
+    -> std::vector<std::filesystem::path> {
+    std::vector<std::filesystem::path> paths;
+    if (!std::filesystem::exists(directory) || !std::filesystem::is_directory(directory)) {
+        return paths;
+    }
+
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        if (!entry.is_regular_file()) {
+            continue;
+        }
+
+        const auto& path = entry.path();
+        if (std::find(extensions.begin(), extensions.end(), path.extension()) == extensions.end()) {
+            continue;
+        }
+        paths.push_back(path);
+    }
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+// No more workers than there are tasks to run
+auto workerCount(size_t threadCount, size_t taskCount) -> size_t {
+    if (threadCount == 0) {
+        threadCount = std::max(1U, std::thread::hardware_concurrency());
+    }
+    return std::max<size_t>(1, std::min(threadCount, taskCount));
+}
+
+// Called after shutdown(), creators left in the factory would call into the library once it is unloaded
+auto unregisterCommands(const IPlugin& plugin) -> void {
+    for (const auto& command : plugin.getProvidedCommands()) {
+        command::CommandFactory::getInstance()->unregisterCommand(command);
+    }
+}
+
+// Task of the plugin in the initialization graph, also the name of its span
+auto initializeTaskName(const std::string& plugin) -> std::string { return "plugin.initialize " + plugin; }
+
+} // namespace
+
+PluginManager::PluginManager(size_t threadCount) : threadCount_(threadCount) {}
+
+PluginManager::~PluginManager() {
+    watcher_.reset();
+    std::unique_ptr<utils::ThreadPool> loadPool;
+    {
+        std::scoped_lock lock(loadsMutex_);
+        loadPool = std::move(loadPool_);
+    }
+    // Runs the loads still queued, while everything they use is alive
+    loadPool.reset();
+    for (const auto& [name, deferred] : deferred_) {
+        unregisterStubs(deferred.manifest);
+    }
+    if (!shadowDirectory_.empty()) {
+        // Plugins go first so their shadow copies are not loaded anymore
+        plugins_.clear();
+        std::error_code error;
+        std::filesystem::remove_all(shadowDirectory_, error);
+    }
+}
+
 auto PluginManager::loadPlugin(const std::string& path) -> bool {
-    auto plugin = loader_.loadPlugin(path);
+    std::scoped_lock lock(mutex_);
+    const auto start = Clock::now();
+    const auto loadedFrom = resolveLibrary(path);
+    auto plugin = loader_.loadPlugin(loadedFrom.string());
     if (!plugin) {
+        PALANTIR_LOG_WARN("{}", loader_.getLastError());
         return false;
     }
+    return registerPlugin(std::move(plugin), path, loadedFrom, elapsedSince(start));
+}
 
+auto PluginManager::registerPlugin(PluginPtr plugin, const std::filesystem::path& library,
+                                   const std::filesystem::path& loadedFrom, std::chrono::microseconds loadTime) -> bool {
     std::string name = plugin->getName();
     if (plugins_.find(name) != plugins_.end()) {
-        // Plugin with this name already exists
+        // Plugin with this name already exists, the new instance is destroyed with its library
+        PALANTIR_LOG_WARN("Plugin {} is already loaded, skipping {}", name, library.string());
         return false;
     }
 
+    timings_[name] = PluginTiming{.name = name, .load = loadTime};
+    libraries_[name] = library;
+    if (loadedFrom != library) {
+        shadows_[name] = loadedFrom;
+    }
     plugins_[name] = std::move(plugin);
     return true;
 }
 
 auto PluginManager::loadPluginsFromDirectory(const std::string& directory) -> size_t {
-    size_t loadedCount = 0;
-    const std::filesystem::path dir(directory);
+    return loadLibraries(findLibraries(directory, PLUGIN_EXTENSIONS));
+}
 
-    if (!std::filesystem::exists(dir) || !std::filesystem::is_directory(dir)) {
+auto PluginManager::loadLibraries(const std::vector<std::filesystem::path>& paths) -> size_t {
+    size_t loadedCount = 0;
+    if (paths.empty()) {
         return 0;
     }
 
-    for (const auto& entry : std::filesystem::directory_iterator(dir)) {
-        if (!entry.is_regular_file()) {
-            continue;
+    struct LoadResult {
+        PluginPtr plugin;
+        std::chrono::microseconds time;
+        std::string error;
+    };
+
+    std::vector<std::filesystem::path> loadedFrom;
+    loadedFrom.reserve(paths.size());
+    {
+        // Shadow copies are numbered and tracked under mutex_, a hot reload may be copying one too
+        std::scoped_lock lock(mutex_);
+        for (const auto& path : paths) {
+            loadedFrom.push_back(resolveLibrary(path));
         }
+    }
 
-        const auto& path = entry.path();
-        if (std::find(PLUGIN_EXTENSIONS.begin(), PLUGIN_EXTENSIONS.end(), path.extension()) == PLUGIN_EXTENSIONS.end()) {
-            continue;
+    std::vector<std::future<LoadResult>> loads;
+    loads.reserve(paths.size());
+    {
+        utils::ThreadPool pool(workerCount(threadCount_, paths.size()));
+        for (const auto& path : loadedFrom) {
+            loads.push_back(pool.submit([this, path]() {
+                const auto start = Clock::now();
+                utils::ScopedSpan span([&path]() { return "plugin.load " + path.filename().string(); });
+                auto plugin = loader_.loadPlugin(path.string());
+                auto error = plugin ? std::string() : loader_.getLastError();
+                return LoadResult{std::move(plugin), elapsedSince(start), std::move(error)};
+            }));
         }
+    }
 
-        if (loadPlugin(path.string())) {
+    std::scoped_lock lock(mutex_);
+    for (size_t i = 0; i < paths.size(); ++i) {
+        auto result = loads[i].get();
+        if (!result.plugin) {
+            PALANTIR_LOG_WARN("{}", result.error);
+            continue;
+        }
+        if (registerPlugin(std::move(result.plugin), paths[i], loadedFrom[i], result.time)) {
             ++loadedCount;
         }
     }
@@ -48,23 +179,31 @@ auto PluginManager::loadPluginsFromDirectory(const std::string& directory) -> si
 }
 
 auto PluginManager::unloadPlugin(const std::string& name) -> bool {
+    std::scoped_lock lock(mutex_);
     auto it = plugins_.find(name);
     if (it == plugins_.end()) {
         return false;
     }
 
     it->second->shutdown();
-    loader_.unloadPlugin(it->second.get());
+    unregisterCommands(*it->second);
     plugins_.erase(it);
+    timings_.erase(name);
+    libraries_.erase(name);
+    removeShadow(name);
+    // Cached frames may point into the unloaded library, a later one can be mapped at the same addresses
+    exception::StackTraceResolver::getInstance().clear();
     return true;
 }
 
 auto PluginManager::getPlugin(const std::string& name) const -> IPlugin* {
+    std::scoped_lock lock(mutex_);
     auto it = plugins_.find(name);
     return (it != plugins_.end()) ? it->second.get() : nullptr;
 }
 
 auto PluginManager::getLoadedPlugins() const -> std::vector<IPlugin*> {
+    std::scoped_lock lock(mutex_);
     std::vector<IPlugin*> result;
     result.reserve(plugins_.size());
     
@@ -75,36 +214,495 @@ auto PluginManager::getLoadedPlugins() const -> std::vector<IPlugin*> {
     return result;
 }
 
+auto PluginManager::getDeferredPlugins() const -> std::vector<std::string> {
+    std::scoped_lock lock(mutex_);
+    std::vector<std::string> result;
+    result.reserve(deferred_.size());
+    for (const auto& [name, deferred] : deferred_) {
+        result.push_back(name);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
 auto PluginManager::initializeAll() -> bool {
-    bool success = true;
-    for (auto& pair : plugins_) {
-        if (!pair.second->initialize()) {
-            success = false;
+    std::scoped_lock lock(mutex_);
+    if (plugins_.empty()) {
+        return true;
+    }
+
+    for (const auto& [name, plugin] : plugins_) {
+        auto& timing = timings_[name];
+        timing.name = name;
+        timing.initialized = false;
+    }
+
+    // The graph refuses unknown dependencies and cycles, the plugins it cannot order fail here instead
+    std::unordered_set<std::string> orderable;
+    for (bool grown = true; grown;) {
+        grown = false;
+        for (const auto& [name, plugin] : plugins_) {
+            const auto dependencies = plugin->getDependencies();
+            if (!orderable.contains(name) &&
+                std::all_of(dependencies.begin(), dependencies.end(),
+                            [&orderable](const std::string& dependency) { return orderable.contains(dependency); })) {
+                orderable.insert(name);
+                grown = true;
+            }
+        }
+    }
+
+    utils::TaskGraph graph(workerCount(threadCount_, orderable.size()));
+    for (const auto& [name, plugin] : plugins_) {
+        const auto dependencies = plugin->getDependencies();
+        if (!orderable.contains(name)) {
+            for (const auto& dependency : dependencies) {
+                if (!plugins_.contains(dependency)) {
+                    PALANTIR_LOG_WARN("Plugin {} depends on {} which is not loaded", name, dependency);
+                } else if (!orderable.contains(dependency)) {
+                    PALANTIR_LOG_WARN("Plugin {} not initialized, its dependency {} is part of a cycle or misses a "
+                                      "dependency", name, dependency);
+                }
+            }
+            continue;
         }
+
+        std::vector<std::string> dependencyTasks;
+        dependencyTasks.reserve(dependencies.size());
+        std::transform(dependencies.begin(), dependencies.end(), std::back_inserter(dependencyTasks),
+                       initializeTaskName);
+        // Each task only writes the timing of its plugin, the map itself is left untouched while the graph runs
+        graph.addTask(
+            initializeTaskName(name),
+            [&name, plugin = plugin.get(), &timing = timings_[name]]() {
+                timing.initializeStart = Clock::now();
+                bool initialized = false;
+                try {
+                    initialized = plugin->initialize();
+                } catch (...) {
+                    timing.initializeEnd = Clock::now();
+                    timing.initialize = elapsedSince(timing.initializeStart);
+                    throw;
+                }
+                timing.initializeEnd = Clock::now();
+                timing.initialize = elapsedSince(timing.initializeStart);
+                if (!initialized) {
+                    throw palantir::exception::TraceablePluginInitializationException("Plugin " + name +
+                                                                                      " failed to initialize");
+                }
+                timing.initialized = true;
+            },
+            dependencyTasks);
     }
+
+    bool success = orderable.size() == plugins_.size();
+    try {
+        graph.run();
+    } catch (const palantir::exception::TraceableBaseException&) {
+        // Already logged by the graph, with the plugins skipped because of it
+        success = false;
+    } catch (const std::exception&) {
+        success = false;
+    }
+    logTimings();
     return success;
 }
 
+auto PluginManager::getTimings() const -> std::vector<PluginTiming> {
+    std::scoped_lock lock(mutex_);
+    return sortedTimings();
+}
+
+auto PluginManager::sortedTimings() const -> std::vector<PluginTiming> {
+    std::vector<PluginTiming> result;
+    result.reserve(timings_.size());
+    for (const auto& [name, timing] : timings_) {
+        result.push_back(timing);
+    }
+    std::sort(result.begin(), result.end(),
+              [](const PluginTiming& lhs, const PluginTiming& rhs) { return lhs.name < rhs.name; });
+    return result;
+}
+
+auto PluginManager::logTimings() const -> void {
+    for (const auto& timing : sortedTimings()) {
+        PALANTIR_LOG_INFO("Plugin {}: loaded in {}us, {} in {}us", timing.name, timing.load.count(),
+                          timing.initialized ? "initialized" : "failed to initialize", timing.initialize.count());
+    }
+}
+
 auto PluginManager::setupFromDirectory(const std::filesystem::path& pluginsDir) -> bool {
-        // Load all plugins from the plugins directory
-        if (std::filesystem::exists(pluginsDir)) {
-            size_t loadedCount = this->loadPluginsFromDirectory(pluginsDir.string());
-            
-            // Initialize all loaded plugins
-            if (!this->initializeAll()) {
-                throw palantir::exception::TraceablePluginInitializationException("Some plugins failed to initialize");
+    if (!std::filesystem::exists(pluginsDir)) {
+        throw palantir::exception::TraceableResourceLoadingException("Plugins directory not found: " + pluginsDir.string());
+    }
+
+    // Plugins with a current manifest listing commands wait for one of them to run
+    std::vector<std::filesystem::path> libraries;
+    std::vector<std::filesystem::path> undescribed;
+    {
+        utils::ScopedSpan span("plugins.manifests");
+        for (const auto& library : findLibraries(pluginsDir, PLUGIN_EXTENSIONS)) {
+            auto manifest = PluginManifest::load(library);
+            if (!manifest || !manifest->matches(library)) {
+                undescribed.push_back(library);
+                libraries.push_back(library);
+            } else if (manifest->commands.empty()) {
+                libraries.push_back(library);
+            } else {
+                deferPlugin(library, std::move(*manifest));
             }
+        }
+    }
+
+    {
+        utils::ScopedSpan span("plugins.load");
+        loadLibraries(libraries);
+        loadDeferredDependencies();
+    }
+
+    {
+        utils::ScopedSpan span("plugins.initialize");
+        if (!initializeAll()) {
+            throw palantir::exception::TraceablePluginInitializationException("Some plugins failed to initialize");
+        }
+    }
+
+    {
+        utils::ScopedSpan span("plugins.describe");
+        writeManifests(undescribed);
+    }
+
+    if (rebind_) {
+        watcher_ = std::make_unique<PluginWatcher>(pluginsDir, PLUGIN_EXTENSIONS,
+                                                   [this](const std::filesystem::path& library) { onLibraryChanged(library); });
+        watcher_->start();
+    }
+    return true;
+}
+
+auto PluginManager::loadDeferredPlugin(const std::string& name) -> bool {
+    std::scoped_lock lock(mutex_);
+    return loadDeferred(name);
+}
+
+auto PluginManager::loadDeferredPluginAsync(const std::string& name, DeferredCommand::LoadedFunc onLoaded) -> void {
+    std::scoped_lock lock(loadsMutex_);
+    if (!loadPool_) {
+        loadPool_ = std::make_unique<utils::ThreadPool>(1);
+    }
+    ++pendingLoads_;
+    loadPool_->submit([this, name, onLoaded = std::move(onLoaded)]() mutable {
+        {
+            // Released before the load is counted as done, the callback may hold a command of the plugin
+            auto callback = std::move(onLoaded);
+            const bool loaded = loadDeferredPlugin(name);
+            std::shared_ptr<UiDispatcher> dispatcher;
+            {
+                std::scoped_lock lock(loadsMutex_);
+                dispatcher = uiDispatcher_;
+            }
+            if (dispatcher) {
+                dispatcher->post([callback = std::move(callback), loaded]() { callback(loaded); });
+            } else {
+                try {
+                    callback(loaded);
+                } catch (const exception::TraceableBaseException& e) {
+                    PALANTIR_LOG_ERROR("Command of plugin {} failed: {}", name, e.what());
+                } catch (const std::exception& e) {
+                    PALANTIR_LOG_ERROR("Command of plugin {} failed: {}", name, e.what());
+                }
+            }
+        }
+        std::scoped_lock lock(loadsMutex_);
+        --pendingLoads_;
+        loadsDone_.notify_all();
+    });
+}
+
+auto PluginManager::waitForDeferredLoads() -> void {
+    std::unique_lock lock(loadsMutex_);
+    loadsDone_.wait(lock, [this]() { return pendingLoads_ == 0; });
+}
+
+auto PluginManager::setUiDispatcher(std::shared_ptr<UiDispatcher> dispatcher) -> void {
+    std::scoped_lock lock(loadsMutex_);
+    uiDispatcher_ = std::move(dispatcher);
+}
+
+auto PluginManager::deferPlugin(const std::filesystem::path& library, PluginManifest manifest) -> void {
+    std::scoped_lock lock(mutex_);
+    if (plugins_.contains(manifest.name) || deferred_.contains(manifest.name)) {
+        PALANTIR_LOG_WARN("Plugin {} is already loaded, skipping {}", manifest.name, library.string());
+        return;
+    }
+
+    registerStubs(manifest);
+    auto name = manifest.name;
+    deferred_.emplace(std::move(name), DeferredPlugin{library, std::move(manifest)});
+}
+
+auto PluginManager::loadDeferredDependencies() -> void {
+    std::scoped_lock lock(mutex_);
+    // Plugins loaded at startup get their deferred dependencies loaded too, and so on
+    std::vector<std::string> pending;
+    for (const auto& [name, plugin] : plugins_) {
+        auto dependencies = plugin->getDependencies();
+        pending.insert(pending.end(), dependencies.begin(), dependencies.end());
+    }
+
+    while (!pending.empty()) {
+        auto name = std::move(pending.back());
+        pending.pop_back();
+
+        auto it = deferred_.find(name);
+        if (it == deferred_.end()) {
+            continue;
+        }
+        auto deferred = std::move(it->second);
+        deferred_.erase(it);
+        unregisterStubs(deferred.manifest);
+
+        const auto start = Clock::now();
+        const auto loadedFrom = resolveLibrary(deferred.library);
+        auto plugin = loader_.loadPlugin(loadedFrom.string());
+        if (!plugin) {
+            PALANTIR_LOG_WARN("{}", loader_.getLastError());
+            restoreDeferred(std::move(name), std::move(deferred));
+            continue;
+        }
+        auto dependencies = plugin->getDependencies();
+        if (registerPlugin(std::move(plugin), deferred.library, loadedFrom, elapsedSince(start))) {
+            pending.insert(pending.end(), dependencies.begin(), dependencies.end());
         } else {
-            throw palantir::exception::TraceableResourceLoadingException("Plugins directory not found: " + pluginsDir.string());
+            restoreDeferred(std::move(name), std::move(deferred));
         }
+    }
+}
+
+auto PluginManager::loadDeferred(const std::string& name) -> bool {
+    if (plugins_.contains(name)) {
         return true;
+    }
+    auto it = deferred_.find(name);
+    if (it == deferred_.end()) {
+        return false;
+    }
+
+    // Taken out while loading, so a dependency cycle does not come back to it. A failed load puts it back
+    auto deferred = std::move(it->second);
+    deferred_.erase(it);
+    unregisterStubs(deferred.manifest);
+
+    for (const auto& dependency : deferred.manifest.dependencies) {
+        if (!loadDeferred(dependency)) {
+            PALANTIR_LOG_WARN("Plugin {} not loaded, its dependency {} is not available", name, dependency);
+            restoreDeferred(name, std::move(deferred));
+            return false;
+        }
+    }
+
+    const auto start = Clock::now();
+    const auto loadedFrom = resolveLibrary(deferred.library);
+    auto plugin = loader_.loadPlugin(loadedFrom.string());
+    if (!plugin) {
+        PALANTIR_LOG_WARN("{}", loader_.getLastError());
+        restoreDeferred(name, std::move(deferred));
+        return false;
+    }
+    const auto pluginName = plugin->getName();
+    if (!registerPlugin(std::move(plugin), deferred.library, loadedFrom, elapsedSince(start))) {
+        restoreDeferred(name, std::move(deferred));
+        return false;
+    }
+
+    auto& timing = timings_[pluginName];
+    timing.initializeStart = Clock::now();
+    timing.initialized = plugins_[pluginName]->initialize();
+    timing.initializeEnd = Clock::now();
+    timing.initialize = std::chrono::duration_cast<std::chrono::microseconds>(timing.initializeEnd - timing.initializeStart);
+    PALANTIR_LOG_INFO("Plugin {}: loaded on demand in {}us, {} in {}us", pluginName, timing.load.count(),
+                      timing.initialized ? "initialized" : "failed to initialize", timing.initialize.count());
+
+    if (!timing.initialized) {
+        plugins_.erase(pluginName);
+        timings_.erase(pluginName);
+        libraries_.erase(pluginName);
+        removeShadow(pluginName);
+        restoreDeferred(name, std::move(deferred));
+        return false;
+    }
+    return true;
+}
+
+auto PluginManager::restoreDeferred(std::string name, DeferredPlugin deferred) -> void {
+    // The next execution of one of its commands tries again, with whichever build is there then
+    registerStubs(deferred.manifest);
+    deferred_.insert_or_assign(std::move(name), std::move(deferred));
+}
+
+auto PluginManager::registerStubs(const PluginManifest& manifest) -> void {
+    for (const auto& command : manifest.commands) {
+        command::CommandFactory::getInstance()->registerCommand(
+            command.name, [this, plugin = manifest.name, name = command.name, debounce = command.debounce]() {
+                return std::make_unique<DeferredCommand>(
+                    name, debounce, [this, plugin](DeferredCommand::LoadedFunc onLoaded) {
+                        loadDeferredPluginAsync(plugin, std::move(onLoaded));
+                    });
+            });
+    }
+}
+
+auto PluginManager::unregisterStubs(const PluginManifest& manifest) -> void {
+    for (const auto& command : manifest.commands) {
+        command::CommandFactory::getInstance()->unregisterCommand(command.name);
+    }
+}
+
+auto PluginManager::writeManifests(const std::vector<std::filesystem::path>& libraries) -> void {
+    std::scoped_lock lock(mutex_);
+    for (const auto& [name, plugin] : plugins_) {
+        const auto& library = libraries_[name];
+        if (std::find(libraries.begin(), libraries.end(), library) == libraries.end() ||
+            plugin->getProvidedCommands().empty()) {
+            continue;
+        }
+        if (!PluginManifest::describe(*plugin, library).save(library)) {
+            PALANTIR_LOG_WARN("Could not write the manifest of plugin {} next to {}", name, library.string());
+        }
+    }
 }
 
 auto PluginManager::shutdownAll() -> void {
+    watcher_.reset();
+    waitForDeferredLoads();
+    std::scoped_lock lock(mutex_);
     for (auto& pair : plugins_) {
         pair.second->shutdown();
-        loader_.unloadPlugin(pair.second.get());
+        unregisterCommands(*pair.second);
+    }
+    plugins_.clear();
+    exception::StackTraceResolver::getInstance().clear();
+    timings_.clear();
+    libraries_.clear();
+    for (const auto& [name, shadow] : shadows_) {
+        std::error_code error;
+        std::filesystem::remove(shadow, error);
+    }
+    shadows_.clear();
+    for (const auto& [name, deferred] : deferred_) {
+        unregisterStubs(deferred.manifest);
+    }
+    deferred_.clear();
+}
+
+auto PluginManager::enableHotReload(RebindFunc rebind) -> void {
+    std::scoped_lock lock(mutex_);
+    rebind_ = std::move(rebind);
+    if (shadowDirectory_.empty()) {
+        shadowDirectory_ = std::filesystem::temp_directory_path() /
+                           ("palantir-plugins-" + std::to_string(Clock::now().time_since_epoch().count()));
+    }
+}
+
+auto PluginManager::reloadPlugin(const std::string& name) -> bool {
+    // A load on first use may still be initializing a plugin, or hold a command of the one swapped here
+    waitForDeferredLoads();
+
+    PluginPtr previous;
+    std::filesystem::path previousShadow;
+    std::filesystem::path library;
+    PluginManifest manifest;
+    {
+        std::scoped_lock lock(mutex_);
+        auto it = plugins_.find(name);
+        if (it == plugins_.end()) {
+            return false;
+        }
+        if (!rebind_ || it->second->getProvidedCommands().empty()) {
+            PALANTIR_LOG_WARN("Plugin {} cannot be reloaded, commands created from it could not be rebound", name);
+            return false;
+        }
+
+        // Park the commands on stubs while the library is swapped
+        library = libraries_[name];
+        manifest = PluginManifest::describe(*it->second, library);
+        it->second->shutdown();
+        previous = std::move(it->second);
+        plugins_.erase(it);
+        timings_.erase(name);
+        libraries_.erase(name);
+        if (auto shadow = shadows_.find(name); shadow != shadows_.end()) {
+            previousShadow = shadow->second;
+            shadows_.erase(shadow);
+        }
+        registerStubs(manifest);
+        deferred_.emplace(name, DeferredPlugin{library, manifest});
+    }
+
+    // Once rebound, no signal holds a command of the previous build, nor runs one
+    rebind_();
+    previous.reset();
+    exception::StackTraceResolver::getInstance().clear();
+    if (!previousShadow.empty()) {
+        std::error_code error;
+        std::filesystem::remove(previousShadow, error);
+    }
+    {
+        // Destroying the previous plugin may have unregistered its commands again, stubs included
+        std::scoped_lock lock(mutex_);
+        if (deferred_.contains(name)) {
+            registerStubs(manifest);
+        }
+    }
+
+    // A failed load keeps the commands on stubs
+    const bool loaded = loadDeferredPlugin(name);
+    rebind_();
+    PALANTIR_LOG_INFO("Plugin {} {}", name, loaded ? "reloaded" : "failed to reload");
+    return loaded;
+}
+
+auto PluginManager::onLibraryChanged(const std::filesystem::path& library) -> void {
+    std::string name;
+    {
+        std::scoped_lock lock(mutex_);
+        auto it = std::find_if(libraries_.begin(), libraries_.end(),
+                               [&library](const auto& entry) { return entry.second == library; });
+        if (it == libraries_.end()) {
+            // Deferred plugins load whatever build is there when first used
+            return;
+        }
+        name = it->first;
+    }
+    PALANTIR_LOG_INFO("Plugin {} changed on disk, reloading", name);
+    reloadPlugin(name);
+}
+
+auto PluginManager::resolveLibrary(const std::filesystem::path& library) -> std::filesystem::path {
+    if (shadowDirectory_.empty()) {
+        return library;
+    }
+
+    // Loading a copy leaves the library free to be rebuilt, and a new copy is never mistaken for a loaded one
+    auto shadow = shadowDirectory_ / (library.stem().string() + "-" + std::to_string(++shadowGeneration_) +
+                                      library.extension().string());
+    std::error_code error;
+    std::filesystem::create_directories(shadowDirectory_, error);
+    if (!std::filesystem::copy_file(library, shadow, std::filesystem::copy_options::overwrite_existing, error)) {
+        PALANTIR_LOG_WARN("Cannot copy {} for hot reload, loading it in place: {}", library.string(), error.message());
+        return library;
+    }
+    return shadow;
+}
+
+auto PluginManager::removeShadow(const std::string& name) -> void {
+    auto shadow = shadows_.find(name);
+    if (shadow == shadows_.end()) {
+        return;
     }
+    std::error_code error;
+    std::filesystem::remove(shadow->second, error);
+    shadows_.erase(shadow);
 }
 
-} // namespace palantir::plugin 
\ No newline at end of file
+} // namespace palantir::plugin
@@ -0,0 +1,103 @@
+#include "plugin_loader/plugin_manifest.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <system_error>
+
+namespace palantir::plugin {
+
+namespace {
+
+struct LibraryStamp {
+    std::uintmax_t size;
+    std::int64_t writeTime;
+};
+
+auto stampOf(const std::filesystem::path& library) -> std::optional<LibraryStamp> {
+    std::error_code error;
+    const auto size = std::filesystem::file_size(library, error);
+    if (error) {
+        return std::nullopt;
+    }
+    const auto writeTime = std::filesystem::last_write_time(library, error);
+    if (error) {
+        return std::nullopt;
+    }
+    return LibraryStamp{size, static_cast<std::int64_t>(writeTime.time_since_epoch().count())};
+}
+
+} // namespace
+
+auto PluginManifest::getPath(const std::filesystem::path& library) -> std::filesystem::path {
+    auto path = library;
+    path.replace_filename(library.stem().string() + ".plugin.json");
+    return path;
+}
+
+auto PluginManifest::load(const std::filesystem::path& library) -> std::optional<PluginManifest> {
+    std::ifstream file(getPath(library));
+    if (!file) {
+        return std::nullopt;
+    }
+
+    auto json = nlohmann::json::parse(file, nullptr, false);
+    if (json.is_discarded() || !json.is_object() || !json.contains("name") || !json["name"].is_string()) {
+        return std::nullopt;
+    }
+
+    try {
+        PluginManifest manifest;
+        manifest.name = json["name"].get<std::string>();
+        manifest.version = json.value("version", "");
+        manifest.dependencies = json.value("dependencies", std::vector<std::string>{});
+        for (const auto& command : json.value("commands", nlohmann::json::array())) {
+            manifest.commands.push_back({command.at("name").get<std::string>(), command.value("debounce", false)});
+        }
+        if (json.contains("library")) {
+            manifest.librarySize = json["library"].at("size").get<std::uintmax_t>();
+            manifest.libraryWriteTime = json["library"].at("writeTime").get<std::int64_t>();
+        }
+        return manifest;
+    } catch (const nlohmann::json::exception&) {
+        return std::nullopt;
+    }
+}
+
+auto PluginManifest::describe(const IPlugin& plugin, const std::filesystem::path& library) -> PluginManifest {
+    PluginManifest manifest{plugin.getName(), plugin.getVersion(), plugin.getDependencies(), {}, {}, {}};
+    const auto debounced = plugin.getDebouncedCommands();
+    for (const auto& name : plugin.getProvidedCommands()) {
+        manifest.commands.push_back({name, std::find(debounced.begin(), debounced.end(), name) != debounced.end()});
+    }
+    if (auto stamp = stampOf(library)) {
+        manifest.librarySize = stamp->size;
+        manifest.libraryWriteTime = stamp->writeTime;
+    }
+    return manifest;
+}
+
+auto PluginManifest::save(const std::filesystem::path& library) const -> bool {
+    nlohmann::json json{{"name", name}, {"version", version}, {"dependencies", dependencies}};
+    json["commands"] = nlohmann::json::array();
+    for (const auto& command : commands) {
+        json["commands"].push_back({{"name", command.name}, {"debounce", command.debounce}});
+    }
+    if (librarySize && libraryWriteTime) {
+        json["library"] = {{"size", *librarySize}, {"writeTime", *libraryWriteTime}};
+    }
+
+    std::ofstream file(getPath(library), std::ios::trunc);
+    file << json.dump(4);
+    return static_cast<bool>(file);
+}
+
+auto PluginManifest::matches(const std::filesystem::path& library) const -> bool {
+    if (!librarySize || !libraryWriteTime) {
+        return true;
+    }
+    auto stamp = stampOf(library);
+    return stamp && stamp->size == *librarySize && stamp->writeTime == *libraryWriteTime;
+}
+
+} // namespace palantir::plugin
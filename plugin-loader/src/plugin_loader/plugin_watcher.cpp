@@ -0,0 +1,71 @@
+#include "plugin_loader/plugin_watcher.hpp"
+
+#include <algorithm>
+#include "utils/logger.hpp"
+
+namespace palantir::plugin {
+
+PluginWatcher::PluginWatcher(std::filesystem::path directory, std::vector<std::string> extensions,
+                             ChangeCallback onChange)
+    : directory_(std::move(directory)), extensions_(std::move(extensions)), onChange_(std::move(onChange)) {}
+
+PluginWatcher::~PluginWatcher() { stop(); }
+
+auto PluginWatcher::start() -> bool {
+    if (running_) {
+        return true;
+    }
+    if (!openWatch()) {
+        PALANTIR_LOG_WARN("Cannot watch plugin directory {}", directory_.string());
+        return false;
+    }
+    running_ = true;
+    thread_ = std::thread([this]() { run(); });
+    return true;
+}
+
+auto PluginWatcher::stop() -> void {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    closeWatch();
+}
+
+auto PluginWatcher::isRunning() const -> bool { return running_; }
+
+auto PluginWatcher::run() -> void {
+    using Clock = std::chrono::steady_clock;
+    // Libraries changed lately, with the time of their last change
+    std::unordered_map<std::string, Clock::time_point> pending;
+
+    while (running_) {
+        for (const auto& path : waitForChanges(POLL_INTERVAL)) {
+            if (std::find(extensions_.begin(), extensions_.end(), path.extension()) != extensions_.end()) {
+                pending[path.string()] = Clock::now();
+            }
+        }
+
+        const auto now = Clock::now();
+        for (auto it = pending.begin(); it != pending.end() && running_;) {
+            if (now - it->second < SETTLE_TIME) {
+                ++it;
+                continue;
+            }
+            const std::filesystem::path library(it->first);
+            it = pending.erase(it);
+            if (!std::filesystem::exists(library)) {
+                continue;
+            }
+            try {
+                onChange_(library);
+            } catch (const std::exception& e) {
+                PALANTIR_LOG_ERROR("Failed to handle the change of {}: {}", library.string(), e.what());
+            }
+        }
+    }
+}
+
+} // namespace palantir::plugin
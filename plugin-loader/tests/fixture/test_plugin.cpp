@@ -0,0 +1,53 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "plugin/iplugin.hpp"
+#include "plugin/plugin_abi.hpp"
+#ifdef TEST_PLUGIN_COMMAND
+#include "command/icommand.hpp"
+#endif
+
+// Minimal plugin built once per library, named by TEST_PLUGIN_NAME, optionally depending on
+// TEST_PLUGIN_DEPENDENCY and registering the command TEST_PLUGIN_COMMAND
+#ifdef TEST_PLUGIN_COMMAND
+class TestCommand : public palantir::command::ICommand {
+public:
+    auto execute() const -> void override {}
+    [[nodiscard]] auto useDebounce() const -> bool override { return true; }
+};
+#endif
+
+class TestPlugin : public palantir::plugin::IPlugin {
+public:
+    explicit TestPlugin(palantir::plugin::abi::Host host) : host_(host) {}
+    // Like CommandsPlugin, unregisters its command again when destroyed
+    ~TestPlugin() override { TestPlugin::shutdown(); }
+
+    auto initialize() -> bool override {
+#ifdef TEST_PLUGIN_COMMAND
+        return host_.registerCommand(TEST_PLUGIN_COMMAND, []() { return std::make_unique<TestCommand>(); });
+#else
+        return true;
+#endif
+    }
+    auto shutdown() -> void override {
+#ifdef TEST_PLUGIN_COMMAND
+        host_.unregisterCommand(TEST_PLUGIN_COMMAND);
+#endif
+    }
+    [[nodiscard]] auto getName() const -> std::string override { return TEST_PLUGIN_NAME; }
+    [[nodiscard]] auto getVersion() const -> std::string override { return "1.0.0"; }
+#ifdef TEST_PLUGIN_DEPENDENCY
+    [[nodiscard]] auto getDependencies() const -> std::vector<std::string> override { return {TEST_PLUGIN_DEPENDENCY}; }
+#endif
+#ifdef TEST_PLUGIN_COMMAND
+    [[nodiscard]] auto getProvidedCommands() const -> std::vector<std::string> override { return {TEST_PLUGIN_COMMAND}; }
+    [[nodiscard]] auto getDebouncedCommands() const -> std::vector<std::string> override { return {TEST_PLUGIN_COMMAND}; }
+#endif
+
+private:
+    palantir::plugin::abi::Host host_;
+};
+
+IMPLEMENT_PLUGIN(TestPlugin)
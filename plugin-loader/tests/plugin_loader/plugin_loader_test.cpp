@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "plugin_loader/plugin_loader.hpp"
+#include "plugin_loader/plugin_manager.hpp"
+
+using namespace palantir::plugin;
+
+class PluginLoaderTest : public ::testing::Test {
+protected:
+    PluginLoader loader;
+};
+
+TEST_F(PluginLoaderTest, LoadPlugin_TwoLibraries_KeepsBothLoaded) {
+    auto alpha = loader.loadPlugin(TEST_PLUGIN_ALPHA_PATH);
+    auto beta = loader.loadPlugin(TEST_PLUGIN_BETA_PATH);
+
+    ASSERT_NE(alpha, nullptr);
+    ASSERT_NE(beta, nullptr);
+    EXPECT_EQ(alpha->getName(), "alpha");
+    EXPECT_EQ(beta->getName(), "beta");
+    EXPECT_EQ(loader.getLoadedLibraryCount(), 2U);
+}
+
+TEST_F(PluginLoaderTest, LoadPlugin_SameLibraryTwice_SharesHandle) {
+    auto first = loader.loadPlugin(TEST_PLUGIN_ALPHA_PATH);
+    auto second = loader.loadPlugin(TEST_PLUGIN_ALPHA_PATH);
+
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(loader.getLoadedLibraryCount(), 1U);
+
+    first.reset();
+    EXPECT_TRUE(loader.isLoaded(TEST_PLUGIN_ALPHA_PATH));
+    second.reset();
+    EXPECT_FALSE(loader.isLoaded(TEST_PLUGIN_ALPHA_PATH));
+}
+
+TEST_F(PluginLoaderTest, UnloadPlugin_UsesItsOwnLibrary) {
+    auto alpha = loader.loadPlugin(TEST_PLUGIN_ALPHA_PATH);
+    auto beta = loader.loadPlugin(TEST_PLUGIN_BETA_PATH);
+
+    alpha.reset();
+
+    EXPECT_FALSE(loader.isLoaded(TEST_PLUGIN_ALPHA_PATH));
+    EXPECT_TRUE(loader.isLoaded(TEST_PLUGIN_BETA_PATH));
+    EXPECT_EQ(beta->getName(), "beta");
+}
+
+TEST_F(PluginLoaderTest, LoadPlugin_MissingLibrary_ReturnsNullWithError) {
+    auto plugin = loader.loadPlugin("does-not-exist.plugin");
+
+    EXPECT_EQ(plugin, nullptr);
+    EXPECT_FALSE(loader.getLastError().empty());
+    EXPECT_EQ(loader.getLoadedLibraryCount(), 0U);
+}
+
+TEST(PluginManagerTest, LoadPlugin_TwoLibraries_BothAvailable) {
+    PluginManager manager;
+
+    EXPECT_TRUE(manager.loadPlugin(TEST_PLUGIN_ALPHA_PATH));
+    EXPECT_TRUE(manager.loadPlugin(TEST_PLUGIN_BETA_PATH));
+    EXPECT_FALSE(manager.loadPlugin(TEST_PLUGIN_ALPHA_PATH));
+
+    EXPECT_NE(manager.getPlugin("alpha"), nullptr);
+    EXPECT_NE(manager.getPlugin("beta"), nullptr);
+    EXPECT_TRUE(manager.initializeAll());
+
+    EXPECT_TRUE(manager.unloadPlugin("alpha"));
+    EXPECT_EQ(manager.getPlugin("alpha"), nullptr);
+    manager.shutdownAll();
+    EXPECT_TRUE(manager.getLoadedPlugins().empty());
+}
+
+TEST(PluginManagerTest, InitializeAll_Dependency_InitializedAfterIt) {
+    PluginManager manager(4);
+    ASSERT_TRUE(manager.loadPlugin(TEST_PLUGIN_BETA_PATH));
+    ASSERT_TRUE(manager.loadPlugin(TEST_PLUGIN_ALPHA_PATH));
+
+    EXPECT_TRUE(manager.initializeAll());
+
+    auto timings = manager.getTimings();
+    ASSERT_EQ(timings.size(), 2U);
+    EXPECT_EQ(timings[0].name, "alpha");
+    EXPECT_EQ(timings[1].name, "beta");
+    EXPECT_TRUE(timings[0].initialized);
+    EXPECT_TRUE(timings[1].initialized);
+    EXPECT_GE(timings[1].initializeStart, timings[0].initializeEnd);
+    manager.shutdownAll();
+}
+
+TEST(PluginManagerTest, LoadPluginsFromDirectory_MissingDependency_OnlyDependentFails) {
+    PluginManager manager(4);
+
+    EXPECT_EQ(manager.loadPluginsFromDirectory(TEST_PLUGIN_DIRECTORY), 3U);
+    EXPECT_FALSE(manager.initializeAll());
+
+    auto timings = manager.getTimings();
+    ASSERT_EQ(timings.size(), 3U);
+    EXPECT_TRUE(timings[0].initialized);
+    EXPECT_TRUE(timings[1].initialized);
+    EXPECT_EQ(timings[2].name, "gamma");
+    EXPECT_FALSE(timings[2].initialized);
+    manager.shutdownAll();
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "command/command_factory.hpp"
+#include "command/icommand.hpp"
+#include "plugin_loader/plugin_manager.hpp"
+#include "plugin_loader/plugin_manifest.hpp"
+#include "ui_dispatcher.hpp"
+
+using namespace palantir::plugin;
+
+// Each test works on its own copy of the epsilon plugin, manifests are written next to it
+class PluginManifestTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory = std::filesystem::temp_directory_path() /
+                    ("palantir-" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        library = directory / std::filesystem::path(TEST_PLUGIN_EPSILON_PATH).filename();
+        std::filesystem::copy_file(TEST_PLUGIN_EPSILON_PATH, library);
+    }
+
+    void TearDown() override {
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+    std::filesystem::path directory;
+    std::filesystem::path library;
+};
+
+TEST_F(PluginManifestTest, Save_ThenLoad_RoundTrips) {
+    PluginManifest manifest{"epsilon", "1.0.0", {"alpha"}, {{"epsilon-command", true}}, 12, 34};
+
+    ASSERT_TRUE(manifest.save(library));
+    auto loaded = PluginManifest::load(library);
+
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->name, "epsilon");
+    EXPECT_EQ(loaded->dependencies, std::vector<std::string>{"alpha"});
+    ASSERT_EQ(loaded->commands.size(), 1U);
+    EXPECT_EQ(loaded->commands[0].name, "epsilon-command");
+    EXPECT_TRUE(loaded->commands[0].debounce);
+    EXPECT_FALSE(loaded->matches(library));
+}
+
+TEST_F(PluginManifestTest, SetupFromDirectory_NoManifest_LoadsPluginAndWritesManifest) {
+    PluginManager manager;
+
+    EXPECT_TRUE(manager.setupFromDirectory(directory));
+
+    EXPECT_NE(manager.getPlugin("epsilon"), nullptr);
+    auto manifest = PluginManifest::load(library);
+    ASSERT_TRUE(manifest.has_value());
+    EXPECT_TRUE(manifest->matches(library));
+    ASSERT_EQ(manifest->commands.size(), 1U);
+    EXPECT_EQ(manifest->commands[0].name, "epsilon-command");
+    EXPECT_TRUE(manifest->commands[0].debounce);
+    manager.shutdownAll();
+}
+
+TEST_F(PluginManifestTest, SetupFromDirectory_CurrentManifest_LoadsPluginOnFirstExecution) {
+    {
+        PluginManager first;
+        first.setupFromDirectory(directory);
+        first.shutdownAll();
+    }
+    PluginManager manager;
+
+    EXPECT_TRUE(manager.setupFromDirectory(directory));
+    EXPECT_EQ(manager.getPlugin("epsilon"), nullptr);
+    EXPECT_EQ(manager.getDeferredPlugins(), std::vector<std::string>{"epsilon"});
+
+    auto command = palantir::command::CommandFactory::getInstance()->getCommand("epsilon-command");
+    ASSERT_NE(command, nullptr);
+    EXPECT_TRUE(command->useDebounce());
+    EXPECT_EQ(manager.getPlugin("epsilon"), nullptr);
+
+    command->execute();
+    manager.waitForDeferredLoads();
+    EXPECT_NE(manager.getPlugin("epsilon"), nullptr);
+    EXPECT_TRUE(manager.getDeferredPlugins().empty());
+
+    // The real command comes from the plugin library
+    command.reset();
+    manager.shutdownAll();
+}
+
+TEST_F(PluginManifestTest, Execute_DeferredCommandWithUiDispatcher_RunsRealCommandThroughIt) {
+    {
+        PluginManager first;
+        first.setupFromDirectory(directory);
+        first.shutdownAll();
+    }
+    auto dispatcher = std::make_shared<palantir::UiDispatcher>();
+    PluginManager manager;
+    manager.setUiDispatcher(dispatcher);
+    ASSERT_TRUE(manager.setupFromDirectory(directory));
+    auto command = palantir::command::CommandFactory::getInstance()->getCommand("epsilon-command");
+    ASSERT_NE(command, nullptr);
+
+    command->execute();
+    manager.waitForDeferredLoads();
+
+    EXPECT_NE(manager.getPlugin("epsilon"), nullptr);
+    EXPECT_EQ(dispatcher->getStats().pending, 1U);
+    EXPECT_EQ(dispatcher->drain(), 1U);
+    EXPECT_EQ(dispatcher->getStats().failed, 0U);
+
+    command.reset();
+    manager.shutdownAll();
+}
+
+TEST_F(PluginManifestTest, LoadDeferredPlugin_MissingDependency_KeepsPluginDeferredWithItsStubs) {
+    {
+        PluginManager first;
+        first.setupFromDirectory(directory);
+        first.shutdownAll();
+    }
+    auto manifest = PluginManifest::load(library);
+    ASSERT_TRUE(manifest.has_value());
+    manifest->dependencies = {"missing"};
+    ASSERT_TRUE(manifest->save(library));
+    PluginManager manager;
+    ASSERT_TRUE(manager.setupFromDirectory(directory));
+
+    EXPECT_FALSE(manager.loadDeferredPlugin("epsilon"));
+
+    EXPECT_EQ(manager.getPlugin("epsilon"), nullptr);
+    EXPECT_EQ(manager.getDeferredPlugins(), std::vector<std::string>{"epsilon"});
+    EXPECT_NE(palantir::command::CommandFactory::getInstance()->getCommand("epsilon-command"), nullptr);
+    manager.shutdownAll();
+}
+
+TEST_F(PluginManifestTest, SetupFromDirectory_OutdatedManifest_LoadsPluginAtStartup) {
+    PluginManifest{"epsilon", "0.9.0", {}, {{"epsilon-command", false}}, 1, 0}.save(library);
+    PluginManager manager;
+
+    EXPECT_TRUE(manager.setupFromDirectory(directory));
+
+    EXPECT_NE(manager.getPlugin("epsilon"), nullptr);
+    auto manifest = PluginManifest::load(library);
+    ASSERT_TRUE(manifest.has_value());
+    EXPECT_EQ(manifest->version, "1.0.0");
+    EXPECT_TRUE(manifest->matches(library));
+    manager.shutdownAll();
+}
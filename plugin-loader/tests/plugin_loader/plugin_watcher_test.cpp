@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "command/command_factory.hpp"
+#include "command/icommand.hpp"
+#include "plugin_loader/plugin_manager.hpp"
+#include "plugin_loader/plugin_watcher.hpp"
+
+using namespace palantir::plugin;
+using namespace std::chrono_literals;
+
+// Each test watches a directory of its own holding a copy of the epsilon plugin
+class PluginWatcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        directory = std::filesystem::temp_directory_path() /
+                    ("palantir-" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        library = directory / std::filesystem::path(TEST_PLUGIN_EPSILON_PATH).filename();
+        std::filesystem::copy_file(TEST_PLUGIN_EPSILON_PATH, library);
+    }
+
+    void TearDown() override {
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+    auto rebuildLibrary() const -> void {
+        std::filesystem::copy_file(TEST_PLUGIN_EPSILON_PATH, library, std::filesystem::copy_options::overwrite_existing);
+        std::filesystem::last_write_time(library, std::filesystem::file_time_type::clock::now());
+    }
+
+    std::filesystem::path directory;
+    std::filesystem::path library;
+};
+
+TEST_F(PluginWatcherTest, Start_LibraryRewritten_ReportsItOnce) {
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<std::filesystem::path> reports;
+    PluginWatcher watcher(directory, PluginManager::PLUGIN_EXTENSIONS, [&](const std::filesystem::path& path) {
+        std::scoped_lock lock(mutex);
+        reports.push_back(path);
+        changed.notify_all();
+    });
+    ASSERT_TRUE(watcher.start());
+
+    std::ofstream(directory / "notes.txt") << "not a plugin";
+    rebuildLibrary();
+    rebuildLibrary();
+
+    std::unique_lock lock(mutex);
+    ASSERT_TRUE(changed.wait_for(lock, 5s, [&]() { return !reports.empty(); }));
+    lock.unlock();
+    std::this_thread::sleep_for(PluginWatcher::SETTLE_TIME * 2);
+    lock.lock();
+    ASSERT_EQ(reports.size(), 1U);
+    EXPECT_EQ(reports[0], library);
+    lock.unlock();
+
+    watcher.stop();
+    EXPECT_FALSE(watcher.isRunning());
+}
+
+TEST_F(PluginWatcherTest, ReloadPlugin_CommandPlugin_RebindsAroundNewBuild) {
+    PluginManager manager;
+    int rebinds = 0;
+    manager.enableHotReload([&rebinds]() { ++rebinds; });
+    ASSERT_TRUE(manager.setupFromDirectory(directory));
+    ASSERT_NE(manager.getPlugin("epsilon"), nullptr);
+
+    EXPECT_TRUE(manager.reloadPlugin("epsilon"));
+
+    EXPECT_EQ(rebinds, 2);
+    EXPECT_NE(manager.getPlugin("epsilon"), nullptr);
+    EXPECT_TRUE(manager.getDeferredPlugins().empty());
+    auto command = palantir::command::CommandFactory::getInstance()->getCommand("epsilon-command");
+    ASSERT_NE(command, nullptr);
+    EXPECT_NO_THROW(command->execute());
+    command.reset();
+    manager.shutdownAll();
+}
+
+TEST_F(PluginWatcherTest, SetupFromDirectory_HotReload_ReloadsRebuiltLibrary) {
+    PluginManager manager;
+    std::atomic<int> rebinds{0};
+    manager.enableHotReload([&rebinds]() { ++rebinds; });
+    ASSERT_TRUE(manager.setupFromDirectory(directory));
+
+    // The plugin runs from a shadow copy, so its library can be replaced
+    rebuildLibrary();
+
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (rebinds < 2 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(PluginWatcher::POLL_INTERVAL);
+    }
+    EXPECT_EQ(rebinds, 2);
+    EXPECT_NE(manager.getPlugin("epsilon"), nullptr);
+    manager.shutdownAll();
+}
+
+TEST_F(PluginWatcherTest, SetupFromDirectory_HotReloadOfBrokenBuild_KeepsCommandOnStub) {
+    PluginManager manager;
+    std::atomic<int> rebinds{0};
+    std::atomic<bool> commandMissing{false};
+    // Like rebindSignals(), which fails on a command missing from the factory
+    manager.enableHotReload([&rebinds, &commandMissing]() {
+        if (!palantir::command::CommandFactory::getInstance()->getCommand("epsilon-command")) {
+            commandMissing = true;
+        }
+        ++rebinds;
+    });
+    ASSERT_TRUE(manager.setupFromDirectory(directory));
+
+    std::ofstream(library, std::ios::trunc) << "not a plugin";
+    std::filesystem::last_write_time(library, std::filesystem::file_time_type::clock::now());
+
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (rebinds < 2 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(PluginWatcher::POLL_INTERVAL);
+    }
+    EXPECT_EQ(rebinds, 2);
+    EXPECT_FALSE(commandMissing);
+    EXPECT_EQ(manager.getPlugin("epsilon"), nullptr);
+    EXPECT_EQ(manager.getDeferredPlugins(), std::vector<std::string>{"epsilon"});
+    EXPECT_NE(palantir::command::CommandFactory::getInstance()->getCommand("epsilon-command"), nullptr);
+    manager.shutdownAll();
+}
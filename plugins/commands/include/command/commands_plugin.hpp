@@ -1,13 +1,17 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "plugin/iplugin.hpp"
+#include "plugin/plugin_abi.hpp"
 #include "plugin_export.hpp"
 
 namespace palantir::plugins {
 
 class COMMANDS_PLUGIN_API CommandsPlugin : public plugin::IPlugin {
 public:
-    CommandsPlugin() = default;
+    explicit CommandsPlugin(plugin::abi::Host host);
     ~CommandsPlugin() override;
     
     // Rule of 5
@@ -20,6 +24,11 @@ public:
     auto shutdown() -> void override;
     [[nodiscard]] auto getName() const -> std::string override;
     [[nodiscard]] auto getVersion() const -> std::string override;
+    [[nodiscard]] auto getProvidedCommands() const -> std::vector<std::string> override;
+    [[nodiscard]] auto getDebouncedCommands() const -> std::vector<std::string> override;
+
+private:
+    plugin::abi::Host host_;
 };
 
 } // namespace palantir::plugins
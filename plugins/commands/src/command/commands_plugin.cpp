@@ -1,4 +1,7 @@
 #include "command/commands_plugin.hpp"
+
+#include <array>
+
 #include "command/command_factory.hpp"
 #include "command/show_command.hpp"
 #include "command/stop_command.hpp"
@@ -11,6 +14,8 @@
 
 namespace palantir::plugins {
 
+CommandsPlugin::CommandsPlugin(plugin::abi::Host host) : host_(host) {}
+
 CommandsPlugin::~CommandsPlugin() {
     // Call shutdown directly to avoid virtual dispatch during destruction
     CommandsPlugin::shutdown();
@@ -61,35 +66,47 @@ static auto createSendSauronHandleTodosRequestCommand() -> std::unique_ptr<comma
     return std::make_unique<command::SendSauronRequestCommand>(prompt::SAURON_HANDLE_TODOS_REQUEST_PROMPT);
 }
 
+namespace {
+
+struct ProvidedCommand {
+    const char* name;
+    command::CommandFactory::CommandCreator creator;
+    // Must match useDebounce() of the created command, recorded in the manifest without creating it
+    bool debounce;
+};
+
+}  // namespace
+
+// Every command the plugin registers, by name
+static const std::array<ProvidedCommand, 11> COMMANDS = {{
+    {"toggle", &createShowCommand, true},
+    {"stop", &createStopCommand, false},
+    {"window-screenshot", &createWindowScreenshotCommand, false},
+    {"toggle-transparency", &createToggleTransparencyCommand, true},
+    {"toggle-window-anonymity", &createToggleWindowAnonymityCommand, true},
+    {"clear-screenshot", &createClearScreenshotCommand, false},
+    {"send-sauron-implement-request", &createSendSauronImplementRequestCommand, false},
+    {"send-sauron-fix-errors-request", &createSendSauronFixErrorsRequestCommand, false},
+    {"send-sauron-validate-with-tests-request", &createSendSauronValidateWithTestsRequestCommand, false},
+    {"send-sauron-fix-test-failures-request", &createSendSauronFixTestFailuresRequestCommand, false},
+    {"send-sauron-handle-todos-request", &createSendSauronHandleTodosRequestCommand, false},
+}};
+
 auto CommandsPlugin::initialize() -> bool {
-    // Register commands using function pointers
-    command::CommandFactory::getInstance()->registerCommand("toggle", &createShowCommand);
-    command::CommandFactory::getInstance()->registerCommand("stop", &createStopCommand);
-    command::CommandFactory::getInstance()->registerCommand("window-screenshot", &createWindowScreenshotCommand);
-    command::CommandFactory::getInstance()->registerCommand("toggle-transparency", &createToggleTransparencyCommand);
-    command::CommandFactory::getInstance()->registerCommand("toggle-window-anonymity", &createToggleWindowAnonymityCommand);
-    command::CommandFactory::getInstance()->registerCommand("clear-screenshot", &createClearScreenshotCommand);
-    command::CommandFactory::getInstance()->registerCommand("send-sauron-implement-request", &createSendSauronImplementRequestCommand);
-    command::CommandFactory::getInstance()->registerCommand("send-sauron-fix-errors-request", &createSendSauronFixErrorsRequestCommand);
-    command::CommandFactory::getInstance()->registerCommand("send-sauron-validate-with-tests-request", &createSendSauronValidateWithTestsRequestCommand);
-    command::CommandFactory::getInstance()->registerCommand("send-sauron-fix-test-failures-request", &createSendSauronFixTestFailuresRequestCommand);
-    command::CommandFactory::getInstance()->registerCommand("send-sauron-handle-todos-request", &createSendSauronHandleTodosRequestCommand);
+    // Register commands through the host, which wraps them for its CommandFactory
+    for (const auto& command : COMMANDS) {
+        if (!host_.registerCommand(command.name, command.creator)) {
+            return false;
+        }
+    }
     return true;
 }
 
 auto CommandsPlugin::shutdown() -> void {
     // Unregister commands
-    command::CommandFactory::getInstance()->unregisterCommand("toggle");
-    command::CommandFactory::getInstance()->unregisterCommand("stop");
-    command::CommandFactory::getInstance()->unregisterCommand("window-screenshot");
-    command::CommandFactory::getInstance()->unregisterCommand("toggle-transparency");
-    command::CommandFactory::getInstance()->unregisterCommand("toggle-window-anonymity");
-    command::CommandFactory::getInstance()->unregisterCommand("clear-screenshot");
-    command::CommandFactory::getInstance()->unregisterCommand("send-sauron-implement-request");
-    command::CommandFactory::getInstance()->unregisterCommand("send-sauron-fix-errors-request");
-    command::CommandFactory::getInstance()->unregisterCommand("send-sauron-validate-with-tests-request");
-    command::CommandFactory::getInstance()->unregisterCommand("send-sauron-fix-test-failures-request");
-    command::CommandFactory::getInstance()->unregisterCommand("send-sauron-handle-todos-request");
+    for (const auto& command : COMMANDS) {
+        host_.unregisterCommand(command.name);
+    }
 }
 
 auto CommandsPlugin::getName() const -> std::string {
@@ -100,4 +117,23 @@ auto CommandsPlugin::getVersion() const -> std::string {
     return "1.0.0";
 }
 
+auto CommandsPlugin::getProvidedCommands() const -> std::vector<std::string> {
+    std::vector<std::string> names;
+    names.reserve(COMMANDS.size());
+    for (const auto& command : COMMANDS) {
+        names.emplace_back(command.name);
+    }
+    return names;
+}
+
+auto CommandsPlugin::getDebouncedCommands() const -> std::vector<std::string> {
+    std::vector<std::string> names;
+    for (const auto& command : COMMANDS) {
+        if (command.debounce) {
+            names.emplace_back(command.name);
+        }
+    }
+    return names;
+}
+
 } // namespace palantir::plugins 
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "command/send_sauron_request_command.hpp"
+#include "client/ai_request_strategy.hpp"
 #include "client/sauron_register.hpp"
 #include "sauron/client/SauronClient.hpp"
 #include "sauron/dto/DTOs.hpp"
@@ -10,6 +11,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <utility>
 
 namespace palantir::command {
 
@@ -28,16 +30,11 @@ auto SendSauronRequestCommand::execute() const -> void {
     auto sauronClient = sauronRegister->getSauronClient();
     DebugLog("Sauron client: ", sauronClient);
 
-    auto aiAlgorithmWithImageQuery = sauron::dto::AIQueryRequest(prompt_, sauron::dto::AIProvider::OPENAI, "gpt-4o");
-    DebugLog("AI algorithm with image query: ", aiAlgorithmWithImageQuery.toJson().dump(4));
-    for (const auto& image : images) {
-        aiAlgorithmWithImageQuery.addImage(image);
-    }
-    std::string responseStr;
+    nlohmann::json responseJson;
     try {
-        auto response = sauronClient->queryAlgorithm(aiAlgorithmWithImageQuery);
-        responseStr = response.toJson().dump(4);
-        DebugLog("Response: ", responseStr);
+        auto response = client::AIRequestStrategy::getInstance()->execute(sauronClient, prompt_, images);
+        responseJson = response.toJson();
+        DebugLog("Response received");
     } catch (const std::exception& e) {
         DebugLog("Error: ", e.what());
         throw palantir::exception::TraceableException<palantir::exception::BaseException>("Failed to query AI algorithm");
@@ -47,7 +44,10 @@ auto SendSauronRequestCommand::execute() const -> void {
     if (auto window = windowManager->getMainWindow()) {
         auto contentManager = window->getContentManager();
         if (contentManager) {
-            contentManager->setRootContent(responseStr);
+            // The request may run off the UI thread, the view is only updated from it
+            app_->getUiDispatcher()->dispatch([contentManager, response = std::move(responseJson)]() mutable {
+                contentManager->setRootContentJson(std::move(response));
+            });
         } else {
             throw palantir::exception::TraceableContentManagerException("Content manager not found");
         }
@@ -1,13 +1,17 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <algorithm>
 #include "command/commands_plugin.hpp"
+#include "command/command_factory.hpp"
+#include "command/icommand.hpp"
+#include "plugin/plugin_host.hpp"
 
 using namespace palantir::plugins;
 using namespace testing;
 
 class CommandsPluginTest : public Test {
 protected:
-    CommandsPlugin plugin_;
+    CommandsPlugin plugin_{palantir::plugin::abi::Host(palantir::plugin::PluginHost::getApi())};
 };
 
 TEST_F(CommandsPluginTest, Initialize_ReturnsTrue) {
@@ -24,4 +28,35 @@ TEST_F(CommandsPluginTest, GetName_ReturnsNonEmptyString) {
 
 TEST_F(CommandsPluginTest, GetVersion_ReturnsNonEmptyString) {
     EXPECT_THAT(plugin_.getVersion(), Not(IsEmpty()));
-} 
\ No newline at end of file
+}
+
+TEST_F(CommandsPluginTest, GetProvidedCommands_MatchesRegisteredCommands) {
+    auto factory = palantir::command::CommandFactory::getInstance();
+    ASSERT_TRUE(plugin_.initialize());
+
+    auto commands = plugin_.getProvidedCommands();
+    EXPECT_THAT(commands, Contains("toggle"));
+    for (const auto& name : commands) {
+        EXPECT_NE(factory->getCommand(name), nullptr) << name;
+    }
+
+    plugin_.shutdown();
+    for (const auto& name : commands) {
+        EXPECT_EQ(factory->getCommand(name), nullptr) << name;
+    }
+}
+
+TEST_F(CommandsPluginTest, GetDebouncedCommands_MatchesUseDebounceOfCommands) {
+    auto factory = palantir::command::CommandFactory::getInstance();
+    ASSERT_TRUE(plugin_.initialize());
+
+    const auto debounced = plugin_.getDebouncedCommands();
+    for (const auto& name : plugin_.getProvidedCommands()) {
+        auto command = factory->getCommand(name);
+        ASSERT_NE(command, nullptr) << name;
+        EXPECT_EQ(command->useDebounce(), std::find(debounced.begin(), debounced.end(), name) != debounced.end())
+            << name;
+    }
+
+    plugin_.shutdown();
+}
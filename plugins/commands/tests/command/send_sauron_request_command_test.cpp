@@ -17,6 +17,10 @@ using namespace palantir::command;
 using namespace palantir::test;
 using namespace testing;
 
+MATCHER_P(ResponseIs, expected, "") {
+    return arg.contains("response") && arg["response"] == expected;
+}
+
 class SendSauronRequestCommandTest : public Test {
 protected:
     void SetUp() override {
@@ -92,7 +96,7 @@ TEST_F(SendSauronRequestCommandTest, ExecuteSetsContentWhenWindowExists) {
     EXPECT_CALL(*mockSauronClient, queryAlgorithm(_))
         .WillOnce(Return(mockResponse));
     
-    EXPECT_CALL(*mockContentManager, setRootContent(HasSubstr("Test response")))
+    EXPECT_CALL(*mockContentManager, setRootContentJson(ResponseIs("Test response")))
         .Times(1);
     
     SendSauronRequestCommand command(testPrompt);
@@ -122,7 +126,7 @@ TEST_F(SendSauronRequestCommandTest, ExecuteSendPrompt) {
         Property(&sauron::dto::AIQueryRequest::getPrompt, Eq(testPrompt))))
         .WillOnce(Return(mockResponse));
         
-    EXPECT_CALL(*mockContentManager, setRootContent(HasSubstr("Test response")))
+    EXPECT_CALL(*mockContentManager, setRootContentJson(ResponseIs("Test response")))
         .Times(1);
     
     SendSauronRequestCommand command(testPrompt);
@@ -158,7 +162,7 @@ TEST_F(SendSauronRequestCommandTest, ExecuteReadScreenshotImage) {
         Property(&sauron::dto::AIQueryRequest::getImages, Not(IsEmpty()))))
         .WillOnce(Return(mockResponse));
         
-    EXPECT_CALL(*mockContentManager, setRootContent(HasSubstr("Test response")))
+    EXPECT_CALL(*mockContentManager, setRootContentJson(ResponseIs("Test response")))
         .Times(1);
     
     SendSauronRequestCommand command(testPrompt);
@@ -188,7 +192,7 @@ TEST_F(SendSauronRequestCommandTest, ExecuteSendAIProvider) {
         Property(&sauron::dto::AIQueryRequest::getProvider, Eq(sauron::dto::AIProvider::OPENAI))))
         .WillOnce(Return(mockResponse));
         
-    EXPECT_CALL(*mockContentManager, setRootContent(HasSubstr("Test response")))
+    EXPECT_CALL(*mockContentManager, setRootContentJson(ResponseIs("Test response")))
         .Times(1);
     
     SendSauronRequestCommand command(testPrompt);
@@ -218,7 +222,7 @@ TEST_F(SendSauronRequestCommandTest, ExecuteSendAIModel) {
         Property(&sauron::dto::AIQueryRequest::getModel, Eq("gpt-4o"))))
         .WillOnce(Return(mockResponse));
         
-    EXPECT_CALL(*mockContentManager, setRootContent(HasSubstr("Test response")))
+    EXPECT_CALL(*mockContentManager, setRootContentJson(ResponseIs("Test response")))
         .Times(1);
     
     SendSauronRequestCommand command(testPrompt);
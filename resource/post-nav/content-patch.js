@@ -0,0 +1,218 @@
+(function() {
+    // Local copy of the content held by the host ContentManager.
+    // The host sends a full 'setContent' snapshot when the page (re)loads and
+    // RFC 6902 'patch' messages for every later update. Updates made during the
+    // same frame arrive together in a 'batch' message. Once negotiated, messages
+    // may arrive MessagePack encoded inside an 'encoded' envelope.
+    let content = {};
+
+    // Payload encodings this page can decode besides JSON, sent to the host with every sync request
+    const ENCODINGS = ['msgpack'];
+    const textDecoder = new TextDecoder();
+
+    function base64ToBytes(text) {
+        const binary = atob(text);
+        const bytes = new Uint8Array(binary.length);
+        for (let i = 0; i < binary.length; i++) {
+            bytes[i] = binary.charCodeAt(i);
+        }
+        return bytes;
+    }
+
+    // Minimal MessagePack decoder covering what the host serializer emits
+    function decodeMsgpack(bytes) {
+        const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+        let offset = 0;
+
+        function take(length) {
+            const start = offset;
+            offset += length;
+            if (offset > bytes.length) {
+                throw new Error('Truncated MessagePack payload');
+            }
+            return start;
+        }
+        function string(length) {
+            const start = take(length);
+            return textDecoder.decode(bytes.subarray(start, start + length));
+        }
+        function binary(length) {
+            const start = take(length);
+            return bytes.slice(start, start + length);
+        }
+        function array(length) {
+            const result = new Array(length);
+            for (let i = 0; i < length; i++) {
+                result[i] = value();
+            }
+            return result;
+        }
+        function map(length) {
+            const result = {};
+            for (let i = 0; i < length; i++) {
+                const key = value();
+                result[key] = value();
+            }
+            return result;
+        }
+        function value() {
+            const byte = bytes[take(1)];
+            if (byte <= 0x7f) return byte;
+            if (byte <= 0x8f) return map(byte & 0x0f);
+            if (byte <= 0x9f) return array(byte & 0x0f);
+            if (byte <= 0xbf) return string(byte & 0x1f);
+            if (byte >= 0xe0) return byte - 0x100;
+            switch (byte) {
+                case 0xc0: return null;
+                case 0xc2: return false;
+                case 0xc3: return true;
+                case 0xc4: return binary(view.getUint8(take(1)));
+                case 0xc5: return binary(view.getUint16(take(2)));
+                case 0xc6: return binary(view.getUint32(take(4)));
+                case 0xca: return view.getFloat32(take(4));
+                case 0xcb: return view.getFloat64(take(8));
+                case 0xcc: return view.getUint8(take(1));
+                case 0xcd: return view.getUint16(take(2));
+                case 0xce: return view.getUint32(take(4));
+                case 0xcf: return Number(view.getBigUint64(take(8)));
+                case 0xd0: return view.getInt8(take(1));
+                case 0xd1: return view.getInt16(take(2));
+                case 0xd2: return view.getInt32(take(4));
+                case 0xd3: return Number(view.getBigInt64(take(8)));
+                case 0xd9: return string(view.getUint8(take(1)));
+                case 0xda: return string(view.getUint16(take(2)));
+                case 0xdb: return string(view.getUint32(take(4)));
+                case 0xdc: return array(view.getUint16(take(2)));
+                case 0xdd: return array(view.getUint32(take(4)));
+                case 0xde: return map(view.getUint16(take(2)));
+                case 0xdf: return map(view.getUint32(take(4)));
+                default: throw new Error('Unsupported MessagePack type 0x' + byte.toString(16));
+            }
+        }
+
+        return value();
+    }
+
+    function requestSync(reason) {
+        window.chrome.webview.postMessage({ type: 'contentReady', event: { reason: reason, encodings: ENCODINGS } });
+    }
+
+    function unescapeToken(token) {
+        return token.replace(/~1/g, '/').replace(/~0/g, '~');
+    }
+
+    function parsePointer(path) {
+        if (path === '') {
+            return [];
+        }
+        return path.substring(1).split('/').map(unescapeToken);
+    }
+
+    // Apply one add/replace/remove operation and return the (possibly new) document
+    function applyOperation(document, operation) {
+        const tokens = parsePointer(operation.path);
+        if (tokens.length === 0) {
+            return operation.op === 'remove' ? {} : operation.value;
+        }
+
+        let parent = document;
+        for (let i = 0; i < tokens.length - 1; i++) {
+            parent = parent[Array.isArray(parent) ? parseInt(tokens[i], 10) : tokens[i]];
+            if (parent === undefined || parent === null) {
+                throw new Error('Missing parent for ' + operation.path);
+            }
+        }
+
+        const key = tokens[tokens.length - 1];
+        if (Array.isArray(parent)) {
+            const index = key === '-' ? parent.length : parseInt(key, 10);
+            switch (operation.op) {
+                case 'add':
+                    parent.splice(index, 0, operation.value);
+                    break;
+                case 'replace':
+                    parent[index] = operation.value;
+                    break;
+                case 'remove':
+                    parent.splice(index, 1);
+                    break;
+                default:
+                    throw new Error('Unsupported patch operation ' + operation.op);
+            }
+        } else {
+            switch (operation.op) {
+                case 'add':
+                case 'replace':
+                    parent[key] = operation.value;
+                    break;
+                case 'remove':
+                    delete parent[key];
+                    break;
+                default:
+                    throw new Error('Unsupported patch operation ' + operation.op);
+            }
+        }
+        return document;
+    }
+
+    window.addEventListener('message', function(event) {
+        const data = event.data;
+        // Ignore our own re-dispatched snapshots
+        if (!data || data.source === 'content-patch') {
+            return;
+        }
+
+        if (data.type === 'encoded') {
+            if (data.encoding !== 'msgpack') {
+                return;
+            }
+            let message;
+            try {
+                message = decodeMsgpack(base64ToBytes(data.data));
+            } catch (error) {
+                requestSync('decodeFailed');
+                return;
+            }
+            window.dispatchEvent(new MessageEvent('message', { data: message }));
+            return;
+        }
+        if (data.type === 'batch') {
+            // Unpack in order so every listener sees the individual messages
+            for (const message of data.messages) {
+                window.dispatchEvent(new MessageEvent('message', { data: message }));
+            }
+            return;
+        }
+        if (data.type === 'setContent') {
+            content = data.content;
+            return;
+        }
+        if (data.type !== 'patch') {
+            return;
+        }
+
+        try {
+            for (const operation of data.ops) {
+                content = applyOperation(content, operation);
+            }
+        } catch (error) {
+            // Out of sync with the host, ask for a fresh snapshot
+            requestSync('patchFailed');
+            return;
+        }
+
+        // Render through the same path as a full update
+        window.dispatchEvent(new MessageEvent('message', {
+            data: { type: 'setContent', content: content, source: 'content-patch' }
+        }));
+    });
+
+    // The host posts content messages on the native web message channel, hand them to the
+    // page listeners as regular window messages
+    window.chrome.webview.addEventListener('message', function(event) {
+        window.dispatchEvent(new MessageEvent('message', { data: event.data }));
+    });
+
+    // Ask the host for the snapshot patches will apply to
+    requestSync('load');
+})();